@@ -127,6 +127,7 @@ typedef enum CLBlastStatusCode_ {
   CLBlastInvalidVectorZ = -2038,            // Vector Z is not a valid OpenCL buffer
   CLBlastInvalidIncrementZ = -2037,         // Increment of vector Z cannot be zero
   CLBlastInsufficientMemoryZ = -2036,       // Vector Z's OpenCL buffer is too small
+  CLBlastInvalidExpression = -2035,         // The run-time expression could not be parsed
 } CLBlastStatusCode;
 
 // Matrix layout and transpose types
@@ -143,6 +144,11 @@ typedef enum CLBlastKernelMode_ {
   CLBlastKernelModeCrossCorrelation = 151,
   CLBlastKernelModeConvolution = 152
 } CLBlastKernelMode;
+typedef enum CLBlastReductionMode_ {
+  CLBlastReductionModeDefault = 161,
+  CLBlastReductionModeReproducible = 162,
+  CLBlastReductionModeCompensated = 163
+} CLBlastReductionMode;
 
 // Precision enum (values in bits)
 typedef enum CLBlastPrecision_ {
@@ -1147,6 +1153,193 @@ CLBlastStatusCode PUBLIC_API CLBlastHhad(const size_t n, const cl_half alpha, co
                                          const size_t z_offset, const size_t z_inc, cl_command_queue* queue,
                                          cl_event* event);
 
+// Scaled vector plus scaled vector: SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+CLBlastStatusCode PUBLIC_API CLBlastSaxpby(const size_t n, const float alpha, const cl_mem x_buffer,
+                                           const size_t x_offset, const size_t x_inc, const float beta, cl_mem y_buffer,
+                                           const size_t y_offset, const size_t y_inc, cl_command_queue* queue,
+                                           cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpby(const size_t n, const double alpha, const cl_mem x_buffer,
+                                           const size_t x_offset, const size_t x_inc, const double beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpby(const size_t n, const cl_float2 alpha, const cl_mem x_buffer,
+                                           const size_t x_offset, const size_t x_inc, const cl_float2 beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpby(const size_t n, const cl_double2 alpha, const cl_mem x_buffer,
+                                           const size_t x_offset, const size_t x_inc, const cl_double2 beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpby(const size_t n, const cl_half alpha, const cl_mem x_buffer,
+                                           const size_t x_offset, const size_t x_inc, const cl_half beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Scaled vector plus scaled vector into a third vector: SWAXPBY/DWAXPBY/CWAXPBY/ZWAXPBY/HWAXPBY
+CLBlastStatusCode PUBLIC_API CLBlastSwaxpby(const size_t n, const float alpha, const cl_mem x_buffer,
+                                            const size_t x_offset, const size_t x_inc, const float beta,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDwaxpby(const size_t n, const double alpha, const cl_mem x_buffer,
+                                            const size_t x_offset, const size_t x_inc, const double beta,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCwaxpby(const size_t n, const cl_float2 alpha, const cl_mem x_buffer,
+                                            const size_t x_offset, const size_t x_inc, const cl_float2 beta,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZwaxpby(const size_t n, const cl_double2 alpha, const cl_mem x_buffer,
+                                            const size_t x_offset, const size_t x_inc, const cl_double2 beta,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHwaxpby(const size_t n, const cl_half alpha, const cl_mem x_buffer,
+                                            const size_t x_offset, const size_t x_inc, const cl_half beta,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                            cl_command_queue* queue, cl_event* event);
+
+// AXPY with alpha in device memory (non-BLAS function): SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
+CLBlastStatusCode PUBLIC_API CLBlastSaxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc, cl_mem y_buffer,
+                                                       const size_t y_offset, const size_t y_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc, cl_mem y_buffer,
+                                                       const size_t y_offset, const size_t y_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc, cl_mem y_buffer,
+                                                       const size_t y_offset, const size_t y_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc, cl_mem y_buffer,
+                                                       const size_t y_offset, const size_t y_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc, cl_mem y_buffer,
+                                                       const size_t y_offset, const size_t y_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+
+// SCAL with alpha in device memory (non-BLAS function): SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
+CLBlastStatusCode PUBLIC_API CLBlastSscalDeviceScalars(const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDscalDeviceScalars(const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCscalDeviceScalars(const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZscalDeviceScalars(const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHscalDeviceScalars(const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+
+// GEMV with alpha and beta in device memory (non-BLAS function): SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
+CLBlastStatusCode PUBLIC_API CLBlastSgemvDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                       const size_t m, const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem a_buffer,
+                                                       const size_t a_offset, const size_t a_ld, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc,
+                                                       const cl_mem beta_buffer, const size_t beta_offset,
+                                                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                       const size_t m, const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem a_buffer,
+                                                       const size_t a_offset, const size_t a_ld, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc,
+                                                       const cl_mem beta_buffer, const size_t beta_offset,
+                                                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                       const size_t m, const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem a_buffer,
+                                                       const size_t a_offset, const size_t a_ld, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc,
+                                                       const cl_mem beta_buffer, const size_t beta_offset,
+                                                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                       const size_t m, const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem a_buffer,
+                                                       const size_t a_offset, const size_t a_ld, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc,
+                                                       const cl_mem beta_buffer, const size_t beta_offset,
+                                                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                       const size_t m, const size_t n, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem a_buffer,
+                                                       const size_t a_offset, const size_t a_ld, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc,
+                                                       const cl_mem beta_buffer, const size_t beta_offset,
+                                                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                       cl_command_queue* queue, cl_event* event);
+
+// GEMM with alpha and beta in device memory (non-BLAS function): SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+CLBlastStatusCode PUBLIC_API CLBlastSgemmDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                       const CLBlastTranspose b_transpose, const size_t m,
+                                                       const size_t n, const size_t k, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem a_buffer,
+                                                       const size_t a_offset, const size_t a_ld, const cl_mem b_buffer,
+                                                       const size_t b_offset, const size_t b_ld,
+                                                       const cl_mem beta_buffer, const size_t beta_offset,
+                                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                       const CLBlastTranspose b_transpose, const size_t m,
+                                                       const size_t n, const size_t k, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem a_buffer,
+                                                       const size_t a_offset, const size_t a_ld, const cl_mem b_buffer,
+                                                       const size_t b_offset, const size_t b_ld,
+                                                       const cl_mem beta_buffer, const size_t beta_offset,
+                                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                       const CLBlastTranspose b_transpose, const size_t m,
+                                                       const size_t n, const size_t k, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem a_buffer,
+                                                       const size_t a_offset, const size_t a_ld, const cl_mem b_buffer,
+                                                       const size_t b_offset, const size_t b_ld,
+                                                       const cl_mem beta_buffer, const size_t beta_offset,
+                                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                       const CLBlastTranspose b_transpose, const size_t m,
+                                                       const size_t n, const size_t k, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem a_buffer,
+                                                       const size_t a_offset, const size_t a_ld, const cl_mem b_buffer,
+                                                       const size_t b_offset, const size_t b_ld,
+                                                       const cl_mem beta_buffer, const size_t beta_offset,
+                                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                       const CLBlastTranspose b_transpose, const size_t m,
+                                                       const size_t n, const size_t k, const cl_mem alpha_buffer,
+                                                       const size_t alpha_offset, const cl_mem a_buffer,
+                                                       const size_t a_offset, const size_t a_ld, const cl_mem b_buffer,
+                                                       const size_t b_offset, const size_t b_ld,
+                                                       const cl_mem beta_buffer, const size_t beta_offset,
+                                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                       cl_command_queue* queue, cl_event* event);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 CLBlastStatusCode PUBLIC_API CLBlastSomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                                               const size_t m, const size_t n, const float alpha, const cl_mem a_buffer,
@@ -1299,6 +1492,362 @@ CLBlastStatusCode PUBLIC_API CLBlastHaxpyBatched(const size_t n, const cl_half*
                                                  const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
                                                  cl_command_queue* queue, cl_event* event);
 
+// Batched version of ROT: SROTBATCHED/DROTBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSrotBatched(const size_t n, cl_mem x_buffer, const size_t* x_offsets,
+                                                const size_t x_inc, cl_mem y_buffer, const size_t* y_offsets,
+                                                const size_t y_inc, const float* cos_values, const float* sin_values,
+                                                const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDrotBatched(const size_t n, cl_mem x_buffer, const size_t* x_offsets,
+                                                const size_t x_inc, cl_mem y_buffer, const size_t* y_offsets,
+                                                const size_t y_inc, const double* cos_values, const double* sin_values,
+                                                const size_t batch_count, cl_command_queue* queue, cl_event* event);
+
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSdotBatched(const size_t n, cl_mem dot_buffer, const size_t* dot_offsets,
+                                                const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                const cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                                const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdotBatched(const size_t n, cl_mem dot_buffer, const size_t* dot_offsets,
+                                                const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                const cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                                const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdotBatched(const size_t n, cl_mem dot_buffer, const size_t* dot_offsets,
+                                                const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                const cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                                const size_t batch_count, cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset,
+                                                       const size_t dot_stride, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                       const size_t y_stride, const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset,
+                                                       const size_t dot_stride, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                       const size_t y_stride, const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset,
+                                                       const size_t dot_stride, const cl_mem x_buffer,
+                                                       const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                       const size_t y_stride, const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets,
+                                                  const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                  const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDznrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets,
+                                                  const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                  const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const size_t batch_count, cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of NRM2:
+// SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                                        const size_t nrm2_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                                        const size_t nrm2_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                                         const size_t nrm2_stride, const cl_mem x_buffer,
+                                                         const size_t x_offset, const size_t x_inc,
+                                                         const size_t x_stride, const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDznrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                                         const size_t nrm2_stride, const cl_mem x_buffer,
+                                                         const size_t x_offset, const size_t x_inc,
+                                                         const size_t x_stride, const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                                        const size_t nrm2_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// Batched version of ASUM: SASUMBATCHED/DASUMBATCHED/ScASUMBATCHED/DzASUMBATCHED/HASUMBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSasumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDasumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScasumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets,
+                                                  const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                  const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDzasumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets,
+                                                  const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                  const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHasumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const size_t batch_count, cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of ASUM:
+// SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset,
+                                                        const size_t asum_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset,
+                                                        const size_t asum_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset,
+                                                         const size_t asum_stride, const cl_mem x_buffer,
+                                                         const size_t x_offset, const size_t x_inc,
+                                                         const size_t x_stride, const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDzasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset,
+                                                         const size_t asum_stride, const cl_mem x_buffer,
+                                                         const size_t x_offset, const size_t x_inc,
+                                                         const size_t x_stride, const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset,
+                                                        const size_t asum_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// Batched version of AMAX: iSAMAXBATCHED/iDAMAXBATCHED/iCAMAXBATCHED/iZAMAXBATCHED/iHAMAXBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastiSamaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets,
+                                                  const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                  const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiDamaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets,
+                                                  const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                  const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiCamaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets,
+                                                  const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                  const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiZamaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets,
+                                                  const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                  const size_t batch_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiHamaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets,
+                                                  const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                  const size_t batch_count, cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of AMAX:
+// iSAMAXSTRIDEDBATCHED/iDAMAXSTRIDEDBATCHED/iCAMAXSTRIDEDBATCHED/iZAMAXSTRIDEDBATCHED/iHAMAXSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastiSamaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                                         const size_t imax_stride, const cl_mem x_buffer,
+                                                         const size_t x_offset, const size_t x_inc,
+                                                         const size_t x_stride, const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiDamaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                                         const size_t imax_stride, const cl_mem x_buffer,
+                                                         const size_t x_offset, const size_t x_inc,
+                                                         const size_t x_stride, const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiCamaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                                         const size_t imax_stride, const cl_mem x_buffer,
+                                                         const size_t x_offset, const size_t x_inc,
+                                                         const size_t x_stride, const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiZamaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                                         const size_t imax_stride, const cl_mem x_buffer,
+                                                         const size_t x_offset, const size_t x_inc,
+                                                         const size_t x_stride, const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiHamaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                                         const size_t imax_stride, const cl_mem x_buffer,
+                                                         const size_t x_offset, const size_t x_inc,
+                                                         const size_t x_stride, const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+
+// Matrix version of AMAX (per column of op(A)): iSAMAXMATRIX/iDAMAXMATRIX/iCAMAXMATRIX/iZAMAXMATRIX/iHAMAXMATRIX
+CLBlastStatusCode PUBLIC_API CLBlastiSamaxMatrix(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n, cl_mem imax_buffer,
+                                                 const size_t imax_offset, const cl_mem a_buffer, const size_t a_offset,
+                                                 const size_t a_ld, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiDamaxMatrix(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n, cl_mem imax_buffer,
+                                                 const size_t imax_offset, const cl_mem a_buffer, const size_t a_offset,
+                                                 const size_t a_ld, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiCamaxMatrix(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n, cl_mem imax_buffer,
+                                                 const size_t imax_offset, const cl_mem a_buffer, const size_t a_offset,
+                                                 const size_t a_ld, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiZamaxMatrix(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n, cl_mem imax_buffer,
+                                                 const size_t imax_offset, const cl_mem a_buffer, const size_t a_offset,
+                                                 const size_t a_ld, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastiHamaxMatrix(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n, cl_mem imax_buffer,
+                                                 const size_t imax_offset, const cl_mem a_buffer, const size_t a_offset,
+                                                 const size_t a_ld, cl_command_queue* queue, cl_event* event);
+
+// Scaling of the rows or columns of a matrix by a vector: SDGMM/DDGMM/CDGMM/ZDGMM/HDGMM
+CLBlastStatusCode PUBLIC_API CLBlastSdgmm(const CLBlastLayout layout, const CLBlastSide side, const size_t m,
+                                          const size_t n, const cl_mem a_buffer, const size_t a_offset,
+                                          const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                                          const size_t x_inc, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdgmm(const CLBlastLayout layout, const CLBlastSide side, const size_t m,
+                                          const size_t n, const cl_mem a_buffer, const size_t a_offset,
+                                          const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                                          const size_t x_inc, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCdgmm(const CLBlastLayout layout, const CLBlastSide side, const size_t m,
+                                          const size_t n, const cl_mem a_buffer, const size_t a_offset,
+                                          const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                                          const size_t x_inc, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZdgmm(const CLBlastLayout layout, const CLBlastSide side, const size_t m,
+                                          const size_t n, const cl_mem a_buffer, const size_t a_offset,
+                                          const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                                          const size_t x_inc, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdgmm(const CLBlastLayout layout, const CLBlastSide side, const size_t m,
+                                          const size_t n, const cl_mem a_buffer, const size_t a_offset,
+                                          const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                                          const size_t x_inc, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of DGMM: SDGMMSTRIDEDBATCHED/DDGMMSTRIDEDBATCHED/CDGMMSTRIDEDBATCHED/ZDGMMSTRIDEDBATCHED/
+// HDGMMSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSdgmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side,
+                                                        const size_t m, const size_t n, const cl_mem a_buffer,
+                                                        const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset,
+                                                        const size_t x_inc, const size_t x_stride, cl_mem c_buffer,
+                                                        const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count, cl_command_queue* queue,
+                                                        cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdgmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side,
+                                                        const size_t m, const size_t n, const cl_mem a_buffer,
+                                                        const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset,
+                                                        const size_t x_inc, const size_t x_stride, cl_mem c_buffer,
+                                                        const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count, cl_command_queue* queue,
+                                                        cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCdgmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side,
+                                                        const size_t m, const size_t n, const cl_mem a_buffer,
+                                                        const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset,
+                                                        const size_t x_inc, const size_t x_stride, cl_mem c_buffer,
+                                                        const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count, cl_command_queue* queue,
+                                                        cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZdgmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side,
+                                                        const size_t m, const size_t n, const cl_mem a_buffer,
+                                                        const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset,
+                                                        const size_t x_inc, const size_t x_stride, cl_mem c_buffer,
+                                                        const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count, cl_command_queue* queue,
+                                                        cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdgmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side,
+                                                        const size_t m, const size_t n, const cl_mem a_buffer,
+                                                        const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset,
+                                                        const size_t x_inc, const size_t x_stride, cl_mem c_buffer,
+                                                        const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count, cl_command_queue* queue,
+                                                        cl_event* event);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n, const float* alphas,
+                                                 const cl_mem a_buffer, const size_t* a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const float* betas, cl_mem y_buffer, const size_t* y_offsets,
+                                                 const size_t y_inc, const size_t batch_count, cl_command_queue* queue,
+                                                 cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n, const double* alphas,
+                                                 const cl_mem a_buffer, const size_t* a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const double* betas, cl_mem y_buffer, const size_t* y_offsets,
+                                                 const size_t y_inc, const size_t batch_count, cl_command_queue* queue,
+                                                 cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n, const cl_float2* alphas,
+                                                 const cl_mem a_buffer, const size_t* a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const cl_float2* betas, cl_mem y_buffer, const size_t* y_offsets,
+                                                 const size_t y_inc, const size_t batch_count, cl_command_queue* queue,
+                                                 cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n, const cl_double2* alphas,
+                                                 const cl_mem a_buffer, const size_t* a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const cl_double2* betas, cl_mem y_buffer, const size_t* y_offsets,
+                                                 const size_t y_inc, const size_t batch_count, cl_command_queue* queue,
+                                                 cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n, const cl_half* alphas,
+                                                 const cl_mem a_buffer, const size_t* a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                                 const cl_half* betas, cl_mem y_buffer, const size_t* y_offsets,
+                                                 const size_t y_inc, const size_t batch_count, cl_command_queue* queue,
+                                                 cl_event* event);
+
+// StridedBatched version of GEMV:
+// SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n, const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                        const size_t a_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const float beta, cl_mem y_buffer,
+                                                        const size_t y_offset, const size_t y_inc,
+                                                        const size_t y_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n, const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                        const size_t a_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const double beta, cl_mem y_buffer,
+                                                        const size_t y_offset, const size_t y_inc,
+                                                        const size_t y_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n, const cl_float2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                        const size_t a_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const cl_float2 beta, cl_mem y_buffer,
+                                                        const size_t y_offset, const size_t y_inc,
+                                                        const size_t y_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n, const cl_double2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                        const size_t a_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const cl_double2 beta, cl_mem y_buffer,
+                                                        const size_t y_offset, const size_t y_inc,
+                                                        const size_t y_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n, const cl_half alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                        const size_t a_stride, const cl_mem x_buffer,
+                                                        const size_t x_offset, const size_t x_inc,
+                                                        const size_t x_stride, const cl_half beta, cl_mem y_buffer,
+                                                        const size_t y_offset, const size_t y_inc,
+                                                        const size_t y_stride, const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 CLBlastStatusCode PUBLIC_API CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                                                  const CLBlastTranspose b_transpose, const size_t m, const size_t n,
@@ -1369,6 +1918,98 @@ CLBlastStatusCode PUBLIC_API CLBlastHgemmStridedBatched(
     const size_t b_stride, const cl_half beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
     const size_t c_stride, const size_t batch_count, cl_command_queue* queue, cl_event* event);
 
+// Grouped version of GEMM, with different sizes per entry:
+// SGEMMGROUPED/DGEMMGROUPED/CGEMMGROUPED/ZGEMMGROUPED/HGEMMGROUPED
+CLBlastStatusCode PUBLIC_API CLBlastSgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const CLBlastTranspose b_transpose, const size_t* ms, const size_t* ns,
+                                                 const size_t* ks, const float* alphas, const cl_mem a_buffer,
+                                                 const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer,
+                                                 const size_t* b_offsets, const size_t* b_lds, const float* betas,
+                                                 cl_mem c_buffer, const size_t* c_offsets, const size_t* c_lds,
+                                                 const size_t group_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const CLBlastTranspose b_transpose, const size_t* ms, const size_t* ns,
+                                                 const size_t* ks, const double* alphas, const cl_mem a_buffer,
+                                                 const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer,
+                                                 const size_t* b_offsets, const size_t* b_lds, const double* betas,
+                                                 cl_mem c_buffer, const size_t* c_offsets, const size_t* c_lds,
+                                                 const size_t group_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const CLBlastTranspose b_transpose, const size_t* ms, const size_t* ns,
+                                                 const size_t* ks, const cl_float2* alphas, const cl_mem a_buffer,
+                                                 const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer,
+                                                 const size_t* b_offsets, const size_t* b_lds, const cl_float2* betas,
+                                                 cl_mem c_buffer, const size_t* c_offsets, const size_t* c_lds,
+                                                 const size_t group_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const CLBlastTranspose b_transpose, const size_t* ms, const size_t* ns,
+                                                 const size_t* ks, const cl_double2* alphas, const cl_mem a_buffer,
+                                                 const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer,
+                                                 const size_t* b_offsets, const size_t* b_lds, const cl_double2* betas,
+                                                 cl_mem c_buffer, const size_t* c_offsets, const size_t* c_lds,
+                                                 const size_t group_count, cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const CLBlastTranspose b_transpose, const size_t* ms, const size_t* ns,
+                                                 const size_t* ks, const cl_half* alphas, const cl_mem a_buffer,
+                                                 const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer,
+                                                 const size_t* b_offsets, const size_t* b_lds, const cl_half* betas,
+                                                 cl_mem c_buffer, const size_t* c_offsets, const size_t* c_lds,
+                                                 const size_t group_count, cl_command_queue* queue, cl_event* event);
+
+// Deferred version of GER, applying k rank-1 updates at once: SGERDEFERRED/DGERDEFERRED/HGERDEFERRED
+CLBlastStatusCode PUBLIC_API CLBlastSgerDeferred(const CLBlastLayout layout, const size_t m, const size_t n,
+                                                 const float* alphas, const cl_mem x_buffer, const size_t* x_offsets,
+                                                 const size_t x_inc, const cl_mem y_buffer, const size_t* y_offsets,
+                                                 const size_t y_inc, cl_mem a_buffer, const size_t a_offset,
+                                                 const size_t a_ld, const size_t k, cl_command_queue* queue,
+                                                 cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgerDeferred(const CLBlastLayout layout, const size_t m, const size_t n,
+                                                 const double* alphas, const cl_mem x_buffer, const size_t* x_offsets,
+                                                 const size_t x_inc, const cl_mem y_buffer, const size_t* y_offsets,
+                                                 const size_t y_inc, cl_mem a_buffer, const size_t a_offset,
+                                                 const size_t a_ld, const size_t k, cl_command_queue* queue,
+                                                 cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgerDeferred(const CLBlastLayout layout, const size_t m, const size_t n,
+                                                 const cl_half* alphas, const cl_mem x_buffer, const size_t* x_offsets,
+                                                 const size_t x_inc, const cl_mem y_buffer, const size_t* y_offsets,
+                                                 const size_t y_inc, cl_mem a_buffer, const size_t a_offset,
+                                                 const size_t a_ld, const size_t k, cl_command_queue* queue,
+                                                 cl_event* event);
+
+// Deferred version of SYR2, applying k rank-2 updates at once: SSYR2DEFERRED/DSYR2DEFERRED/HSYR2DEFERRED
+CLBlastStatusCode PUBLIC_API CLBlastSsyr2Deferred(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                                  const size_t n, const float* alphas, const cl_mem x_buffer,
+                                                  const size_t* x_offsets, const size_t x_inc, const cl_mem y_buffer,
+                                                  const size_t* y_offsets, const size_t y_inc, cl_mem a_buffer,
+                                                  const size_t a_offset, const size_t a_ld, const size_t k,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDsyr2Deferred(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                                  const size_t n, const double* alphas, const cl_mem x_buffer,
+                                                  const size_t* x_offsets, const size_t x_inc, const cl_mem y_buffer,
+                                                  const size_t* y_offsets, const size_t y_inc, cl_mem a_buffer,
+                                                  const size_t a_offset, const size_t a_ld, const size_t k,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHsyr2Deferred(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                                  const size_t n, const cl_half* alphas, const cl_mem x_buffer,
+                                                  const size_t* x_offsets, const size_t x_inc, const cl_mem y_buffer,
+                                                  const size_t* y_offsets, const size_t y_inc, cl_mem a_buffer,
+                                                  const size_t a_offset, const size_t a_ld, const size_t k,
+                                                  cl_command_queue* queue, cl_event* event);
+
+// Deferred version of HER2, applying k rank-2 updates at once: CHER2DEFERRED/ZHER2DEFERRED
+CLBlastStatusCode PUBLIC_API CLBlastCher2Deferred(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                                  const size_t n, const cl_float2* alphas, const cl_mem x_buffer,
+                                                  const size_t* x_offsets, const size_t x_inc, const cl_mem y_buffer,
+                                                  const size_t* y_offsets, const size_t y_inc, cl_mem a_buffer,
+                                                  const size_t a_offset, const size_t a_ld, const size_t k,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZher2Deferred(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                                  const size_t n, const cl_double2* alphas, const cl_mem x_buffer,
+                                                  const size_t* x_offsets, const size_t x_inc, const cl_mem y_buffer,
+                                                  const size_t* y_offsets, const size_t y_inc, cl_mem a_buffer,
+                                                  const size_t a_offset, const size_t a_ld, const size_t k,
+                                                  cl_command_queue* queue, cl_event* event);
+
 // =================================================================================================
 // General matrix-matrix multiplication with temporary buffer from user (optional, for advanced users):
 // SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
@@ -1456,6 +2097,15 @@ CLBlastStatusCode PUBLIC_API CLBlastFillCache(const cl_device_id device);
 
 // =================================================================================================
 
+// Sets the accumulation mode of the level-1 reduction routines DOT, DOTU, DOTC, NRM2, ASUM and SUM
+// (including their batched versions) for all devices. The reproducible mode sums in a fixed order,
+// independent of the tuning parameters and the device, such that the results are bitwise
+// reproducible. The compensated mode uses Kahan-Neumaier summation for extra accuracy at nearly the
+// same speed as the default mode.
+CLBlastStatusCode PUBLIC_API CLBlastSetReductionMode(const CLBlastReductionMode mode);
+
+// =================================================================================================
+
 // Overrides tuning parameters for a specific device-precision-kernel combination. The next time
 // the target routine is called it will re-compile and use the new parameters from then on.
 CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device, const char* kernel_name,
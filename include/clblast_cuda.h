@@ -80,6 +80,7 @@ enum class StatusCode {
   kInvalidVectorZ = -2038,            // Vector Z is not a valid OpenCL buffer
   kInvalidIncrementZ = -2037,         // Increment of vector Z cannot be zero
   kInsufficientMemoryZ = -2036,       // Vector Z's OpenCL buffer is too small
+  kInvalidExpression = -2035,         // The run-time expression could not be parsed
 };
 
 // Matrix layout and transpose types
@@ -89,6 +90,7 @@ enum class Triangle { kUpper = 121, kLower = 122 };
 enum class Diagonal { kNonUnit = 131, kUnit = 132 };
 enum class Side { kLeft = 141, kRight = 142 };
 enum class KernelMode { kCrossCorrelation = 151, kConvolution = 152 };
+enum class ReductionMode { kDefault = 161, kReproducible = 162, kCompensated = 163 };
 
 // Precision scoped enum (values in bits)
 enum class Precision {
@@ -460,6 +462,63 @@ StatusCode Had(const size_t n, const T alpha, const CUdeviceptr x_buffer, const
                CUdeviceptr z_buffer, const size_t z_offset, const size_t z_inc, const CUcontext context,
                const CUdevice device);
 
+// Scaled vector plus scaled vector: SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n, const T alpha, const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta, CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const CUcontext context,
+                 const CUdevice device);
+
+// Scaled vector plus scaled vector into a third vector: SWAXPBY/DWAXPBY/CWAXPBY/ZWAXPBY/HWAXPBY
+template <typename T>
+StatusCode Waxpby(const size_t n, const T alpha, const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                  const T beta, const CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                  CUdeviceptr w_buffer, const size_t w_offset, const size_t w_inc, const CUcontext context,
+                  const CUdevice device);
+
+// Element-wise expression (non-BLAS function): SELEMENTWISE/DELEMENTWISE/CELEMENTWISE/ZELEMENTWISE/HELEMENTWISE
+template <typename T>
+StatusCode Elementwise(const std::string& expression, const size_t n, const T* scalars, const size_t num_scalars,
+                       const CUdeviceptr* buffers, const size_t* offsets, const size_t* incs, const size_t num_buffers,
+                       const CUcontext context, const CUdevice device);
+
+// Sum of a run-time expression (non-BLAS function): SMAPREDUCE/DMAPREDUCE/CMAPREDUCE/ZMAPREDUCE/HMAPREDUCE
+template <typename T>
+StatusCode MapReduce(const std::string& expression, const size_t n, const T* scalars, const size_t num_scalars,
+                     const CUdeviceptr* buffers, const size_t* offsets, const size_t* incs, const size_t num_buffers,
+                     CUdeviceptr result_buffer, const size_t result_offset, const CUcontext context,
+                     const CUdevice device);
+
+// AXPY with alpha in device memory (non-BLAS function): SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
+template <typename T>
+StatusCode AxpyDeviceScalars(const size_t n, const CUdeviceptr alpha_buffer, const size_t alpha_offset,
+                             const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                             CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const CUcontext context,
+                             const CUdevice device);
+
+// SCAL with alpha in device memory (non-BLAS function): SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
+template <typename T>
+StatusCode ScalDeviceScalars(const size_t n, const CUdeviceptr alpha_buffer, const size_t alpha_offset,
+                             CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const CUcontext context,
+                             const CUdevice device);
+
+// GEMV with alpha and beta in device memory (non-BLAS function): SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
+template <typename T>
+StatusCode GemvDeviceScalars(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                             const CUdeviceptr alpha_buffer, const size_t alpha_offset, const CUdeviceptr a_buffer,
+                             const size_t a_offset, const size_t a_ld, const CUdeviceptr x_buffer,
+                             const size_t x_offset, const size_t x_inc, const CUdeviceptr beta_buffer,
+                             const size_t beta_offset, CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                             const CUcontext context, const CUdevice device);
+
+// GEMM with alpha and beta in device memory (non-BLAS function): SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+template <typename T>
+StatusCode GemmDeviceScalars(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k, const CUdeviceptr alpha_buffer,
+                             const size_t alpha_offset, const CUdeviceptr a_buffer, const size_t a_offset,
+                             const size_t a_ld, const CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld,
+                             const CUdeviceptr beta_buffer, const size_t beta_offset, CUdeviceptr c_buffer,
+                             const size_t c_offset, const size_t c_ld, const CUcontext context, const CUdevice device);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 template <typename T>
 StatusCode Omatcopy(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n, const T alpha,
@@ -498,6 +557,109 @@ StatusCode AxpyBatched(const size_t n, const T* alphas, const CUdeviceptr x_buff
                        const size_t x_inc, CUdeviceptr y_buffer, const size_t* y_offsets, const size_t y_inc,
                        const size_t batch_count, const CUcontext context, const CUdevice device);
 
+// Batched version of ROT: SROTBATCHED/DROTBATCHED
+template <typename T>
+StatusCode RotBatched(const size_t n, CUdeviceptr x_buffer, const size_t* x_offsets, const size_t x_inc,
+                      CUdeviceptr y_buffer, const size_t* y_offsets, const size_t y_inc, const T* cos_values,
+                      const T* sin_values, const size_t batch_count, const CUcontext context, const CUdevice device);
+
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+template <typename T>
+StatusCode DotBatched(const size_t n, CUdeviceptr dot_buffer, const size_t* dot_offsets, const CUdeviceptr x_buffer,
+                      const size_t* x_offsets, const size_t x_inc, const CUdeviceptr y_buffer, const size_t* y_offsets,
+                      const size_t y_inc, const size_t batch_count, const CUcontext context, const CUdevice device);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+template <typename T>
+StatusCode DotStridedBatched(const size_t n, CUdeviceptr dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                             const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                             const size_t x_stride, const CUdeviceptr y_buffer, const size_t y_offset,
+                             const size_t y_inc, const size_t y_stride, const size_t batch_count,
+                             const CUcontext context, const CUdevice device);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+template <typename T>
+StatusCode Nrm2Batched(const size_t n, CUdeviceptr nrm2_buffer, const size_t* nrm2_offsets, const CUdeviceptr x_buffer,
+                       const size_t* x_offsets, const size_t x_inc, const size_t batch_count, const CUcontext context,
+                       const CUdevice device);
+
+// StridedBatched version of NRM2:
+// SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+template <typename T>
+StatusCode Nrm2StridedBatched(const size_t n, CUdeviceptr nrm2_buffer, const size_t nrm2_offset,
+                              const size_t nrm2_stride, const CUdeviceptr x_buffer, const size_t x_offset,
+                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// Batched version of ASUM: SASUMBATCHED/DASUMBATCHED/ScASUMBATCHED/DzASUMBATCHED/HASUMBATCHED
+template <typename T>
+StatusCode AsumBatched(const size_t n, CUdeviceptr asum_buffer, const size_t* asum_offsets, const CUdeviceptr x_buffer,
+                       const size_t* x_offsets, const size_t x_inc, const size_t batch_count, const CUcontext context,
+                       const CUdevice device);
+
+// StridedBatched version of ASUM:
+// SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+template <typename T>
+StatusCode AsumStridedBatched(const size_t n, CUdeviceptr asum_buffer, const size_t asum_offset,
+                              const size_t asum_stride, const CUdeviceptr x_buffer, const size_t x_offset,
+                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// Batched version of AMAX: iSAMAXBATCHED/iDAMAXBATCHED/iCAMAXBATCHED/iZAMAXBATCHED/iHAMAXBATCHED
+template <typename T>
+StatusCode AmaxBatched(const size_t n, CUdeviceptr imax_buffer, const size_t* imax_offsets, const CUdeviceptr x_buffer,
+                       const size_t* x_offsets, const size_t x_inc, const size_t batch_count, const CUcontext context,
+                       const CUdevice device);
+
+// StridedBatched version of AMAX:
+// iSAMAXSTRIDEDBATCHED/iDAMAXSTRIDEDBATCHED/iCAMAXSTRIDEDBATCHED/iZAMAXSTRIDEDBATCHED/iHAMAXSTRIDEDBATCHED
+template <typename T>
+StatusCode AmaxStridedBatched(const size_t n, CUdeviceptr imax_buffer, const size_t imax_offset,
+                              const size_t imax_stride, const CUdeviceptr x_buffer, const size_t x_offset,
+                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// Matrix version of AMAX (per column of op(A)): iSAMAXMATRIX/iDAMAXMATRIX/iCAMAXMATRIX/iZAMAXMATRIX/iHAMAXMATRIX
+template <typename T>
+StatusCode AmaxMatrix(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                      CUdeviceptr imax_buffer, const size_t imax_offset, const CUdeviceptr a_buffer,
+                      const size_t a_offset, const size_t a_ld, const CUcontext context, const CUdevice device);
+
+// Scaling of the rows or columns of a matrix by a vector: SDGMM/DDGMM/CDGMM/ZDGMM/HDGMM
+template <typename T>
+StatusCode Dgmm(const Layout layout, const Side side, const size_t m, const size_t n, const CUdeviceptr a_buffer,
+                const size_t a_offset, const size_t a_ld, const CUdeviceptr x_buffer, const size_t x_offset,
+                const size_t x_inc, CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld,
+                const CUcontext context, const CUdevice device);
+
+// StridedBatched version of DGMM: SDGMMSTRIDEDBATCHED/DDGMMSTRIDEDBATCHED/CDGMMSTRIDEDBATCHED/ZDGMMSTRIDEDBATCHED/
+// HDGMMSTRIDEDBATCHED
+template <typename T>
+StatusCode DgmmStridedBatched(const Layout layout, const Side side, const size_t m, const size_t n,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
+                              const size_t a_stride, const CUdeviceptr x_buffer, const size_t x_offset,
+                              const size_t x_inc, const size_t x_stride, CUdeviceptr c_buffer, const size_t c_offset,
+                              const size_t c_ld, const size_t c_stride, const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                       const T* alphas, const CUdeviceptr a_buffer, const size_t* a_offsets, const size_t a_ld,
+                       const CUdeviceptr x_buffer, const size_t* x_offsets, const size_t x_inc, const T* betas,
+                       CUdeviceptr y_buffer, const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
+                       const CUcontext context, const CUdevice device);
+
+// StridedBatched version of GEMV:
+// SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                              const T alpha, const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
+                              const size_t a_stride, const CUdeviceptr x_buffer, const size_t x_offset,
+                              const size_t x_inc, const size_t x_stride, const T beta, CUdeviceptr y_buffer,
+                              const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count, const CUcontext context, const CUdevice device);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 template <typename T>
 StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose, const size_t m,
@@ -517,6 +679,39 @@ StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose,
                               const size_t c_ld, const size_t c_stride, const size_t batch_count,
                               const CUcontext context, const CUdevice device);
 
+// Grouped version of GEMM, with different sizes per entry:
+// SGEMMGROUPED/DGEMMGROUPED/CGEMMGROUPED/ZGEMMGROUPED/HGEMMGROUPED
+template <typename T>
+StatusCode GemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose, const size_t* ms,
+                       const size_t* ns, const size_t* ks, const T* alphas, const CUdeviceptr a_buffer,
+                       const size_t* a_offsets, const size_t* a_lds, const CUdeviceptr b_buffer,
+                       const size_t* b_offsets, const size_t* b_lds, const T* betas, CUdeviceptr c_buffer,
+                       const size_t* c_offsets, const size_t* c_lds, const size_t group_count, const CUcontext context,
+                       const CUdevice device);
+
+// Deferred version of GER, applying k rank-1 updates at once: SGERDEFERRED/DGERDEFERRED/HGERDEFERRED
+template <typename T>
+StatusCode GerDeferred(const Layout layout, const size_t m, const size_t n, const T* alphas, const CUdeviceptr x_buffer,
+                       const size_t* x_offsets, const size_t x_inc, const CUdeviceptr y_buffer, const size_t* y_offsets,
+                       const size_t y_inc, CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
+                       const size_t k, const CUcontext context, const CUdevice device);
+
+// Deferred version of SYR2, applying k rank-2 updates at once: SSYR2DEFERRED/DSYR2DEFERRED/HSYR2DEFERRED
+template <typename T>
+StatusCode Syr2Deferred(const Layout layout, const Triangle triangle, const size_t n, const T* alphas,
+                        const CUdeviceptr x_buffer, const size_t* x_offsets, const size_t x_inc,
+                        const CUdeviceptr y_buffer, const size_t* y_offsets, const size_t y_inc, CUdeviceptr a_buffer,
+                        const size_t a_offset, const size_t a_ld, const size_t k, const CUcontext context,
+                        const CUdevice device);
+
+// Deferred version of HER2, applying k rank-2 updates at once: CHER2DEFERRED/ZHER2DEFERRED
+template <typename T>
+StatusCode Her2Deferred(const Layout layout, const Triangle triangle, const size_t n, const T* alphas,
+                        const CUdeviceptr x_buffer, const size_t* x_offsets, const size_t x_inc,
+                        const CUdeviceptr y_buffer, const size_t* y_offsets, const size_t y_inc, CUdeviceptr a_buffer,
+                        const size_t a_offset, const size_t a_ld, const size_t k, const CUcontext context,
+                        const CUdevice device);
+
 // =================================================================================================
 
 // Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
@@ -538,6 +733,15 @@ StatusCode PUBLIC_API FillCache(const CUdevice device);
 
 // =================================================================================================
 
+// Sets the accumulation mode of the level-1 reduction routines DOT, DOTU, DOTC, NRM2, ASUM and SUM
+// (including their batched versions) for all devices. The reproducible mode sums in a fixed order,
+// independent of the tuning parameters and the device, such that the results are bitwise
+// reproducible. The compensated mode uses Kahan-Neumaier summation for extra accuracy at nearly the
+// same speed as the default mode.
+StatusCode PUBLIC_API SetReductionMode(const ReductionMode mode);
+
+// =================================================================================================
+
 // Retrieves current tuning parameters for a specific device-precision-kernel combination
 StatusCode PUBLIC_API RetrieveParameters(const CUdevice device, const std::string& kernel_name,
                                          const Precision precision,
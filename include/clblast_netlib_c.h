@@ -532,6 +532,69 @@ void PUBLIC_API cblas_chad(const int n, const void* alpha, const void* x, const
 void PUBLIC_API cblas_zhad(const int n, const void* alpha, const void* x, const int x_inc, const void* y,
                            const int y_inc, const void* beta, void* z, const int z_inc);
 
+// Scaled vector plus scaled vector: SAXPBY/DAXPBY/CAXPBY/ZAXPBY
+void PUBLIC_API cblas_saxpby(const int n, const float alpha, const float* x, const int x_inc, const float beta,
+                             float* y, const int y_inc);
+void PUBLIC_API cblas_daxpby(const int n, const double alpha, const double* x, const int x_inc, const double beta,
+                             double* y, const int y_inc);
+void PUBLIC_API cblas_caxpby(const int n, const void* alpha, const void* x, const int x_inc, const void* beta, void* y,
+                             const int y_inc);
+void PUBLIC_API cblas_zaxpby(const int n, const void* alpha, const void* x, const int x_inc, const void* beta, void* y,
+                             const int y_inc);
+
+// Scaled vector plus scaled vector into a third vector: SWAXPBY/DWAXPBY/CWAXPBY/ZWAXPBY
+void PUBLIC_API cblas_swaxpby(const int n, const float alpha, const float* x, const int x_inc, const float beta,
+                              const float* y, const int y_inc, float* w, const int w_inc);
+void PUBLIC_API cblas_dwaxpby(const int n, const double alpha, const double* x, const int x_inc, const double beta,
+                              const double* y, const int y_inc, double* w, const int w_inc);
+void PUBLIC_API cblas_cwaxpby(const int n, const void* alpha, const void* x, const int x_inc, const void* beta,
+                              const void* y, const int y_inc, void* w, const int w_inc);
+void PUBLIC_API cblas_zwaxpby(const int n, const void* alpha, const void* x, const int x_inc, const void* beta,
+                              const void* y, const int y_inc, void* w, const int w_inc);
+
+// Batched version of GEMV (non-BLAS function): SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED
+void PUBLIC_API cblas_sgemvbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m,
+                                   const int n, const float* alphas, const float* a, const int* a_offsets,
+                                   const int a_ld, const float* x, const int* x_offsets, const int x_inc,
+                                   const float* betas, float* y, const int* y_offsets, const int y_inc,
+                                   const int batch_count);
+void PUBLIC_API cblas_dgemvbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m,
+                                   const int n, const double* alphas, const double* a, const int* a_offsets,
+                                   const int a_ld, const double* x, const int* x_offsets, const int x_inc,
+                                   const double* betas, double* y, const int* y_offsets, const int y_inc,
+                                   const int batch_count);
+void PUBLIC_API cblas_cgemvbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m,
+                                   const int n, const void* alphas, const void* a, const int* a_offsets, const int a_ld,
+                                   const void* x, const int* x_offsets, const int x_inc, const void* betas, void* y,
+                                   const int* y_offsets, const int y_inc, const int batch_count);
+void PUBLIC_API cblas_zgemvbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m,
+                                   const int n, const void* alphas, const void* a, const int* a_offsets, const int a_ld,
+                                   const void* x, const int* x_offsets, const int x_inc, const void* betas, void* y,
+                                   const int* y_offsets, const int y_inc, const int batch_count);
+
+// StridedBatched version of GEMV (non-BLAS function):
+// SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED
+void PUBLIC_API cblas_sgemvstridedbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m,
+                                          const int n, const float alpha, const float* a, const int a_ld,
+                                          const int a_stride, const float* x, const int x_inc, const int x_stride,
+                                          const float beta, float* y, const int y_inc, const int y_stride,
+                                          const int batch_count);
+void PUBLIC_API cblas_dgemvstridedbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m,
+                                          const int n, const double alpha, const double* a, const int a_ld,
+                                          const int a_stride, const double* x, const int x_inc, const int x_stride,
+                                          const double beta, double* y, const int y_inc, const int y_stride,
+                                          const int batch_count);
+void PUBLIC_API cblas_cgemvstridedbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m,
+                                          const int n, const void* alpha, const void* a, const int a_ld,
+                                          const int a_stride, const void* x, const int x_inc, const int x_stride,
+                                          const void* beta, void* y, const int y_inc, const int y_stride,
+                                          const int batch_count);
+void PUBLIC_API cblas_zgemvstridedbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m,
+                                          const int n, const void* alpha, const void* a, const int a_ld,
+                                          const int a_stride, const void* x, const int x_inc, const int x_stride,
+                                          const void* beta, void* y, const int y_inc, const int y_stride,
+                                          const int batch_count);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 void PUBLIC_API cblas_somatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m,
                                 const int n, const float alpha, const float* a, const int a_ld, float* b,
@@ -13,6 +13,7 @@
 
 #include "cache.hpp"
 #include "database/database_structure.hpp"
+#include "routines/common.hpp"
 #include "routines/routines.hpp"
 #include "utilities/backend.hpp"
 #include "utilities/clblast_exceptions.hpp"
@@ -64,6 +65,7 @@ void FillCacheForPrecision(Queue& queue) {
 
     // Runs all the non-BLAS set-up functions
     Xomatcopy<Type>(queue, nullptr);
+    Xdgmm<Type>(queue, nullptr);
 
   } catch (const RuntimeErrorCode& e) {
     if (e.status() != StatusCode::kNoDoublePrecision && e.status() != StatusCode::kNoHalfPrecision) {
@@ -79,6 +81,10 @@ void FillCacheForPrecision(Queue& queue) {
     FillCacheForPrecision<Complex>(queue);
 
     // Runs all the level 1 set-up functions that don't support all precisions
+    Xrotg<Real>(queue, nullptr);
+    Xrotmg<Real>(queue, nullptr);
+    Xrot<Real>(queue, nullptr);
+    Xrotm<Real>(queue, nullptr);
     Xdotu<Complex>(queue, nullptr);
     Xdotc<Complex>(queue, nullptr);
 
@@ -136,6 +142,18 @@ StatusCode FillCache(const RawDeviceID device) {
 
 // =================================================================================================
 
+// Sets the accumulation mode of the level-1 reduction routines
+StatusCode SetReductionMode(const ReductionMode mode) {
+  if (mode != ReductionMode::kDefault && mode != ReductionMode::kReproducible &&
+      mode != ReductionMode::kCompensated) {
+    return StatusCode::kNotImplemented;
+  }
+  SetCurrentReductionMode(mode);
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
 // Retrieves the current tuning parameters for this device-precision-kernel combination
 StatusCode RetrieveParameters(const RawDeviceID device, const std::string& kernel_name, const Precision precision,
                               std::unordered_map<std::string, size_t>& parameters) {
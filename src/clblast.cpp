@@ -30,9 +30,18 @@ namespace clblast {
 
 // Generate givens plane rotation: SROTG/DROTG
 template <typename T>
-StatusCode Rotg(cl_mem, const size_t, cl_mem, const size_t, cl_mem, const size_t, cl_mem, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotg(cl_mem sa_buffer, const size_t sa_offset, cl_mem sb_buffer, const size_t sb_offset, cl_mem sc_buffer,
+                const size_t sc_offset, cl_mem ss_buffer, const size_t ss_offset, cl_command_queue* queue,
+                cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotg<T>(queue_cpp, event);
+    routine.DoRotg(Buffer<T>(sa_buffer), sa_offset, Buffer<T>(sb_buffer), sb_offset, Buffer<T>(sc_buffer), sc_offset,
+                   Buffer<T>(ss_buffer), ss_offset);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
 }
 template StatusCode PUBLIC_API Rotg<float>(cl_mem, const size_t, cl_mem, const size_t, cl_mem, const size_t, cl_mem,
                                            const size_t, cl_command_queue*, cl_event*);
@@ -41,9 +50,18 @@ template StatusCode PUBLIC_API Rotg<double>(cl_mem, const size_t, cl_mem, const
 
 // Generate modified givens plane rotation: SROTMG/DROTMG
 template <typename T>
-StatusCode Rotmg(cl_mem, const size_t, cl_mem, const size_t, cl_mem, const size_t, const cl_mem, const size_t, cl_mem,
-                 const size_t, cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotmg(cl_mem sd1_buffer, const size_t sd1_offset, cl_mem sd2_buffer, const size_t sd2_offset,
+                 cl_mem sx1_buffer, const size_t sx1_offset, const cl_mem sy1_buffer, const size_t sy1_offset,
+                 cl_mem sparam_buffer, const size_t sparam_offset, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotmg<T>(queue_cpp, event);
+    routine.DoRotmg(Buffer<T>(sd1_buffer), sd1_offset, Buffer<T>(sd2_buffer), sd2_offset, Buffer<T>(sx1_buffer),
+                    sx1_offset, Buffer<T>(sy1_buffer), sy1_offset, Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
 }
 template StatusCode PUBLIC_API Rotmg<float>(cl_mem, const size_t, cl_mem, const size_t, cl_mem, const size_t,
                                             const cl_mem, const size_t, cl_mem, const size_t, cl_command_queue*,
@@ -54,9 +72,17 @@ template StatusCode PUBLIC_API Rotmg<double>(cl_mem, const size_t, cl_mem, const
 
 // Apply givens plane rotation: SROT/DROT
 template <typename T>
-StatusCode Rot(const size_t, cl_mem, const size_t, const size_t, cl_mem, const size_t, const size_t, const T, const T,
-               cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rot(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer,
+               const size_t y_offset, const size_t y_inc, const T cos, const T sin, cl_command_queue* queue,
+               cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrot<T>(queue_cpp, event);
+    routine.DoRot(n, Buffer<T>(x_buffer), x_offset, x_inc, Buffer<T>(y_buffer), y_offset, y_inc, cos, sin);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
 }
 template StatusCode PUBLIC_API Rot<float>(const size_t, cl_mem, const size_t, const size_t, cl_mem, const size_t,
                                           const size_t, const float, const float, cl_command_queue*, cl_event*);
@@ -65,9 +91,18 @@ template StatusCode PUBLIC_API Rot<double>(const size_t, cl_mem, const size_t, c
 
 // Apply modified givens plane rotation: SROTM/DROTM
 template <typename T>
-StatusCode Rotm(const size_t, cl_mem, const size_t, const size_t, cl_mem, const size_t, const size_t, cl_mem,
-                const size_t, cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotm(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer,
+                const size_t y_offset, const size_t y_inc, cl_mem sparam_buffer, const size_t sparam_offset,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotm<T>(queue_cpp, event);
+    routine.DoRotm(n, Buffer<T>(x_buffer), x_offset, x_inc, Buffer<T>(y_buffer), y_offset, y_inc,
+                   Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
 }
 template StatusCode PUBLIC_API Rotm<float>(const size_t, cl_mem, const size_t, const size_t, cl_mem, const size_t,
                                            const size_t, cl_mem, const size_t, cl_command_queue*, cl_event*);
@@ -759,9 +794,18 @@ template StatusCode PUBLIC_API Trsv<double2>(const Layout, const Triangle, const
 
 // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
 template <typename T>
-StatusCode Tbsv(const Layout, const Triangle, const Transpose, const Diagonal, const size_t, const size_t, const cl_mem,
-                const size_t, const size_t, cl_mem, const size_t, const size_t, cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Tbsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xtbsv<T>(queue_cpp, event);
+    routine.DoTbsv(layout, triangle, a_transpose, diagonal, n, k, Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
 }
 template StatusCode PUBLIC_API Tbsv<float>(const Layout, const Triangle, const Transpose, const Diagonal, const size_t,
                                            const size_t, const cl_mem, const size_t, const size_t, cl_mem, const size_t,
@@ -778,9 +822,18 @@ template StatusCode PUBLIC_API Tbsv<double2>(const Layout, const Triangle, const
 
 // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
 template <typename T>
-StatusCode Tpsv(const Layout, const Triangle, const Transpose, const Diagonal, const size_t, const cl_mem, const size_t,
-                cl_mem, const size_t, const size_t, cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Tpsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset,
+                const size_t x_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xtpsv<T>(queue_cpp, event);
+    routine.DoTpsv(layout, triangle, a_transpose, diagonal, n, Buffer<T>(ap_buffer), ap_offset, Buffer<T>(x_buffer),
+                   x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
 }
 template StatusCode PUBLIC_API Tpsv<float>(const Layout, const Triangle, const Transpose, const Diagonal, const size_t,
                                            const cl_mem, const size_t, cl_mem, const size_t, const size_t,
@@ -1388,6 +1441,296 @@ template StatusCode PUBLIC_API Had<half>(const size_t, const half, const cl_mem,
                                          const cl_mem, const size_t, const size_t, const half, cl_mem, const size_t,
                                          const size_t, cl_command_queue*, cl_event*);
 
+// Scaled vector plus scaled vector: SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n, const T alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_command_queue* queue,
+                 cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpby<T>(queue_cpp, event);
+    routine.DoAxpby(n, alpha, Buffer<T>(x_buffer), x_offset, x_inc, beta, Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API Axpby<float>(const size_t, const float, const cl_mem, const size_t, const size_t,
+                                            const float, cl_mem, const size_t, const size_t, cl_command_queue*,
+                                            cl_event*);
+template StatusCode PUBLIC_API Axpby<double>(const size_t, const double, const cl_mem, const size_t, const size_t,
+                                             const double, cl_mem, const size_t, const size_t, cl_command_queue*,
+                                             cl_event*);
+template StatusCode PUBLIC_API Axpby<float2>(const size_t, const float2, const cl_mem, const size_t, const size_t,
+                                             const float2, cl_mem, const size_t, const size_t, cl_command_queue*,
+                                             cl_event*);
+template StatusCode PUBLIC_API Axpby<double2>(const size_t, const double2, const cl_mem, const size_t, const size_t,
+                                              const double2, cl_mem, const size_t, const size_t, cl_command_queue*,
+                                              cl_event*);
+template StatusCode PUBLIC_API Axpby<half>(const size_t, const half, const cl_mem, const size_t, const size_t,
+                                           const half, cl_mem, const size_t, const size_t, cl_command_queue*,
+                                           cl_event*);
+
+// Scaled vector plus scaled vector into a third vector: SWAXPBY/DWAXPBY/CWAXPBY/ZWAXPBY/HWAXPBY
+template <typename T>
+StatusCode Waxpby(const size_t n, const T alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                  const T beta, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem w_buffer,
+                  const size_t w_offset, const size_t w_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xwaxpby<T>(queue_cpp, event);
+    routine.DoWaxpby(n, alpha, Buffer<T>(x_buffer), x_offset, x_inc, beta, Buffer<T>(y_buffer), y_offset, y_inc,
+                     Buffer<T>(w_buffer), w_offset, w_inc);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API Waxpby<float>(const size_t, const float, const cl_mem, const size_t, const size_t,
+                                             const float, const cl_mem, const size_t, const size_t, cl_mem,
+                                             const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Waxpby<double>(const size_t, const double, const cl_mem, const size_t, const size_t,
+                                              const double, const cl_mem, const size_t, const size_t, cl_mem,
+                                              const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Waxpby<float2>(const size_t, const float2, const cl_mem, const size_t, const size_t,
+                                              const float2, const cl_mem, const size_t, const size_t, cl_mem,
+                                              const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Waxpby<double2>(const size_t, const double2, const cl_mem, const size_t, const size_t,
+                                               const double2, const cl_mem, const size_t, const size_t, cl_mem,
+                                               const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Waxpby<half>(const size_t, const half, const cl_mem, const size_t, const size_t,
+                                            const half, const cl_mem, const size_t, const size_t, cl_mem, const size_t,
+                                            const size_t, cl_command_queue*, cl_event*);
+
+// Element-wise expression (non-BLAS function): SELEMENTWISE/DELEMENTWISE/CELEMENTWISE/ZELEMENTWISE/HELEMENTWISE
+template <typename T>
+StatusCode Elementwise(const std::string& expression, const size_t n, const T* scalars, const size_t num_scalars,
+                       const cl_mem* buffers, const size_t* offsets, const size_t* incs, const size_t num_buffers,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xelementwise<T>(queue_cpp, event, expression);
+    auto scalars_cpp = std::vector<T>();
+    for (auto i = size_t{0}; i < num_scalars; ++i) {
+      scalars_cpp.push_back(scalars[i]);
+    }
+    auto buffers_cpp = std::vector<Buffer<T>>();
+    auto offsets_cpp = std::vector<size_t>();
+    auto incs_cpp = std::vector<size_t>();
+    for (auto i = size_t{0}; i < num_buffers; ++i) {
+      buffers_cpp.push_back(Buffer<T>(buffers[i]));
+      offsets_cpp.push_back(offsets[i]);
+      incs_cpp.push_back(incs[i]);
+    }
+    routine.DoElementwise(n, scalars_cpp, buffers_cpp, offsets_cpp, incs_cpp);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API Elementwise<float>(const std::string&, const size_t, const float*, const size_t,
+                                                  const cl_mem*, const size_t*, const size_t*, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Elementwise<double>(const std::string&, const size_t, const double*, const size_t,
+                                                   const cl_mem*, const size_t*, const size_t*, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Elementwise<float2>(const std::string&, const size_t, const float2*, const size_t,
+                                                   const cl_mem*, const size_t*, const size_t*, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Elementwise<double2>(const std::string&, const size_t, const double2*, const size_t,
+                                                    const cl_mem*, const size_t*, const size_t*, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Elementwise<half>(const std::string&, const size_t, const half*, const size_t,
+                                                 const cl_mem*, const size_t*, const size_t*, const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// Sum of a run-time expression (non-BLAS function): SMAPREDUCE/DMAPREDUCE/CMAPREDUCE/ZMAPREDUCE/HMAPREDUCE
+template <typename T>
+StatusCode MapReduce(const std::string& expression, const size_t n, const T* scalars, const size_t num_scalars,
+                     const cl_mem* buffers, const size_t* offsets, const size_t* incs, const size_t num_buffers,
+                     cl_mem result_buffer, const size_t result_offset, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xmapreduce<T>(queue_cpp, event, expression);
+    auto scalars_cpp = std::vector<T>();
+    for (auto i = size_t{0}; i < num_scalars; ++i) {
+      scalars_cpp.push_back(scalars[i]);
+    }
+    auto buffers_cpp = std::vector<Buffer<T>>();
+    auto offsets_cpp = std::vector<size_t>();
+    auto incs_cpp = std::vector<size_t>();
+    for (auto i = size_t{0}; i < num_buffers; ++i) {
+      buffers_cpp.push_back(Buffer<T>(buffers[i]));
+      offsets_cpp.push_back(offsets[i]);
+      incs_cpp.push_back(incs[i]);
+    }
+    routine.DoMapReduce(n, scalars_cpp, buffers_cpp, offsets_cpp, incs_cpp, Buffer<T>(result_buffer), result_offset);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API MapReduce<float>(const std::string&, const size_t, const float*, const size_t,
+                                                const cl_mem*, const size_t*, const size_t*, const size_t, cl_mem,
+                                                const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API MapReduce<double>(const std::string&, const size_t, const double*, const size_t,
+                                                 const cl_mem*, const size_t*, const size_t*, const size_t, cl_mem,
+                                                 const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API MapReduce<float2>(const std::string&, const size_t, const float2*, const size_t,
+                                                 const cl_mem*, const size_t*, const size_t*, const size_t, cl_mem,
+                                                 const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API MapReduce<double2>(const std::string&, const size_t, const double2*, const size_t,
+                                                  const cl_mem*, const size_t*, const size_t*, const size_t, cl_mem,
+                                                  const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API MapReduce<half>(const std::string&, const size_t, const half*, const size_t,
+                                               const cl_mem*, const size_t*, const size_t*, const size_t, cl_mem,
+                                               const size_t, cl_command_queue*, cl_event*);
+
+// AXPY with alpha in device memory (non-BLAS function): SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
+template <typename T>
+StatusCode AxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer,
+                             const size_t y_offset, const size_t y_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpydevicescalars<T>(queue_cpp, event);
+    routine.DoAxpyDeviceScalars(n, Buffer<T>(alpha_buffer), alpha_offset, Buffer<T>(x_buffer), x_offset, x_inc,
+                                Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API AxpyDeviceScalars<float>(const size_t, const cl_mem, const size_t, const cl_mem,
+                                                        const size_t, const size_t, cl_mem, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDeviceScalars<double>(const size_t, const cl_mem, const size_t, const cl_mem,
+                                                         const size_t, const size_t, cl_mem, const size_t, const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDeviceScalars<float2>(const size_t, const cl_mem, const size_t, const cl_mem,
+                                                         const size_t, const size_t, cl_mem, const size_t, const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDeviceScalars<double2>(const size_t, const cl_mem, const size_t, const cl_mem,
+                                                          const size_t, const size_t, cl_mem, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDeviceScalars<half>(const size_t, const cl_mem, const size_t, const cl_mem,
+                                                       const size_t, const size_t, cl_mem, const size_t, const size_t,
+                                                       cl_command_queue*, cl_event*);
+
+// SCAL with alpha in device memory (non-BLAS function): SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
+template <typename T>
+StatusCode ScalDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset, cl_mem x_buffer,
+                             const size_t x_offset, const size_t x_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xscaldevicescalars<T>(queue_cpp, event);
+    routine.DoScalDeviceScalars(n, Buffer<T>(alpha_buffer), alpha_offset, Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API ScalDeviceScalars<float>(const size_t, const cl_mem, const size_t, cl_mem, const size_t,
+                                                        const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDeviceScalars<double>(const size_t, const cl_mem, const size_t, cl_mem, const size_t,
+                                                         const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDeviceScalars<float2>(const size_t, const cl_mem, const size_t, cl_mem, const size_t,
+                                                         const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDeviceScalars<double2>(const size_t, const cl_mem, const size_t, cl_mem,
+                                                          const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDeviceScalars<half>(const size_t, const cl_mem, const size_t, cl_mem, const size_t,
+                                                       const size_t, cl_command_queue*, cl_event*);
+
+// GEMV with alpha and beta in device memory (non-BLAS function): SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
+template <typename T>
+StatusCode GemvDeviceScalars(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                             const cl_mem alpha_buffer, const size_t alpha_offset, const cl_mem a_buffer,
+                             const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                             const size_t x_inc, const cl_mem beta_buffer, const size_t beta_offset, cl_mem y_buffer,
+                             const size_t y_offset, const size_t y_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemvdevicescalars<T>(queue_cpp, event);
+    routine.DoGemvDeviceScalars(layout, a_transpose, m, n, Buffer<T>(alpha_buffer), alpha_offset, Buffer<T>(a_buffer),
+                                a_offset, a_ld, Buffer<T>(x_buffer), x_offset, x_inc, Buffer<T>(beta_buffer),
+                                beta_offset, Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API GemvDeviceScalars<float>(const Layout, const Transpose, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const cl_mem, const size_t,
+                                                        const size_t, const cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t, cl_mem, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDeviceScalars<double>(const Layout, const Transpose, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const cl_mem, const size_t,
+                                                         const size_t, const cl_mem, const size_t, const size_t,
+                                                         const cl_mem, const size_t, cl_mem, const size_t, const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDeviceScalars<float2>(const Layout, const Transpose, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const cl_mem, const size_t,
+                                                         const size_t, const cl_mem, const size_t, const size_t,
+                                                         const cl_mem, const size_t, cl_mem, const size_t, const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDeviceScalars<double2>(const Layout, const Transpose, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const cl_mem, const size_t,
+                                                          const size_t, const cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, cl_mem, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDeviceScalars<half>(const Layout, const Transpose, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const cl_mem, const size_t,
+                                                       const size_t, const cl_mem, const size_t, const size_t,
+                                                       const cl_mem, const size_t, cl_mem, const size_t, const size_t,
+                                                       cl_command_queue*, cl_event*);
+
+// GEMM with alpha and beta in device memory (non-BLAS function): SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+template <typename T>
+StatusCode GemmDeviceScalars(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k, const cl_mem alpha_buffer,
+                             const size_t alpha_offset, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_mem beta_buffer,
+                             const size_t beta_offset, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                             cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemmdevicescalars<T>(queue_cpp, event);
+    routine.DoGemmDeviceScalars(layout, a_transpose, b_transpose, m, n, k, Buffer<T>(alpha_buffer), alpha_offset,
+                                Buffer<T>(a_buffer), a_offset, a_ld, Buffer<T>(b_buffer), b_offset, b_ld,
+                                Buffer<T>(beta_buffer), beta_offset, Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API GemmDeviceScalars<float>(const Layout, const Transpose, const Transpose, const size_t,
+                                                        const size_t, const size_t, const cl_mem, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const cl_mem,
+                                                        const size_t, const size_t, const cl_mem, const size_t, cl_mem,
+                                                        const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDeviceScalars<double>(const Layout, const Transpose, const Transpose, const size_t,
+                                                         const size_t, const size_t, const cl_mem, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const cl_mem,
+                                                         const size_t, const size_t, const cl_mem, const size_t, cl_mem,
+                                                         const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDeviceScalars<float2>(const Layout, const Transpose, const Transpose, const size_t,
+                                                         const size_t, const size_t, const cl_mem, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const cl_mem,
+                                                         const size_t, const size_t, const cl_mem, const size_t, cl_mem,
+                                                         const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDeviceScalars<double2>(const Layout, const Transpose, const Transpose, const size_t,
+                                                          const size_t, const size_t, const cl_mem, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const cl_mem,
+                                                          const size_t, const size_t, const cl_mem, const size_t,
+                                                          cl_mem, const size_t, const size_t, cl_command_queue*,
+                                                          cl_event*);
+template StatusCode PUBLIC_API GemmDeviceScalars<half>(const Layout, const Transpose, const Transpose, const size_t,
+                                                       const size_t, const size_t, const cl_mem, const size_t,
+                                                       const cl_mem, const size_t, const size_t, const cl_mem,
+                                                       const size_t, const size_t, const cl_mem, const size_t, cl_mem,
+                                                       const size_t, const size_t, cl_command_queue*, cl_event*);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 template <typename T>
 StatusCode Omatcopy(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n, const T alpha,
@@ -1569,6 +1912,502 @@ template StatusCode PUBLIC_API AxpyBatched<half>(const size_t, const half*, cons
                                                  cl_mem, const size_t*, const size_t, const size_t, cl_command_queue*,
                                                  cl_event*);
 
+// Batched version of ROT: SROTBATCHED/DROTBATCHED
+template <typename T>
+StatusCode RotBatched(const size_t n, cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
+                      const size_t* y_offsets, const size_t y_inc, const T* cos_values, const T* sin_values,
+                      const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XrotBatched<T>(queue_cpp, event);
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    auto cos_values_cpp = std::vector<T>();
+    auto sin_values_cpp = std::vector<T>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+      cos_values_cpp.push_back(cos_values[batch]);
+      sin_values_cpp.push_back(sin_values[batch]);
+    }
+    routine.DoRotBatched(n, Buffer<T>(x_buffer), x_offsets_cpp, x_inc, Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                         cos_values_cpp, sin_values_cpp, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API RotBatched<float>(const size_t, cl_mem, const size_t*, const size_t, cl_mem,
+                                                 const size_t*, const size_t, const float*, const float*, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API RotBatched<double>(const size_t, cl_mem, const size_t*, const size_t, cl_mem,
+                                                  const size_t*, const size_t, const double*, const double*,
+                                                  const size_t, cl_command_queue*, cl_event*);
+
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+template <typename T>
+StatusCode DotBatched(const size_t n, cl_mem dot_buffer, const size_t* dot_offsets, const cl_mem x_buffer,
+                      const size_t* x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t* y_offsets,
+                      const size_t y_inc, const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XdotBatched<T>(queue_cpp, event);
+    auto dot_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      dot_offsets_cpp.push_back(dot_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoDotBatched(n, Buffer<T>(dot_buffer), dot_offsets_cpp, Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                         Buffer<T>(y_buffer), y_offsets_cpp, y_inc, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API DotBatched<float>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                 const size_t, const cl_mem, const size_t*, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotBatched<double>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                  const size_t, const cl_mem, const size_t*, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotBatched<half>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                const size_t, const cl_mem, const size_t*, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+template <typename T>
+StatusCode DotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                             const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XdotBatched<T>(queue_cpp, event);
+    routine.DoDotStridedBatched(n, Buffer<T>(dot_buffer), dot_offset, dot_stride, Buffer<T>(x_buffer), x_offset, x_inc,
+                                x_stride, Buffer<T>(y_buffer), y_offset, y_inc, y_stride, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API DotStridedBatched<float>(const size_t, cl_mem, const size_t, const size_t, const cl_mem,
+                                                        const size_t, const size_t, const size_t, const cl_mem,
+                                                        const size_t, const size_t, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotStridedBatched<double>(const size_t, cl_mem, const size_t, const size_t, const cl_mem,
+                                                         const size_t, const size_t, const size_t, const cl_mem,
+                                                         const size_t, const size_t, const size_t, const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotStridedBatched<half>(const size_t, cl_mem, const size_t, const size_t, const cl_mem,
+                                                       const size_t, const size_t, const size_t, const cl_mem,
+                                                       const size_t, const size_t, const size_t, const size_t,
+                                                       cl_command_queue*, cl_event*);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+template <typename T>
+StatusCode Nrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets, const cl_mem x_buffer,
+                       const size_t* x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue* queue,
+                       cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xnrm2Batched<T>(queue_cpp, event);
+    auto nrm2_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      nrm2_offsets_cpp.push_back(nrm2_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+    }
+    routine.DoNrm2Batched(n, Buffer<T>(nrm2_buffer), nrm2_offsets_cpp, Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API Nrm2Batched<float>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                  const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<double>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                   const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<float2>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                   const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<double2>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                    const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<half>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                 const size_t, const size_t, cl_command_queue*, cl_event*);
+
+// StridedBatched version of NRM2:
+// SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+template <typename T>
+StatusCode Nrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xnrm2Batched<T>(queue_cpp, event);
+    routine.DoNrm2StridedBatched(n, Buffer<T>(nrm2_buffer), nrm2_offset, nrm2_stride, Buffer<T>(x_buffer), x_offset,
+                                 x_inc, x_stride, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API Nrm2StridedBatched<float>(const size_t, cl_mem, const size_t, const size_t, const cl_mem,
+                                                         const size_t, const size_t, const size_t, const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<double>(const size_t, cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<float2>(const size_t, cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<double2>(const size_t, cl_mem, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<half>(const size_t, cl_mem, const size_t, const size_t, const cl_mem,
+                                                        const size_t, const size_t, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Batched version of ASUM: SASUMBATCHED/DASUMBATCHED/ScASUMBATCHED/DzASUMBATCHED/HASUMBATCHED
+template <typename T>
+StatusCode AsumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets, const cl_mem x_buffer,
+                       const size_t* x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue* queue,
+                       cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XasumBatched<T>(queue_cpp, event);
+    auto asum_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      asum_offsets_cpp.push_back(asum_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+    }
+    routine.DoAsumBatched(n, Buffer<T>(asum_buffer), asum_offsets_cpp, Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API AsumBatched<float>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                  const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumBatched<double>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                   const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumBatched<float2>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                   const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumBatched<double2>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                    const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumBatched<half>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                 const size_t, const size_t, cl_command_queue*, cl_event*);
+
+// StridedBatched version of ASUM:
+// SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+template <typename T>
+StatusCode AsumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XasumBatched<T>(queue_cpp, event);
+    routine.DoAsumStridedBatched(n, Buffer<T>(asum_buffer), asum_offset, asum_stride, Buffer<T>(x_buffer), x_offset,
+                                 x_inc, x_stride, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API AsumStridedBatched<float>(const size_t, cl_mem, const size_t, const size_t, const cl_mem,
+                                                         const size_t, const size_t, const size_t, const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<double>(const size_t, cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<float2>(const size_t, cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<double2>(const size_t, cl_mem, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<half>(const size_t, cl_mem, const size_t, const size_t, const cl_mem,
+                                                        const size_t, const size_t, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Batched version of AMAX: iSAMAXBATCHED/iDAMAXBATCHED/iCAMAXBATCHED/iZAMAXBATCHED/iHAMAXBATCHED
+template <typename T>
+StatusCode AmaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets, const cl_mem x_buffer,
+                       const size_t* x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue* queue,
+                       cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XamaxBatched<T>(queue_cpp, event);
+    auto imax_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      imax_offsets_cpp.push_back(imax_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+    }
+    routine.DoAmaxBatched(n, Buffer<unsigned int>(imax_buffer), imax_offsets_cpp, Buffer<T>(x_buffer), x_offsets_cpp,
+                          x_inc, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API AmaxBatched<float>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                  const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxBatched<double>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                   const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxBatched<float2>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                   const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxBatched<double2>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                    const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxBatched<half>(const size_t, cl_mem, const size_t*, const cl_mem, const size_t*,
+                                                 const size_t, const size_t, cl_command_queue*, cl_event*);
+
+// StridedBatched version of AMAX:
+// iSAMAXSTRIDEDBATCHED/iDAMAXSTRIDEDBATCHED/iCAMAXSTRIDEDBATCHED/iZAMAXSTRIDEDBATCHED/iHAMAXSTRIDEDBATCHED
+template <typename T>
+StatusCode AmaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset, const size_t imax_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XamaxBatched<T>(queue_cpp, event);
+    routine.DoAmaxStridedBatched(n, Buffer<unsigned int>(imax_buffer), imax_offset, imax_stride, Buffer<T>(x_buffer),
+                                 x_offset, x_inc, x_stride, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API AmaxStridedBatched<float>(const size_t, cl_mem, const size_t, const size_t, const cl_mem,
+                                                         const size_t, const size_t, const size_t, const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxStridedBatched<double>(const size_t, cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxStridedBatched<float2>(const size_t, cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxStridedBatched<double2>(const size_t, cl_mem, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxStridedBatched<half>(const size_t, cl_mem, const size_t, const size_t, const cl_mem,
+                                                        const size_t, const size_t, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Matrix version of AMAX (per column of op(A)): iSAMAXMATRIX/iDAMAXMATRIX/iCAMAXMATRIX/iZAMAXMATRIX/iHAMAXMATRIX
+template <typename T>
+StatusCode AmaxMatrix(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                      cl_mem imax_buffer, const size_t imax_offset, const cl_mem a_buffer, const size_t a_offset,
+                      const size_t a_ld, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XamaxMatrix<T>(queue_cpp, event);
+    routine.DoAmaxMatrix(layout, a_transpose, m, n, Buffer<unsigned int>(imax_buffer), imax_offset, Buffer<T>(a_buffer),
+                         a_offset, a_ld);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API AmaxMatrix<float>(const Layout, const Transpose, const size_t, const size_t, cl_mem,
+                                                 const size_t, const cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxMatrix<double>(const Layout, const Transpose, const size_t, const size_t, cl_mem,
+                                                  const size_t, const cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxMatrix<float2>(const Layout, const Transpose, const size_t, const size_t, cl_mem,
+                                                  const size_t, const cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxMatrix<double2>(const Layout, const Transpose, const size_t, const size_t, cl_mem,
+                                                   const size_t, const cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AmaxMatrix<half>(const Layout, const Transpose, const size_t, const size_t, cl_mem,
+                                                const size_t, const cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// Scaling of the rows or columns of a matrix by a vector: SDGMM/DDGMM/CDGMM/ZDGMM/HDGMM
+template <typename T>
+StatusCode Dgmm(const Layout layout, const Side side, const size_t m, const size_t n, const cl_mem a_buffer,
+                const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                const size_t x_inc, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, cl_command_queue* queue,
+                cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xdgmm<T>(queue_cpp, event);
+    routine.DoDgmm(layout, side, m, n, Buffer<T>(a_buffer), a_offset, a_ld, Buffer<T>(x_buffer), x_offset, x_inc,
+                   Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API Dgmm<float>(const Layout, const Side, const size_t, const size_t, const cl_mem,
+                                           const size_t, const size_t, const cl_mem, const size_t, const size_t, cl_mem,
+                                           const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dgmm<double>(const Layout, const Side, const size_t, const size_t, const cl_mem,
+                                            const size_t, const size_t, const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dgmm<float2>(const Layout, const Side, const size_t, const size_t, const cl_mem,
+                                            const size_t, const size_t, const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dgmm<double2>(const Layout, const Side, const size_t, const size_t, const cl_mem,
+                                             const size_t, const size_t, const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dgmm<half>(const Layout, const Side, const size_t, const size_t, const cl_mem,
+                                          const size_t, const size_t, const cl_mem, const size_t, const size_t, cl_mem,
+                                          const size_t, const size_t, cl_command_queue*, cl_event*);
+
+// StridedBatched version of DGMM: SDGMMSTRIDEDBATCHED/DDGMMSTRIDEDBATCHED/CDGMMSTRIDEDBATCHED/ZDGMMSTRIDEDBATCHED/
+// HDGMMSTRIDEDBATCHED
+template <typename T>
+StatusCode DgmmStridedBatched(const Layout layout, const Side side, const size_t m, const size_t n,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xdgmm<T>(queue_cpp, event);
+    routine.DoDgmmStridedBatched(layout, side, m, n, Buffer<T>(a_buffer), a_offset, a_ld, a_stride, Buffer<T>(x_buffer),
+                                 x_offset, x_inc, x_stride, Buffer<T>(c_buffer), c_offset, c_ld, c_stride, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API DgmmStridedBatched<float>(const Layout, const Side, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t, cl_mem,
+                                                         const size_t, const size_t, const size_t, const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DgmmStridedBatched<double>(const Layout, const Side, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DgmmStridedBatched<float2>(const Layout, const Side, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DgmmStridedBatched<double2>(const Layout, const Side, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DgmmStridedBatched<half>(const Layout, const Side, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t, cl_mem,
+                                                        const size_t, const size_t, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                       const T* alphas, const cl_mem a_buffer, const size_t* a_offsets, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc, const T* betas,
+                       cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      betas_cpp.push_back(betas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoGemvBatched(layout, a_transpose, m, n, alphas_cpp, Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc, betas_cpp, Buffer<T>(y_buffer), y_offsets_cpp,
+                          y_inc, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API GemvBatched<float>(const Layout, const Transpose, const size_t, const size_t,
+                                                  const float*, const cl_mem, const size_t*, const size_t, const cl_mem,
+                                                  const size_t*, const size_t, const float*, cl_mem, const size_t*,
+                                                  const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<double>(const Layout, const Transpose, const size_t, const size_t,
+                                                   const double*, const cl_mem, const size_t*, const size_t,
+                                                   const cl_mem, const size_t*, const size_t, const double*, cl_mem,
+                                                   const size_t*, const size_t, const size_t, cl_command_queue*,
+                                                   cl_event*);
+template StatusCode PUBLIC_API GemvBatched<float2>(const Layout, const Transpose, const size_t, const size_t,
+                                                   const float2*, const cl_mem, const size_t*, const size_t,
+                                                   const cl_mem, const size_t*, const size_t, const float2*, cl_mem,
+                                                   const size_t*, const size_t, const size_t, cl_command_queue*,
+                                                   cl_event*);
+template StatusCode PUBLIC_API GemvBatched<double2>(const Layout, const Transpose, const size_t, const size_t,
+                                                    const double2*, const cl_mem, const size_t*, const size_t,
+                                                    const cl_mem, const size_t*, const size_t, const double2*, cl_mem,
+                                                    const size_t*, const size_t, const size_t, cl_command_queue*,
+                                                    cl_event*);
+template StatusCode PUBLIC_API GemvBatched<half>(const Layout, const Transpose, const size_t, const size_t, const half*,
+                                                 const cl_mem, const size_t*, const size_t, const cl_mem, const size_t*,
+                                                 const size_t, const half*, cl_mem, const size_t*, const size_t,
+                                                 const size_t, cl_command_queue*, cl_event*);
+
+// StridedBatched version of GEMV:
+// SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                              const T alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                              const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              const size_t x_stride, const T beta, cl_mem y_buffer, const size_t y_offset,
+                              const size_t y_inc, const size_t y_stride, const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvBatched<T>(queue_cpp, event);
+    routine.DoGemvStridedBatched(layout, a_transpose, m, n, alpha, Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride, beta, Buffer<T>(y_buffer), y_offset,
+                                 y_inc, y_stride, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API GemvStridedBatched<float>(const Layout, const Transpose, const size_t, const size_t,
+                                                         const float, const cl_mem, const size_t, const size_t,
+                                                         const size_t, const cl_mem, const size_t, const size_t,
+                                                         const size_t, const float, cl_mem, const size_t, const size_t,
+                                                         const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<double>(const Layout, const Transpose, const size_t, const size_t,
+                                                          const double, const cl_mem, const size_t, const size_t,
+                                                          const size_t, const cl_mem, const size_t, const size_t,
+                                                          const size_t, const double, cl_mem, const size_t,
+                                                          const size_t, const size_t, const size_t, cl_command_queue*,
+                                                          cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<float2>(const Layout, const Transpose, const size_t, const size_t,
+                                                          const float2, const cl_mem, const size_t, const size_t,
+                                                          const size_t, const cl_mem, const size_t, const size_t,
+                                                          const size_t, const float2, cl_mem, const size_t,
+                                                          const size_t, const size_t, const size_t, cl_command_queue*,
+                                                          cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<double2>(const Layout, const Transpose, const size_t, const size_t,
+                                                           const double2, const cl_mem, const size_t, const size_t,
+                                                           const size_t, const cl_mem, const size_t, const size_t,
+                                                           const size_t, const double2, cl_mem, const size_t,
+                                                           const size_t, const size_t, const size_t, cl_command_queue*,
+                                                           cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<half>(const Layout, const Transpose, const size_t, const size_t,
+                                                        const half, const cl_mem, const size_t, const size_t,
+                                                        const size_t, const cl_mem, const size_t, const size_t,
+                                                        const size_t, const half, cl_mem, const size_t, const size_t,
+                                                        const size_t, const size_t, cl_command_queue*, cl_event*);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 template <typename T>
 StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose, const size_t m,
@@ -1676,6 +2515,182 @@ template StatusCode PUBLIC_API GemmStridedBatched<half>(const Layout, const Tran
                                                         const size_t, const size_t, const size_t, const size_t,
                                                         cl_command_queue*, cl_event*);
 
+// Grouped version of GEMM, with different sizes per entry:
+// SGEMMGROUPED/DGEMMGROUPED/CGEMMGROUPED/ZGEMMGROUPED/HGEMMGROUPED
+template <typename T>
+StatusCode GemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose, const size_t* ms,
+                       const size_t* ns, const size_t* ks, const T* alphas, const cl_mem a_buffer,
+                       const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer, const size_t* b_offsets,
+                       const size_t* b_lds, const T* betas, cl_mem c_buffer, const size_t* c_offsets,
+                       const size_t* c_lds, const size_t group_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmGrouped<T>(queue_cpp, event);
+    auto ms_cpp = std::vector<size_t>();
+    auto ns_cpp = std::vector<size_t>();
+    auto ks_cpp = std::vector<size_t>();
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto b_offsets_cpp = std::vector<size_t>();
+    auto c_offsets_cpp = std::vector<size_t>();
+    auto a_lds_cpp = std::vector<size_t>();
+    auto b_lds_cpp = std::vector<size_t>();
+    auto c_lds_cpp = std::vector<size_t>();
+    for (auto entry = size_t{0}; entry < group_count; ++entry) {
+      ms_cpp.push_back(ms[entry]);
+      ns_cpp.push_back(ns[entry]);
+      ks_cpp.push_back(ks[entry]);
+      alphas_cpp.push_back(alphas[entry]);
+      betas_cpp.push_back(betas[entry]);
+      a_offsets_cpp.push_back(a_offsets[entry]);
+      b_offsets_cpp.push_back(b_offsets[entry]);
+      c_offsets_cpp.push_back(c_offsets[entry]);
+      a_lds_cpp.push_back(a_lds[entry]);
+      b_lds_cpp.push_back(b_lds[entry]);
+      c_lds_cpp.push_back(c_lds[entry]);
+    }
+    routine.DoGemmGrouped(layout, a_transpose, b_transpose, ms_cpp, ns_cpp, ks_cpp, alphas_cpp, Buffer<T>(a_buffer),
+                          a_offsets_cpp, a_lds_cpp, Buffer<T>(b_buffer), b_offsets_cpp, b_lds_cpp, betas_cpp,
+                          Buffer<T>(c_buffer), c_offsets_cpp, c_lds_cpp, group_count);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API GemmGrouped<float>(const Layout, const Transpose, const Transpose, const size_t*,
+                                                  const size_t*, const size_t*, const float*, const cl_mem,
+                                                  const size_t*, const size_t*, const cl_mem, const size_t*,
+                                                  const size_t*, const float*, cl_mem, const size_t*, const size_t*,
+                                                  const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<double>(const Layout, const Transpose, const Transpose, const size_t*,
+                                                   const size_t*, const size_t*, const double*, const cl_mem,
+                                                   const size_t*, const size_t*, const cl_mem, const size_t*,
+                                                   const size_t*, const double*, cl_mem, const size_t*, const size_t*,
+                                                   const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<float2>(const Layout, const Transpose, const Transpose, const size_t*,
+                                                   const size_t*, const size_t*, const float2*, const cl_mem,
+                                                   const size_t*, const size_t*, const cl_mem, const size_t*,
+                                                   const size_t*, const float2*, cl_mem, const size_t*, const size_t*,
+                                                   const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<double2>(const Layout, const Transpose, const Transpose, const size_t*,
+                                                    const size_t*, const size_t*, const double2*, const cl_mem,
+                                                    const size_t*, const size_t*, const cl_mem, const size_t*,
+                                                    const size_t*, const double2*, cl_mem, const size_t*, const size_t*,
+                                                    const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<half>(const Layout, const Transpose, const Transpose, const size_t*,
+                                                 const size_t*, const size_t*, const half*, const cl_mem, const size_t*,
+                                                 const size_t*, const cl_mem, const size_t*, const size_t*, const half*,
+                                                 cl_mem, const size_t*, const size_t*, const size_t, cl_command_queue*,
+                                                 cl_event*);
+
+// Deferred version of GER, applying k rank-1 updates at once: SGERDEFERRED/DGERDEFERRED/HGERDEFERRED
+template <typename T>
+StatusCode GerDeferred(const Layout layout, const size_t m, const size_t n, const T* alphas, const cl_mem x_buffer,
+                       const size_t* x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t* y_offsets,
+                       const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t k,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgerDeferred<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto l = size_t{0}; l < k; ++l) {
+      alphas_cpp.push_back(alphas[l]);
+      x_offsets_cpp.push_back(x_offsets[l]);
+      y_offsets_cpp.push_back(y_offsets[l]);
+    }
+    routine.DoGerDeferred(layout, m, n, alphas_cpp, Buffer<T>(x_buffer), x_offsets_cpp, x_inc, Buffer<T>(y_buffer),
+                          y_offsets_cpp, y_inc, Buffer<T>(a_buffer), a_offset, a_ld, k);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API GerDeferred<float>(const Layout, const size_t, const size_t, const float*, const cl_mem,
+                                                  const size_t*, const size_t, const cl_mem, const size_t*,
+                                                  const size_t, cl_mem, const size_t, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GerDeferred<double>(const Layout, const size_t, const size_t, const double*,
+                                                   const cl_mem, const size_t*, const size_t, const cl_mem,
+                                                   const size_t*, const size_t, cl_mem, const size_t, const size_t,
+                                                   const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GerDeferred<half>(const Layout, const size_t, const size_t, const half*, const cl_mem,
+                                                 const size_t*, const size_t, const cl_mem, const size_t*, const size_t,
+                                                 cl_mem, const size_t, const size_t, const size_t, cl_command_queue*,
+                                                 cl_event*);
+
+// Deferred version of SYR2, applying k rank-2 updates at once: SSYR2DEFERRED/DSYR2DEFERRED/HSYR2DEFERRED
+template <typename T>
+StatusCode Syr2Deferred(const Layout layout, const Triangle triangle, const size_t n, const T* alphas,
+                        const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc, const cl_mem y_buffer,
+                        const size_t* y_offsets, const size_t y_inc, cl_mem a_buffer, const size_t a_offset,
+                        const size_t a_ld, const size_t k, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xsyr2Deferred<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto l = size_t{0}; l < k; ++l) {
+      alphas_cpp.push_back(alphas[l]);
+      x_offsets_cpp.push_back(x_offsets[l]);
+      y_offsets_cpp.push_back(y_offsets[l]);
+    }
+    routine.DoSyr2Deferred(layout, triangle, n, alphas_cpp, Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                           Buffer<T>(y_buffer), y_offsets_cpp, y_inc, Buffer<T>(a_buffer), a_offset, a_ld, k);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API Syr2Deferred<float>(const Layout, const Triangle, const size_t, const float*,
+                                                   const cl_mem, const size_t*, const size_t, const cl_mem,
+                                                   const size_t*, const size_t, cl_mem, const size_t, const size_t,
+                                                   const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Syr2Deferred<double>(const Layout, const Triangle, const size_t, const double*,
+                                                    const cl_mem, const size_t*, const size_t, const cl_mem,
+                                                    const size_t*, const size_t, cl_mem, const size_t, const size_t,
+                                                    const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Syr2Deferred<half>(const Layout, const Triangle, const size_t, const half*, const cl_mem,
+                                                  const size_t*, const size_t, const cl_mem, const size_t*,
+                                                  const size_t, cl_mem, const size_t, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+
+// Deferred version of HER2, applying k rank-2 updates at once: CHER2DEFERRED/ZHER2DEFERRED
+template <typename T>
+StatusCode Her2Deferred(const Layout layout, const Triangle triangle, const size_t n, const T* alphas,
+                        const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc, const cl_mem y_buffer,
+                        const size_t* y_offsets, const size_t y_inc, cl_mem a_buffer, const size_t a_offset,
+                        const size_t a_ld, const size_t k, cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xher2Deferred<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto l = size_t{0}; l < k; ++l) {
+      alphas_cpp.push_back(alphas[l]);
+      x_offsets_cpp.push_back(x_offsets[l]);
+      y_offsets_cpp.push_back(y_offsets[l]);
+    }
+    routine.DoHer2Deferred(layout, triangle, n, alphas_cpp, Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                           Buffer<T>(y_buffer), y_offsets_cpp, y_inc, Buffer<T>(a_buffer), a_offset, a_ld, k);
+    return StatusCode::kSuccess;
+  } catch (...) {
+    return DispatchException();
+  }
+}
+template StatusCode PUBLIC_API Her2Deferred<float2>(const Layout, const Triangle, const size_t, const float2*,
+                                                    const cl_mem, const size_t*, const size_t, const cl_mem,
+                                                    const size_t*, const size_t, cl_mem, const size_t, const size_t,
+                                                    const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Her2Deferred<double2>(const Layout, const Triangle, const size_t, const double2*,
+                                                     const cl_mem, const size_t*, const size_t, const cl_mem,
+                                                     const size_t*, const size_t, cl_mem, const size_t, const size_t,
+                                                     const size_t, cl_command_queue*, cl_event*);
+
 // =================================================================================================
 
 // Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
@@ -2386,6 +2386,401 @@ CLBlastStatusCode CLBlastHhad(const size_t n, const cl_half alpha, const cl_mem
   }
 }
 
+// AXPBY
+CLBlastStatusCode CLBlastSaxpby(const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset,
+                                const size_t x_inc, const float beta, cl_mem y_buffer, const size_t y_offset,
+                                const size_t y_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Axpby(n, alpha, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset,
+                                                         y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDaxpby(const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset,
+                                const size_t x_inc, const double beta, cl_mem y_buffer, const size_t y_offset,
+                                const size_t y_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Axpby(n, alpha, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset,
+                                                         y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastCaxpby(const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset,
+                                const size_t x_inc, const cl_float2 beta, cl_mem y_buffer, const size_t y_offset,
+                                const size_t y_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Axpby(n, float2{alpha.s[0], alpha.s[1]}, x_buffer, x_offset, x_inc,
+                                                         float2{beta.s[0], beta.s[1]}, y_buffer, y_offset, y_inc, queue,
+                                                         event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZaxpby(const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset,
+                                const size_t x_inc, const cl_double2 beta, cl_mem y_buffer, const size_t y_offset,
+                                const size_t y_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Axpby(n, double2{alpha.s[0], alpha.s[1]}, x_buffer, x_offset, x_inc,
+                                                         double2{beta.s[0], beta.s[1]}, y_buffer, y_offset, y_inc,
+                                                         queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHaxpby(const size_t n, const cl_half alpha, const cl_mem x_buffer, const size_t x_offset,
+                                const size_t x_inc, const cl_half beta, cl_mem y_buffer, const size_t y_offset,
+                                const size_t y_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Axpby(n, alpha, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset,
+                                                         y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// WAXPBY
+CLBlastStatusCode CLBlastSwaxpby(const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset,
+                                 const size_t x_inc, const float beta, const cl_mem y_buffer, const size_t y_offset,
+                                 const size_t y_inc, cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Waxpby(n, alpha, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset,
+                                                          y_inc, w_buffer, w_offset, w_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDwaxpby(const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset,
+                                 const size_t x_inc, const double beta, const cl_mem y_buffer, const size_t y_offset,
+                                 const size_t y_inc, cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Waxpby(n, alpha, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset,
+                                                          y_inc, w_buffer, w_offset, w_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastCwaxpby(const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset,
+                                 const size_t x_inc, const cl_float2 beta, const cl_mem y_buffer, const size_t y_offset,
+                                 const size_t y_inc, cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Waxpby(n, float2{alpha.s[0], alpha.s[1]}, x_buffer, x_offset, x_inc,
+                                                          float2{beta.s[0], beta.s[1]}, y_buffer, y_offset, y_inc,
+                                                          w_buffer, w_offset, w_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZwaxpby(const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset,
+                                 const size_t x_inc, const cl_double2 beta, const cl_mem y_buffer,
+                                 const size_t y_offset, const size_t y_inc, cl_mem w_buffer, const size_t w_offset,
+                                 const size_t w_inc, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Waxpby(n, double2{alpha.s[0], alpha.s[1]}, x_buffer, x_offset, x_inc,
+                                                          double2{beta.s[0], beta.s[1]}, y_buffer, y_offset, y_inc,
+                                                          w_buffer, w_offset, w_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHwaxpby(const size_t n, const cl_half alpha, const cl_mem x_buffer, const size_t x_offset,
+                                 const size_t x_inc, const cl_half beta, const cl_mem y_buffer, const size_t y_offset,
+                                 const size_t y_inc, cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Waxpby(n, alpha, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset,
+                                                          y_inc, w_buffer, w_offset, w_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// AXPYDEVICESCALARS
+CLBlastStatusCode CLBlastSaxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AxpyDeviceScalars<float>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset,
+                                          y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDaxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AxpyDeviceScalars<double>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset,
+                                           y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastCaxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AxpyDeviceScalars<float2>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset,
+                                           y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZaxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AxpyDeviceScalars<double2>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, y_buffer,
+                                            y_offset, y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHaxpyDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AxpyDeviceScalars<half>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset,
+                                         y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// SCALDEVICESCALARS
+CLBlastStatusCode CLBlastSscalDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::ScalDeviceScalars<float>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDscalDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::ScalDeviceScalars<double>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastCscalDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::ScalDeviceScalars<float2>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZscalDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::ScalDeviceScalars<double2>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHscalDeviceScalars(const size_t n, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::ScalDeviceScalars<half>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// GEMVDEVICESCALARS
+CLBlastStatusCode CLBlastSgemvDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                            const size_t m, const size_t n, const cl_mem alpha_buffer,
+                                            const size_t alpha_offset, const cl_mem a_buffer, const size_t a_offset,
+                                            const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                                            const size_t x_inc, const cl_mem beta_buffer, const size_t beta_offset,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemvDeviceScalars<float>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alpha_buffer,
+        alpha_offset, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_buffer, beta_offset, y_buffer, y_offset,
+        y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDgemvDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                            const size_t m, const size_t n, const cl_mem alpha_buffer,
+                                            const size_t alpha_offset, const cl_mem a_buffer, const size_t a_offset,
+                                            const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                                            const size_t x_inc, const cl_mem beta_buffer, const size_t beta_offset,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemvDeviceScalars<double>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alpha_buffer,
+        alpha_offset, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_buffer, beta_offset, y_buffer, y_offset,
+        y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastCgemvDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                            const size_t m, const size_t n, const cl_mem alpha_buffer,
+                                            const size_t alpha_offset, const cl_mem a_buffer, const size_t a_offset,
+                                            const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                                            const size_t x_inc, const cl_mem beta_buffer, const size_t beta_offset,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemvDeviceScalars<float2>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alpha_buffer,
+        alpha_offset, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_buffer, beta_offset, y_buffer, y_offset,
+        y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZgemvDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                            const size_t m, const size_t n, const cl_mem alpha_buffer,
+                                            const size_t alpha_offset, const cl_mem a_buffer, const size_t a_offset,
+                                            const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                                            const size_t x_inc, const cl_mem beta_buffer, const size_t beta_offset,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemvDeviceScalars<double2>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alpha_buffer,
+        alpha_offset, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_buffer, beta_offset, y_buffer, y_offset,
+        y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHgemvDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                            const size_t m, const size_t n, const cl_mem alpha_buffer,
+                                            const size_t alpha_offset, const cl_mem a_buffer, const size_t a_offset,
+                                            const size_t a_ld, const cl_mem x_buffer, const size_t x_offset,
+                                            const size_t x_inc, const cl_mem beta_buffer, const size_t beta_offset,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemvDeviceScalars<half>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alpha_buffer,
+        alpha_offset, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_buffer, beta_offset, y_buffer, y_offset,
+        y_inc, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// GEMMDEVICESCALARS
+CLBlastStatusCode CLBlastSgemmDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                            const CLBlastTranspose b_transpose, const size_t m, const size_t n,
+                                            const size_t k, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const cl_mem beta_buffer, const size_t beta_offset, cl_mem c_buffer,
+                                            const size_t c_offset, const size_t c_ld, cl_command_queue* queue,
+                                            cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemmDeviceScalars<float>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+        static_cast<clblast::Transpose>(b_transpose), m, n, k, alpha_buffer, alpha_offset, a_buffer, a_offset, a_ld,
+        b_buffer, b_offset, b_ld, beta_buffer, beta_offset, c_buffer, c_offset, c_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDgemmDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                            const CLBlastTranspose b_transpose, const size_t m, const size_t n,
+                                            const size_t k, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const cl_mem beta_buffer, const size_t beta_offset, cl_mem c_buffer,
+                                            const size_t c_offset, const size_t c_ld, cl_command_queue* queue,
+                                            cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemmDeviceScalars<double>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+        static_cast<clblast::Transpose>(b_transpose), m, n, k, alpha_buffer, alpha_offset, a_buffer, a_offset, a_ld,
+        b_buffer, b_offset, b_ld, beta_buffer, beta_offset, c_buffer, c_offset, c_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastCgemmDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                            const CLBlastTranspose b_transpose, const size_t m, const size_t n,
+                                            const size_t k, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const cl_mem beta_buffer, const size_t beta_offset, cl_mem c_buffer,
+                                            const size_t c_offset, const size_t c_ld, cl_command_queue* queue,
+                                            cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemmDeviceScalars<float2>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+        static_cast<clblast::Transpose>(b_transpose), m, n, k, alpha_buffer, alpha_offset, a_buffer, a_offset, a_ld,
+        b_buffer, b_offset, b_ld, beta_buffer, beta_offset, c_buffer, c_offset, c_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZgemmDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                            const CLBlastTranspose b_transpose, const size_t m, const size_t n,
+                                            const size_t k, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const cl_mem beta_buffer, const size_t beta_offset, cl_mem c_buffer,
+                                            const size_t c_offset, const size_t c_ld, cl_command_queue* queue,
+                                            cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemmDeviceScalars<double2>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+        static_cast<clblast::Transpose>(b_transpose), m, n, k, alpha_buffer, alpha_offset, a_buffer, a_offset, a_ld,
+        b_buffer, b_offset, b_ld, beta_buffer, beta_offset, c_buffer, c_offset, c_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHgemmDeviceScalars(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                            const CLBlastTranspose b_transpose, const size_t m, const size_t n,
+                                            const size_t k, const cl_mem alpha_buffer, const size_t alpha_offset,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const cl_mem beta_buffer, const size_t beta_offset, cl_mem c_buffer,
+                                            const size_t c_offset, const size_t c_ld, cl_command_queue* queue,
+                                            cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemmDeviceScalars<half>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+        static_cast<clblast::Transpose>(b_transpose), m, n, k, alpha_buffer, alpha_offset, a_buffer, a_offset, a_ld,
+        b_buffer, b_offset, b_ld, beta_buffer, beta_offset, c_buffer, c_offset, c_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
 // OMATCOPY
 CLBlastStatusCode CLBlastSomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
                                    const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset,
@@ -2570,150 +2965,920 @@ CLBlastStatusCode CLBlastZcol2im(const CLBlastKernelMode kernel_mode, const size
                                  const size_t col_offset, cl_mem im_buffer, const size_t im_offset,
                                  cl_command_queue* queue, cl_event* event) {
   try {
-    return static_cast<CLBlastStatusCode>(clblast::Col2im<double2>(
-        static_cast<clblast::KernelMode>(kernel_mode), channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
-        stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, event));
+    return static_cast<CLBlastStatusCode>(clblast::Col2im<double2>(
+        static_cast<clblast::KernelMode>(kernel_mode), channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
+        stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHcol2im(const CLBlastKernelMode kernel_mode, const size_t channels, const size_t height,
+                                 const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
+                                 const size_t pad_w, const size_t stride_h, const size_t stride_w,
+                                 const size_t dilation_h, const size_t dilation_w, const cl_mem col_buffer,
+                                 const size_t col_offset, cl_mem im_buffer, const size_t im_offset,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Col2im<half>(
+        static_cast<clblast::KernelMode>(kernel_mode), channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
+        stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// CONVGEMM
+CLBlastStatusCode CLBlastSconvgemm(const CLBlastKernelMode kernel_mode, const size_t channels, const size_t height,
+                                   const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
+                                   const size_t pad_w, const size_t stride_h, const size_t stride_w,
+                                   const size_t dilation_h, const size_t dilation_w, const size_t num_kernels,
+                                   const size_t batch_count, const cl_mem im_buffer, const size_t im_offset,
+                                   const cl_mem kernel_buffer, const size_t kernel_offset, cl_mem result_buffer,
+                                   const size_t result_offset, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Convgemm<float>(
+        static_cast<clblast::KernelMode>(kernel_mode), channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
+        stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer,
+        kernel_offset, result_buffer, result_offset, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDconvgemm(const CLBlastKernelMode kernel_mode, const size_t channels, const size_t height,
+                                   const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
+                                   const size_t pad_w, const size_t stride_h, const size_t stride_w,
+                                   const size_t dilation_h, const size_t dilation_w, const size_t num_kernels,
+                                   const size_t batch_count, const cl_mem im_buffer, const size_t im_offset,
+                                   const cl_mem kernel_buffer, const size_t kernel_offset, cl_mem result_buffer,
+                                   const size_t result_offset, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Convgemm<double>(
+        static_cast<clblast::KernelMode>(kernel_mode), channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
+        stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer,
+        kernel_offset, result_buffer, result_offset, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHconvgemm(const CLBlastKernelMode kernel_mode, const size_t channels, const size_t height,
+                                   const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
+                                   const size_t pad_w, const size_t stride_h, const size_t stride_w,
+                                   const size_t dilation_h, const size_t dilation_w, const size_t num_kernels,
+                                   const size_t batch_count, const cl_mem im_buffer, const size_t im_offset,
+                                   const cl_mem kernel_buffer, const size_t kernel_offset, cl_mem result_buffer,
+                                   const size_t result_offset, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Convgemm<half>(
+        static_cast<clblast::KernelMode>(kernel_mode), channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
+        stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer,
+        kernel_offset, result_buffer, result_offset, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// AXPY
+CLBlastStatusCode CLBlastSaxpyBatched(const size_t n, const float* alphas, const cl_mem x_buffer,
+                                      const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
+                                      const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::AxpyBatched(n, alphas_cpp.data(), x_buffer, x_offsets, x_inc,
+                                                               y_buffer, y_offsets, y_inc, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDaxpyBatched(const size_t n, const double* alphas, const cl_mem x_buffer,
+                                      const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
+                                      const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::AxpyBatched(n, alphas_cpp.data(), x_buffer, x_offsets, x_inc,
+                                                               y_buffer, y_offsets, y_inc, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastCaxpyBatched(const size_t n, const cl_float2* alphas, const cl_mem x_buffer,
+                                      const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
+                                      const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::AxpyBatched(n, alphas_cpp.data(), x_buffer, x_offsets, x_inc,
+                                                               y_buffer, y_offsets, y_inc, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZaxpyBatched(const size_t n, const cl_double2* alphas, const cl_mem x_buffer,
+                                      const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
+                                      const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::AxpyBatched(n, alphas_cpp.data(), x_buffer, x_offsets, x_inc,
+                                                               y_buffer, y_offsets, y_inc, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHaxpyBatched(const size_t n, const cl_half* alphas, const cl_mem x_buffer,
+                                      const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
+                                      const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::AxpyBatched(n, alphas_cpp.data(), x_buffer, x_offsets, x_inc,
+                                                               y_buffer, y_offsets, y_inc, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// ROT
+CLBlastStatusCode CLBlastSrotBatched(const size_t n, cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                     const float* cos_values, const float* sin_values, const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::RotBatched(n, x_buffer, x_offsets, x_inc, y_buffer, y_offsets,
+                                                              y_inc, cos_values, sin_values, batch_count, queue,
+                                                              event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDrotBatched(const size_t n, cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                     const double* cos_values, const double* sin_values, const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::RotBatched(n, x_buffer, x_offsets, x_inc, y_buffer, y_offsets,
+                                                              y_inc, cos_values, sin_values, batch_count, queue,
+                                                              event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// DOT
+CLBlastStatusCode CLBlastSdotBatched(const size_t n, cl_mem dot_buffer, const size_t* dot_offsets,
+                                     const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                     const cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                     const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::DotBatched<float>(n, dot_buffer, dot_offsets, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc,
+                                   batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDdotBatched(const size_t n, cl_mem dot_buffer, const size_t* dot_offsets,
+                                     const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                     const cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                     const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::DotBatched<double>(n, dot_buffer, dot_offsets, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc,
+                                    batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHdotBatched(const size_t n, cl_mem dot_buffer, const size_t* dot_offsets,
+                                     const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                     const cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                     const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::DotBatched<half>(n, dot_buffer, dot_offsets, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc,
+                                  batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// DOT
+CLBlastStatusCode CLBlastSdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset,
+                                            const size_t dot_stride, const cl_mem x_buffer, const size_t x_offset,
+                                            const size_t x_inc, const size_t x_stride, const cl_mem y_buffer,
+                                            const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                            const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::DotStridedBatched<float>(n, dot_buffer, dot_offset, dot_stride, x_buffer, x_offset, x_inc, x_stride,
+                                          y_buffer, y_offset, y_inc, y_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset,
+                                            const size_t dot_stride, const cl_mem x_buffer, const size_t x_offset,
+                                            const size_t x_inc, const size_t x_stride, const cl_mem y_buffer,
+                                            const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                            const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::DotStridedBatched<double>(n, dot_buffer, dot_offset, dot_stride, x_buffer, x_offset, x_inc, x_stride,
+                                           y_buffer, y_offset, y_inc, y_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset,
+                                            const size_t dot_stride, const cl_mem x_buffer, const size_t x_offset,
+                                            const size_t x_inc, const size_t x_stride, const cl_mem y_buffer,
+                                            const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                            const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::DotStridedBatched<half>(n, dot_buffer, dot_offset, dot_stride, x_buffer, x_offset, x_inc, x_stride,
+                                         y_buffer, y_offset, y_inc, y_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// NRM2
+CLBlastStatusCode CLBlastSnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                      const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::Nrm2Batched<float>(n, nrm2_buffer, nrm2_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                    event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                      const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::Nrm2Batched<double>(n, nrm2_buffer, nrm2_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                     event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastScnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets,
+                                       const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                       const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::Nrm2Batched<float2>(n, nrm2_buffer, nrm2_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                     event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDznrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets,
+                                       const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                       const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::Nrm2Batched<double2>(n, nrm2_buffer, nrm2_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                      event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t* nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                      const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::Nrm2Batched<half>(n, nrm2_buffer, nrm2_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                   event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// NRM2
+CLBlastStatusCode CLBlastSnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                             const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset,
+                                             const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::Nrm2StridedBatched<float>(n, nrm2_buffer, nrm2_offset, nrm2_stride, x_buffer, x_offset, x_inc,
+                                           x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                             const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset,
+                                             const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::Nrm2StridedBatched<double>(n, nrm2_buffer, nrm2_offset, nrm2_stride, x_buffer, x_offset, x_inc,
+                                            x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastScnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                              const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset,
+                                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::Nrm2StridedBatched<float2>(n, nrm2_buffer, nrm2_offset, nrm2_stride, x_buffer, x_offset, x_inc,
+                                            x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDznrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                              const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset,
+                                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::Nrm2StridedBatched<double2>(n, nrm2_buffer, nrm2_offset, nrm2_stride, x_buffer, x_offset, x_inc,
+                                             x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                             const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset,
+                                             const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::Nrm2StridedBatched<half>(n, nrm2_buffer, nrm2_offset, nrm2_stride, x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// ASUM
+CLBlastStatusCode CLBlastSasumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets,
+                                      const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                      const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AsumBatched<float>(n, asum_buffer, asum_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                    event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDasumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets,
+                                      const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                      const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AsumBatched<double>(n, asum_buffer, asum_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                     event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastScasumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets,
+                                       const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                       const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AsumBatched<float2>(n, asum_buffer, asum_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                     event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDzasumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets,
+                                       const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                       const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AsumBatched<double2>(n, asum_buffer, asum_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                      event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHasumBatched(const size_t n, cl_mem asum_buffer, const size_t* asum_offsets,
+                                      const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                      const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AsumBatched<half>(n, asum_buffer, asum_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                   event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// ASUM
+CLBlastStatusCode CLBlastSasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset,
+                                             const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset,
+                                             const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AsumStridedBatched<float>(n, asum_buffer, asum_offset, asum_stride, x_buffer, x_offset, x_inc,
+                                           x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset,
+                                             const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset,
+                                             const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AsumStridedBatched<double>(n, asum_buffer, asum_offset, asum_stride, x_buffer, x_offset, x_inc,
+                                            x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastScasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset,
+                                              const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset,
+                                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AsumStridedBatched<float2>(n, asum_buffer, asum_offset, asum_stride, x_buffer, x_offset, x_inc,
+                                            x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDzasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset,
+                                              const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset,
+                                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AsumStridedBatched<double2>(n, asum_buffer, asum_offset, asum_stride, x_buffer, x_offset, x_inc,
+                                             x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset,
+                                             const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset,
+                                             const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AsumStridedBatched<half>(n, asum_buffer, asum_offset, asum_stride, x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// AMAX
+CLBlastStatusCode CLBlastiSamaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets,
+                                       const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                       const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AmaxBatched<float>(n, imax_buffer, imax_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                    event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiDamaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets,
+                                       const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                       const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AmaxBatched<double>(n, imax_buffer, imax_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                     event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiCamaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets,
+                                       const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                       const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AmaxBatched<float2>(n, imax_buffer, imax_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                     event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiZamaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets,
+                                       const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                       const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AmaxBatched<double2>(n, imax_buffer, imax_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                      event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiHamaxBatched(const size_t n, cl_mem imax_buffer, const size_t* imax_offsets,
+                                       const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                       const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AmaxBatched<half>(n, imax_buffer, imax_offsets, x_buffer, x_offsets, x_inc, batch_count, queue,
+                                   event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// AMAX
+CLBlastStatusCode CLBlastiSamaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                              const size_t imax_stride, const cl_mem x_buffer, const size_t x_offset,
+                                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AmaxStridedBatched<float>(n, imax_buffer, imax_offset, imax_stride, x_buffer, x_offset, x_inc,
+                                           x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiDamaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                              const size_t imax_stride, const cl_mem x_buffer, const size_t x_offset,
+                                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AmaxStridedBatched<double>(n, imax_buffer, imax_offset, imax_stride, x_buffer, x_offset, x_inc,
+                                            x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiCamaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                              const size_t imax_stride, const cl_mem x_buffer, const size_t x_offset,
+                                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AmaxStridedBatched<float2>(n, imax_buffer, imax_offset, imax_stride, x_buffer, x_offset, x_inc,
+                                            x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiZamaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                              const size_t imax_stride, const cl_mem x_buffer, const size_t x_offset,
+                                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AmaxStridedBatched<double2>(n, imax_buffer, imax_offset, imax_stride, x_buffer, x_offset, x_inc,
+                                             x_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiHamaxStridedBatched(const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                              const size_t imax_stride, const cl_mem x_buffer, const size_t x_offset,
+                                              const size_t x_inc, const size_t x_stride, const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+        clblast::AmaxStridedBatched<half>(n, imax_buffer, imax_offset, imax_stride, x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// AMAXMATRIX
+CLBlastStatusCode CLBlastiSamaxMatrix(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
+                                      const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::AmaxMatrix<float>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, imax_buffer,
+        imax_offset, a_buffer, a_offset, a_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiDamaxMatrix(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
+                                      const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::AmaxMatrix<double>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, imax_buffer,
+        imax_offset, a_buffer, a_offset, a_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiCamaxMatrix(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
+                                      const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::AmaxMatrix<float2>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, imax_buffer,
+        imax_offset, a_buffer, a_offset, a_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiZamaxMatrix(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
+                                      const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::AmaxMatrix<double2>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, imax_buffer,
+        imax_offset, a_buffer, a_offset, a_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastiHamaxMatrix(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
+                                      const size_t n, cl_mem imax_buffer, const size_t imax_offset,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::AmaxMatrix<half>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, imax_buffer,
+        imax_offset, a_buffer, a_offset, a_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// DGMM
+CLBlastStatusCode CLBlastSdgmm(const CLBlastLayout layout, const CLBlastSide side, const size_t m, const size_t n,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer,
+                               const size_t x_offset, const size_t x_inc, cl_mem c_buffer, const size_t c_offset,
+                               const size_t c_ld, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Dgmm<float>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Side>(side), m, n, a_buffer, a_offset, a_ld,
+        x_buffer, x_offset, x_inc, c_buffer, c_offset, c_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDdgmm(const CLBlastLayout layout, const CLBlastSide side, const size_t m, const size_t n,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer,
+                               const size_t x_offset, const size_t x_inc, cl_mem c_buffer, const size_t c_offset,
+                               const size_t c_ld, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Dgmm<double>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Side>(side), m, n, a_buffer, a_offset, a_ld,
+        x_buffer, x_offset, x_inc, c_buffer, c_offset, c_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastCdgmm(const CLBlastLayout layout, const CLBlastSide side, const size_t m, const size_t n,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer,
+                               const size_t x_offset, const size_t x_inc, cl_mem c_buffer, const size_t c_offset,
+                               const size_t c_ld, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Dgmm<float2>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Side>(side), m, n, a_buffer, a_offset, a_ld,
+        x_buffer, x_offset, x_inc, c_buffer, c_offset, c_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZdgmm(const CLBlastLayout layout, const CLBlastSide side, const size_t m, const size_t n,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer,
+                               const size_t x_offset, const size_t x_inc, cl_mem c_buffer, const size_t c_offset,
+                               const size_t c_ld, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Dgmm<double2>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Side>(side), m, n, a_buffer, a_offset, a_ld,
+        x_buffer, x_offset, x_inc, c_buffer, c_offset, c_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHdgmm(const CLBlastLayout layout, const CLBlastSide side, const size_t m, const size_t n,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer,
+                               const size_t x_offset, const size_t x_inc, cl_mem c_buffer, const size_t c_offset,
+                               const size_t c_ld, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Dgmm<half>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Side>(side), m, n, a_buffer, a_offset, a_ld,
+        x_buffer, x_offset, x_inc, c_buffer, c_offset, c_ld, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// DGMMSTRIDEDBATCHED
+CLBlastStatusCode CLBlastSdgmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const size_t m,
+                                             const size_t n, const cl_mem a_buffer, const size_t a_offset,
+                                             const size_t a_ld, const size_t a_stride, const cl_mem x_buffer,
+                                             const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             const size_t c_stride, const size_t batch_count, cl_command_queue* queue,
+                                             cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::DgmmStridedBatched<float>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Side>(side), m, n, a_buffer, a_offset, a_ld,
+        a_stride, x_buffer, x_offset, x_inc, x_stride, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
   } catch (...) {
     return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
   }
 }
-CLBlastStatusCode CLBlastHcol2im(const CLBlastKernelMode kernel_mode, const size_t channels, const size_t height,
-                                 const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
-                                 const size_t pad_w, const size_t stride_h, const size_t stride_w,
-                                 const size_t dilation_h, const size_t dilation_w, const cl_mem col_buffer,
-                                 const size_t col_offset, cl_mem im_buffer, const size_t im_offset,
-                                 cl_command_queue* queue, cl_event* event) {
+CLBlastStatusCode CLBlastDdgmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const size_t m,
+                                             const size_t n, const cl_mem a_buffer, const size_t a_offset,
+                                             const size_t a_ld, const size_t a_stride, const cl_mem x_buffer,
+                                             const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             const size_t c_stride, const size_t batch_count, cl_command_queue* queue,
+                                             cl_event* event) {
   try {
-    return static_cast<CLBlastStatusCode>(clblast::Col2im<half>(
-        static_cast<clblast::KernelMode>(kernel_mode), channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
-        stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, event));
+    return static_cast<CLBlastStatusCode>(clblast::DgmmStridedBatched<double>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Side>(side), m, n, a_buffer, a_offset, a_ld,
+        a_stride, x_buffer, x_offset, x_inc, x_stride, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
   } catch (...) {
     return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
   }
 }
-
-// CONVGEMM
-CLBlastStatusCode CLBlastSconvgemm(const CLBlastKernelMode kernel_mode, const size_t channels, const size_t height,
-                                   const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
-                                   const size_t pad_w, const size_t stride_h, const size_t stride_w,
-                                   const size_t dilation_h, const size_t dilation_w, const size_t num_kernels,
-                                   const size_t batch_count, const cl_mem im_buffer, const size_t im_offset,
-                                   const cl_mem kernel_buffer, const size_t kernel_offset, cl_mem result_buffer,
-                                   const size_t result_offset, cl_command_queue* queue, cl_event* event) {
+CLBlastStatusCode CLBlastCdgmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const size_t m,
+                                             const size_t n, const cl_mem a_buffer, const size_t a_offset,
+                                             const size_t a_ld, const size_t a_stride, const cl_mem x_buffer,
+                                             const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             const size_t c_stride, const size_t batch_count, cl_command_queue* queue,
+                                             cl_event* event) {
   try {
-    return static_cast<CLBlastStatusCode>(clblast::Convgemm<float>(
-        static_cast<clblast::KernelMode>(kernel_mode), channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
-        stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer,
-        kernel_offset, result_buffer, result_offset, queue, event));
+    return static_cast<CLBlastStatusCode>(clblast::DgmmStridedBatched<float2>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Side>(side), m, n, a_buffer, a_offset, a_ld,
+        a_stride, x_buffer, x_offset, x_inc, x_stride, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
   } catch (...) {
     return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
   }
 }
-CLBlastStatusCode CLBlastDconvgemm(const CLBlastKernelMode kernel_mode, const size_t channels, const size_t height,
-                                   const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
-                                   const size_t pad_w, const size_t stride_h, const size_t stride_w,
-                                   const size_t dilation_h, const size_t dilation_w, const size_t num_kernels,
-                                   const size_t batch_count, const cl_mem im_buffer, const size_t im_offset,
-                                   const cl_mem kernel_buffer, const size_t kernel_offset, cl_mem result_buffer,
-                                   const size_t result_offset, cl_command_queue* queue, cl_event* event) {
+CLBlastStatusCode CLBlastZdgmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const size_t m,
+                                             const size_t n, const cl_mem a_buffer, const size_t a_offset,
+                                             const size_t a_ld, const size_t a_stride, const cl_mem x_buffer,
+                                             const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             const size_t c_stride, const size_t batch_count, cl_command_queue* queue,
+                                             cl_event* event) {
   try {
-    return static_cast<CLBlastStatusCode>(clblast::Convgemm<double>(
-        static_cast<clblast::KernelMode>(kernel_mode), channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
-        stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer,
-        kernel_offset, result_buffer, result_offset, queue, event));
+    return static_cast<CLBlastStatusCode>(clblast::DgmmStridedBatched<double2>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Side>(side), m, n, a_buffer, a_offset, a_ld,
+        a_stride, x_buffer, x_offset, x_inc, x_stride, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
   } catch (...) {
     return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
   }
 }
-CLBlastStatusCode CLBlastHconvgemm(const CLBlastKernelMode kernel_mode, const size_t channels, const size_t height,
-                                   const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
-                                   const size_t pad_w, const size_t stride_h, const size_t stride_w,
-                                   const size_t dilation_h, const size_t dilation_w, const size_t num_kernels,
-                                   const size_t batch_count, const cl_mem im_buffer, const size_t im_offset,
-                                   const cl_mem kernel_buffer, const size_t kernel_offset, cl_mem result_buffer,
-                                   const size_t result_offset, cl_command_queue* queue, cl_event* event) {
+CLBlastStatusCode CLBlastHdgmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const size_t m,
+                                             const size_t n, const cl_mem a_buffer, const size_t a_offset,
+                                             const size_t a_ld, const size_t a_stride, const cl_mem x_buffer,
+                                             const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             const size_t c_stride, const size_t batch_count, cl_command_queue* queue,
+                                             cl_event* event) {
   try {
-    return static_cast<CLBlastStatusCode>(clblast::Convgemm<half>(
-        static_cast<clblast::KernelMode>(kernel_mode), channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
-        stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer,
-        kernel_offset, result_buffer, result_offset, queue, event));
+    return static_cast<CLBlastStatusCode>(clblast::DgmmStridedBatched<half>(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Side>(side), m, n, a_buffer, a_offset, a_ld,
+        a_stride, x_buffer, x_offset, x_inc, x_stride, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
   } catch (...) {
     return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
   }
 }
 
-// AXPY
-CLBlastStatusCode CLBlastSaxpyBatched(const size_t n, const float* alphas, const cl_mem x_buffer,
-                                      const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
+// GEMV
+CLBlastStatusCode CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
+                                      const size_t n, const float* alphas, const cl_mem a_buffer,
+                                      const size_t* a_offsets, const size_t a_ld, const cl_mem x_buffer,
+                                      const size_t* x_offsets, const size_t x_inc, const float* betas, cl_mem y_buffer,
                                       const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
                                       cl_command_queue* queue, cl_event* event) {
   auto alphas_cpp = std::vector<float>();
+  auto betas_cpp = std::vector<float>();
   for (auto batch = size_t{0}; batch < batch_count; ++batch) {
     alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
   }
   try {
-    return static_cast<CLBlastStatusCode>(clblast::AxpyBatched(n, alphas_cpp.data(), x_buffer, x_offsets, x_inc,
-                                                               y_buffer, y_offsets, y_inc, batch_count, queue, event));
+    return static_cast<CLBlastStatusCode>(clblast::GemvBatched(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alphas_cpp.data(),
+        a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas_cpp.data(), y_buffer, y_offsets, y_inc,
+        batch_count, queue, event));
   } catch (...) {
     return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
   }
 }
-CLBlastStatusCode CLBlastDaxpyBatched(const size_t n, const double* alphas, const cl_mem x_buffer,
-                                      const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
+CLBlastStatusCode CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
+                                      const size_t n, const double* alphas, const cl_mem a_buffer,
+                                      const size_t* a_offsets, const size_t a_ld, const cl_mem x_buffer,
+                                      const size_t* x_offsets, const size_t x_inc, const double* betas, cl_mem y_buffer,
                                       const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
                                       cl_command_queue* queue, cl_event* event) {
   auto alphas_cpp = std::vector<double>();
+  auto betas_cpp = std::vector<double>();
   for (auto batch = size_t{0}; batch < batch_count; ++batch) {
     alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
   }
   try {
-    return static_cast<CLBlastStatusCode>(clblast::AxpyBatched(n, alphas_cpp.data(), x_buffer, x_offsets, x_inc,
-                                                               y_buffer, y_offsets, y_inc, batch_count, queue, event));
+    return static_cast<CLBlastStatusCode>(clblast::GemvBatched(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alphas_cpp.data(),
+        a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas_cpp.data(), y_buffer, y_offsets, y_inc,
+        batch_count, queue, event));
   } catch (...) {
     return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
   }
 }
-CLBlastStatusCode CLBlastCaxpyBatched(const size_t n, const cl_float2* alphas, const cl_mem x_buffer,
-                                      const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
-                                      const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
-                                      cl_command_queue* queue, cl_event* event) {
+CLBlastStatusCode CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
+                                      const size_t n, const cl_float2* alphas, const cl_mem a_buffer,
+                                      const size_t* a_offsets, const size_t a_ld, const cl_mem x_buffer,
+                                      const size_t* x_offsets, const size_t x_inc, const cl_float2* betas,
+                                      cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                      const size_t batch_count, cl_command_queue* queue, cl_event* event) {
   auto alphas_cpp = std::vector<float2>();
+  auto betas_cpp = std::vector<float2>();
   for (auto batch = size_t{0}; batch < batch_count; ++batch) {
     alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(float2{betas[batch].s[0], betas[batch].s[1]});
   }
   try {
-    return static_cast<CLBlastStatusCode>(clblast::AxpyBatched(n, alphas_cpp.data(), x_buffer, x_offsets, x_inc,
-                                                               y_buffer, y_offsets, y_inc, batch_count, queue, event));
+    return static_cast<CLBlastStatusCode>(clblast::GemvBatched(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alphas_cpp.data(),
+        a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas_cpp.data(), y_buffer, y_offsets, y_inc,
+        batch_count, queue, event));
   } catch (...) {
     return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
   }
 }
-CLBlastStatusCode CLBlastZaxpyBatched(const size_t n, const cl_double2* alphas, const cl_mem x_buffer,
-                                      const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
-                                      const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
-                                      cl_command_queue* queue, cl_event* event) {
+CLBlastStatusCode CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
+                                      const size_t n, const cl_double2* alphas, const cl_mem a_buffer,
+                                      const size_t* a_offsets, const size_t a_ld, const cl_mem x_buffer,
+                                      const size_t* x_offsets, const size_t x_inc, const cl_double2* betas,
+                                      cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                      const size_t batch_count, cl_command_queue* queue, cl_event* event) {
   auto alphas_cpp = std::vector<double2>();
+  auto betas_cpp = std::vector<double2>();
   for (auto batch = size_t{0}; batch < batch_count; ++batch) {
     alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(double2{betas[batch].s[0], betas[batch].s[1]});
   }
   try {
-    return static_cast<CLBlastStatusCode>(clblast::AxpyBatched(n, alphas_cpp.data(), x_buffer, x_offsets, x_inc,
-                                                               y_buffer, y_offsets, y_inc, batch_count, queue, event));
+    return static_cast<CLBlastStatusCode>(clblast::GemvBatched(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alphas_cpp.data(),
+        a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas_cpp.data(), y_buffer, y_offsets, y_inc,
+        batch_count, queue, event));
   } catch (...) {
     return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
   }
 }
-CLBlastStatusCode CLBlastHaxpyBatched(const size_t n, const cl_half* alphas, const cl_mem x_buffer,
-                                      const size_t* x_offsets, const size_t x_inc, cl_mem y_buffer,
-                                      const size_t* y_offsets, const size_t y_inc, const size_t batch_count,
-                                      cl_command_queue* queue, cl_event* event) {
+CLBlastStatusCode CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m,
+                                      const size_t n, const cl_half* alphas, const cl_mem a_buffer,
+                                      const size_t* a_offsets, const size_t a_ld, const cl_mem x_buffer,
+                                      const size_t* x_offsets, const size_t x_inc, const cl_half* betas,
+                                      cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                      const size_t batch_count, cl_command_queue* queue, cl_event* event) {
   auto alphas_cpp = std::vector<half>();
+  auto betas_cpp = std::vector<half>();
   for (auto batch = size_t{0}; batch < batch_count; ++batch) {
     alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
   }
   try {
-    return static_cast<CLBlastStatusCode>(clblast::AxpyBatched(n, alphas_cpp.data(), x_buffer, x_offsets, x_inc,
-                                                               y_buffer, y_offsets, y_inc, batch_count, queue, event));
+    return static_cast<CLBlastStatusCode>(clblast::GemvBatched(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alphas_cpp.data(),
+        a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas_cpp.data(), y_buffer, y_offsets, y_inc,
+        batch_count, queue, event));
   } catch (...) {
     return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
   }
@@ -2831,6 +3996,90 @@ CLBlastStatusCode CLBlastHgemmBatched(const CLBlastLayout layout, const CLBlastT
   }
 }
 
+// GEMV
+CLBlastStatusCode CLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n, const float alpha, const cl_mem a_buffer,
+                                             const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                             const size_t x_stride, const float beta, cl_mem y_buffer,
+                                             const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemvStridedBatched(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alpha, a_buffer,
+        a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride,
+        batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n, const double alpha, const cl_mem a_buffer,
+                                             const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                             const size_t x_stride, const double beta, cl_mem y_buffer,
+                                             const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemvStridedBatched(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alpha, a_buffer,
+        a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride,
+        batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastCgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n, const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const size_t a_stride, const cl_mem x_buffer, const size_t x_offset,
+                                             const size_t x_inc, const size_t x_stride, const cl_float2 beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                             const size_t y_stride, const size_t batch_count, cl_command_queue* queue,
+                                             cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemvStridedBatched(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n,
+        float2{alpha.s[0], alpha.s[1]}, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride,
+        float2{beta.s[0], beta.s[1]}, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n, const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const size_t a_stride, const cl_mem x_buffer, const size_t x_offset,
+                                             const size_t x_inc, const size_t x_stride, const cl_double2 beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                             const size_t y_stride, const size_t batch_count, cl_command_queue* queue,
+                                             cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemvStridedBatched(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n,
+        double2{alpha.s[0], alpha.s[1]}, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride,
+        double2{beta.s[0], beta.s[1]}, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n, const cl_half alpha, const cl_mem a_buffer,
+                                             const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                             const size_t x_stride, const cl_half beta, cl_mem y_buffer,
+                                             const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count, cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemvStridedBatched(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n, alpha, a_buffer,
+        a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride,
+        batch_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
 // GEMM
 CLBlastStatusCode CLBlastSgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                                              const CLBlastTranspose b_transpose, const size_t m, const size_t n,
@@ -2920,6 +4169,260 @@ CLBlastStatusCode CLBlastHgemmStridedBatched(const CLBlastLayout layout, const C
   }
 }
 
+// GEMM
+CLBlastStatusCode CLBlastSgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const CLBlastTranspose b_transpose, const size_t* ms, const size_t* ns,
+                                      const size_t* ks, const float* alphas, const cl_mem a_buffer,
+                                      const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer,
+                                      const size_t* b_offsets, const size_t* b_lds, const float* betas, cl_mem c_buffer,
+                                      const size_t* c_offsets, const size_t* c_lds, const size_t group_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  auto betas_cpp = std::vector<float>();
+  for (auto entry = size_t{0}; entry < group_count; ++entry) {
+    alphas_cpp.push_back(alphas[entry]);
+    betas_cpp.push_back(betas[entry]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemmGrouped(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+        static_cast<clblast::Transpose>(b_transpose), ms, ns, ks, alphas_cpp.data(), a_buffer, a_offsets, a_lds,
+        b_buffer, b_offsets, b_lds, betas_cpp.data(), c_buffer, c_offsets, c_lds, group_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const CLBlastTranspose b_transpose, const size_t* ms, const size_t* ns,
+                                      const size_t* ks, const double* alphas, const cl_mem a_buffer,
+                                      const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer,
+                                      const size_t* b_offsets, const size_t* b_lds, const double* betas,
+                                      cl_mem c_buffer, const size_t* c_offsets, const size_t* c_lds,
+                                      const size_t group_count, cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  auto betas_cpp = std::vector<double>();
+  for (auto entry = size_t{0}; entry < group_count; ++entry) {
+    alphas_cpp.push_back(alphas[entry]);
+    betas_cpp.push_back(betas[entry]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemmGrouped(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+        static_cast<clblast::Transpose>(b_transpose), ms, ns, ks, alphas_cpp.data(), a_buffer, a_offsets, a_lds,
+        b_buffer, b_offsets, b_lds, betas_cpp.data(), c_buffer, c_offsets, c_lds, group_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastCgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const CLBlastTranspose b_transpose, const size_t* ms, const size_t* ns,
+                                      const size_t* ks, const cl_float2* alphas, const cl_mem a_buffer,
+                                      const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer,
+                                      const size_t* b_offsets, const size_t* b_lds, const cl_float2* betas,
+                                      cl_mem c_buffer, const size_t* c_offsets, const size_t* c_lds,
+                                      const size_t group_count, cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  auto betas_cpp = std::vector<float2>();
+  for (auto entry = size_t{0}; entry < group_count; ++entry) {
+    alphas_cpp.push_back(float2{alphas[entry].s[0], alphas[entry].s[1]});
+    betas_cpp.push_back(float2{betas[entry].s[0], betas[entry].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemmGrouped(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+        static_cast<clblast::Transpose>(b_transpose), ms, ns, ks, alphas_cpp.data(), a_buffer, a_offsets, a_lds,
+        b_buffer, b_offsets, b_lds, betas_cpp.data(), c_buffer, c_offsets, c_lds, group_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const CLBlastTranspose b_transpose, const size_t* ms, const size_t* ns,
+                                      const size_t* ks, const cl_double2* alphas, const cl_mem a_buffer,
+                                      const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer,
+                                      const size_t* b_offsets, const size_t* b_lds, const cl_double2* betas,
+                                      cl_mem c_buffer, const size_t* c_offsets, const size_t* c_lds,
+                                      const size_t group_count, cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  auto betas_cpp = std::vector<double2>();
+  for (auto entry = size_t{0}; entry < group_count; ++entry) {
+    alphas_cpp.push_back(double2{alphas[entry].s[0], alphas[entry].s[1]});
+    betas_cpp.push_back(double2{betas[entry].s[0], betas[entry].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemmGrouped(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+        static_cast<clblast::Transpose>(b_transpose), ms, ns, ks, alphas_cpp.data(), a_buffer, a_offsets, a_lds,
+        b_buffer, b_offsets, b_lds, betas_cpp.data(), c_buffer, c_offsets, c_lds, group_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const CLBlastTranspose b_transpose, const size_t* ms, const size_t* ns,
+                                      const size_t* ks, const cl_half* alphas, const cl_mem a_buffer,
+                                      const size_t* a_offsets, const size_t* a_lds, const cl_mem b_buffer,
+                                      const size_t* b_offsets, const size_t* b_lds, const cl_half* betas,
+                                      cl_mem c_buffer, const size_t* c_offsets, const size_t* c_lds,
+                                      const size_t group_count, cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  auto betas_cpp = std::vector<half>();
+  for (auto entry = size_t{0}; entry < group_count; ++entry) {
+    alphas_cpp.push_back(alphas[entry]);
+    betas_cpp.push_back(betas[entry]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GemmGrouped(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+        static_cast<clblast::Transpose>(b_transpose), ms, ns, ks, alphas_cpp.data(), a_buffer, a_offsets, a_lds,
+        b_buffer, b_offsets, b_lds, betas_cpp.data(), c_buffer, c_offsets, c_lds, group_count, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// GERDEFERRED
+CLBlastStatusCode CLBlastSgerDeferred(const CLBlastLayout layout, const size_t m, const size_t n, const float* alphas,
+                                      const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                      const cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t k,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  for (auto l = size_t{0}; l < k; ++l) {
+    alphas_cpp.push_back(alphas[l]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GerDeferred(
+        static_cast<clblast::Layout>(layout), m, n, alphas_cpp.data(), x_buffer, x_offsets, x_inc, y_buffer, y_offsets,
+        y_inc, a_buffer, a_offset, a_ld, k, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDgerDeferred(const CLBlastLayout layout, const size_t m, const size_t n, const double* alphas,
+                                      const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                      const cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t k,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  for (auto l = size_t{0}; l < k; ++l) {
+    alphas_cpp.push_back(alphas[l]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GerDeferred(
+        static_cast<clblast::Layout>(layout), m, n, alphas_cpp.data(), x_buffer, x_offsets, x_inc, y_buffer, y_offsets,
+        y_inc, a_buffer, a_offset, a_ld, k, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHgerDeferred(const CLBlastLayout layout, const size_t m, const size_t n, const cl_half* alphas,
+                                      const cl_mem x_buffer, const size_t* x_offsets, const size_t x_inc,
+                                      const cl_mem y_buffer, const size_t* y_offsets, const size_t y_inc,
+                                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t k,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  for (auto l = size_t{0}; l < k; ++l) {
+    alphas_cpp.push_back(alphas[l]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::GerDeferred(
+        static_cast<clblast::Layout>(layout), m, n, alphas_cpp.data(), x_buffer, x_offsets, x_inc, y_buffer, y_offsets,
+        y_inc, a_buffer, a_offset, a_ld, k, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// SYR2DEFERRED
+CLBlastStatusCode CLBlastSsyr2Deferred(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                       const float* alphas, const cl_mem x_buffer, const size_t* x_offsets,
+                                       const size_t x_inc, const cl_mem y_buffer, const size_t* y_offsets,
+                                       const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const size_t k, cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  for (auto l = size_t{0}; l < k; ++l) {
+    alphas_cpp.push_back(alphas[l]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Syr2Deferred(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Triangle>(triangle), n, alphas_cpp.data(), x_buffer,
+        x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offset, a_ld, k, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastDsyr2Deferred(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                       const double* alphas, const cl_mem x_buffer, const size_t* x_offsets,
+                                       const size_t x_inc, const cl_mem y_buffer, const size_t* y_offsets,
+                                       const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const size_t k, cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  for (auto l = size_t{0}; l < k; ++l) {
+    alphas_cpp.push_back(alphas[l]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Syr2Deferred(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Triangle>(triangle), n, alphas_cpp.data(), x_buffer,
+        x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offset, a_ld, k, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastHsyr2Deferred(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                       const cl_half* alphas, const cl_mem x_buffer, const size_t* x_offsets,
+                                       const size_t x_inc, const cl_mem y_buffer, const size_t* y_offsets,
+                                       const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const size_t k, cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  for (auto l = size_t{0}; l < k; ++l) {
+    alphas_cpp.push_back(alphas[l]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Syr2Deferred(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Triangle>(triangle), n, alphas_cpp.data(), x_buffer,
+        x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offset, a_ld, k, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// HER2DEFERRED
+CLBlastStatusCode CLBlastCher2Deferred(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                       const cl_float2* alphas, const cl_mem x_buffer, const size_t* x_offsets,
+                                       const size_t x_inc, const cl_mem y_buffer, const size_t* y_offsets,
+                                       const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const size_t k, cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  for (auto l = size_t{0}; l < k; ++l) {
+    alphas_cpp.push_back(float2{alphas[l].s[0], alphas[l].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Her2Deferred(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Triangle>(triangle), n, alphas_cpp.data(), x_buffer,
+        x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offset, a_ld, k, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+CLBlastStatusCode CLBlastZher2Deferred(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                       const cl_double2* alphas, const cl_mem x_buffer, const size_t* x_offsets,
+                                       const size_t x_inc, const cl_mem y_buffer, const size_t* y_offsets,
+                                       const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const size_t k, cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  for (auto l = size_t{0}; l < k; ++l) {
+    alphas_cpp.push_back(double2{alphas[l].s[0], alphas[l].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::Her2Deferred(
+        static_cast<clblast::Layout>(layout), static_cast<clblast::Triangle>(triangle), n, alphas_cpp.data(), x_buffer,
+        x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offset, a_ld, k, queue, event));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
 // =================================================================================================
 
 // GEMM with temporary buffer (optional, for advanced users)
@@ -3105,6 +4608,17 @@ CLBlastStatusCode CLBlastFillCache(const cl_device_id device) {
 
 // =================================================================================================
 
+// Sets the accumulation mode of the level-1 reduction routines
+CLBlastStatusCode CLBlastSetReductionMode(const CLBlastReductionMode mode) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::SetReductionMode(static_cast<clblast::ReductionMode>(mode)));
+  } catch (...) {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC());
+  }
+}
+
+// =================================================================================================
+
 // Overrides the tuning parameters for this device-precision-kernel combination
 CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device, const char* kernel_name,
                                                        const CLBlastPrecision precision, const size_t num_parameters,
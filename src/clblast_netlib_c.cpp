@@ -11,8 +11,10 @@
 
 #include "clblast_netlib_c.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <stdexcept>
+#include <vector>
 
 #include "utilities/backend.hpp"
 #include "utilities/utilities.hpp"
@@ -3650,6 +3652,482 @@ void cblas_zhad(const int n, const void* alpha, const void* x, const int x_inc,
   z_buffer.Read(queue, z_size, reinterpret_cast<double2*>(z));
 }
 
+// AXPBY
+void cblas_saxpby(const int n, const float alpha, const float* x, const int x_inc, const float beta, float* y,
+                  const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n, alpha_cpp, x_buffer(), 0, x_inc, beta_cpp, y_buffer(), 0, y_inc, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+}
+void cblas_daxpby(const int n, const double alpha, const double* x, const int x_inc, const double beta, double* y,
+                  const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n, alpha_cpp, x_buffer(), 0, x_inc, beta_cpp, y_buffer(), 0, y_inc, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+}
+void cblas_caxpby(const int n, const void* alpha, const void* x, const int x_inc, const void* beta, void* y,
+                  const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto y_buffer = clblast::Buffer<float2>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n, alpha_cpp, x_buffer(), 0, x_inc, beta_cpp, y_buffer(), 0, y_inc, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+}
+void cblas_zaxpby(const int n, const void* alpha, const void* x, const int x_inc, const void* beta, void* y,
+                  const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto y_buffer = clblast::Buffer<double2>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n, alpha_cpp, x_buffer(), 0, x_inc, beta_cpp, y_buffer(), 0, y_inc, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+}
+
+// WAXPBY
+void cblas_swaxpby(const int n, const float alpha, const float* x, const int x_inc, const float beta, const float* y,
+                   const int y_inc, float* w, const int w_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto w_size = n * w_inc;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  auto w_buffer = clblast::Buffer<float>(context, w_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
+  w_buffer.Write(queue, w_size, reinterpret_cast<float*>(w));
+  auto queue_cl = queue();
+  auto s = clblast::Waxpby(n, alpha_cpp, x_buffer(), 0, x_inc, beta_cpp, y_buffer(), 0, y_inc, w_buffer(), 0, w_inc,
+                           &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  w_buffer.Read(queue, w_size, reinterpret_cast<float*>(w));
+}
+void cblas_dwaxpby(const int n, const double alpha, const double* x, const int x_inc, const double beta,
+                   const double* y, const int y_inc, double* w, const int w_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto w_size = n * w_inc;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  auto w_buffer = clblast::Buffer<double>(context, w_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
+  w_buffer.Write(queue, w_size, reinterpret_cast<double*>(w));
+  auto queue_cl = queue();
+  auto s = clblast::Waxpby(n, alpha_cpp, x_buffer(), 0, x_inc, beta_cpp, y_buffer(), 0, y_inc, w_buffer(), 0, w_inc,
+                           &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  w_buffer.Read(queue, w_size, reinterpret_cast<double*>(w));
+}
+void cblas_cwaxpby(const int n, const void* alpha, const void* x, const int x_inc, const void* beta, const void* y,
+                   const int y_inc, void* w, const int w_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto w_size = n * w_inc;
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto y_buffer = clblast::Buffer<float2>(context, y_size);
+  auto w_buffer = clblast::Buffer<float2>(context, w_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
+  w_buffer.Write(queue, w_size, reinterpret_cast<float2*>(w));
+  auto queue_cl = queue();
+  auto s = clblast::Waxpby(n, alpha_cpp, x_buffer(), 0, x_inc, beta_cpp, y_buffer(), 0, y_inc, w_buffer(), 0, w_inc,
+                           &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  w_buffer.Read(queue, w_size, reinterpret_cast<float2*>(w));
+}
+void cblas_zwaxpby(const int n, const void* alpha, const void* x, const int x_inc, const void* beta, const void* y,
+                   const int y_inc, void* w, const int w_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto w_size = n * w_inc;
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto y_buffer = clblast::Buffer<double2>(context, y_size);
+  auto w_buffer = clblast::Buffer<double2>(context, w_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
+  w_buffer.Write(queue, w_size, reinterpret_cast<double2*>(w));
+  auto queue_cl = queue();
+  auto s = clblast::Waxpby(n, alpha_cpp, x_buffer(), 0, x_inc, beta_cpp, y_buffer(), 0, y_inc, w_buffer(), 0, w_inc,
+                           &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  w_buffer.Read(queue, w_size, reinterpret_cast<double2*>(w));
+}
+
+// GEMVBATCHED
+void cblas_sgemvbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m, const int n,
+                        const float* alphas, const float* a, const int* a_offsets, const int a_ld, const float* x,
+                        const int* x_offsets, const int x_inc, const float* betas, float* y, const int* y_offsets,
+                        const int y_inc, const int batch_count) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  auto alphas_cpp = std::vector<float>();
+  auto betas_cpp = std::vector<float>();
+  auto a_offsets_cpp = std::vector<size_t>();
+  auto x_offsets_cpp = std::vector<size_t>();
+  auto y_offsets_cpp = std::vector<size_t>();
+  auto a_offset_max = 0;
+  auto x_offset_max = 0;
+  auto y_offset_max = 0;
+  for (auto batch = 0; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+    a_offsets_cpp.push_back(static_cast<size_t>(a_offsets[batch]));
+    x_offsets_cpp.push_back(static_cast<size_t>(x_offsets[batch]));
+    y_offsets_cpp.push_back(static_cast<size_t>(y_offsets[batch]));
+    a_offset_max = std::max(a_offset_max, a_offsets[batch]);
+    x_offset_max = std::max(x_offset_max, x_offsets[batch]);
+    y_offset_max = std::max(y_offset_max, y_offsets[batch]);
+  }
+  const auto a_size = a_offset_max + ((layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld);
+  const auto x_size = x_offset_max + ((a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc);
+  const auto y_size = y_offset_max + ((a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc);
+  auto a_buffer = clblast::Buffer<float>(context, a_size);
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto queue_cl = queue();
+  auto s =
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n,
+                           alphas_cpp.data(), a_buffer(), a_offsets_cpp.data(), a_ld, x_buffer(), x_offsets_cpp.data(),
+                           x_inc, betas_cpp.data(), y_buffer(), y_offsets_cpp.data(), y_inc, batch_count, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+}
+void cblas_dgemvbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m, const int n,
+                        const double* alphas, const double* a, const int* a_offsets, const int a_ld, const double* x,
+                        const int* x_offsets, const int x_inc, const double* betas, double* y, const int* y_offsets,
+                        const int y_inc, const int batch_count) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  auto alphas_cpp = std::vector<double>();
+  auto betas_cpp = std::vector<double>();
+  auto a_offsets_cpp = std::vector<size_t>();
+  auto x_offsets_cpp = std::vector<size_t>();
+  auto y_offsets_cpp = std::vector<size_t>();
+  auto a_offset_max = 0;
+  auto x_offset_max = 0;
+  auto y_offset_max = 0;
+  for (auto batch = 0; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+    a_offsets_cpp.push_back(static_cast<size_t>(a_offsets[batch]));
+    x_offsets_cpp.push_back(static_cast<size_t>(x_offsets[batch]));
+    y_offsets_cpp.push_back(static_cast<size_t>(y_offsets[batch]));
+    a_offset_max = std::max(a_offset_max, a_offsets[batch]);
+    x_offset_max = std::max(x_offset_max, x_offsets[batch]);
+    y_offset_max = std::max(y_offset_max, y_offsets[batch]);
+  }
+  const auto a_size = a_offset_max + ((layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld);
+  const auto x_size = x_offset_max + ((a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc);
+  const auto y_size = y_offset_max + ((a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc);
+  auto a_buffer = clblast::Buffer<double>(context, a_size);
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto queue_cl = queue();
+  auto s =
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n,
+                           alphas_cpp.data(), a_buffer(), a_offsets_cpp.data(), a_ld, x_buffer(), x_offsets_cpp.data(),
+                           x_inc, betas_cpp.data(), y_buffer(), y_offsets_cpp.data(), y_inc, batch_count, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+}
+void cblas_cgemvbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m, const int n,
+                        const void* alphas, const void* a, const int* a_offsets, const int a_ld, const void* x,
+                        const int* x_offsets, const int x_inc, const void* betas, void* y, const int* y_offsets,
+                        const int y_inc, const int batch_count) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  auto alphas_cpp = std::vector<float2>();
+  auto betas_cpp = std::vector<float2>();
+  auto a_offsets_cpp = std::vector<size_t>();
+  auto x_offsets_cpp = std::vector<size_t>();
+  auto y_offsets_cpp = std::vector<size_t>();
+  auto a_offset_max = 0;
+  auto x_offset_max = 0;
+  auto y_offset_max = 0;
+  for (auto batch = 0; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{reinterpret_cast<const float*>(alphas)[2 * batch],
+                              reinterpret_cast<const float*>(alphas)[2 * batch + 1]});
+    betas_cpp.push_back(float2{reinterpret_cast<const float*>(betas)[2 * batch],
+                             reinterpret_cast<const float*>(betas)[2 * batch + 1]});
+    a_offsets_cpp.push_back(static_cast<size_t>(a_offsets[batch]));
+    x_offsets_cpp.push_back(static_cast<size_t>(x_offsets[batch]));
+    y_offsets_cpp.push_back(static_cast<size_t>(y_offsets[batch]));
+    a_offset_max = std::max(a_offset_max, a_offsets[batch]);
+    x_offset_max = std::max(x_offset_max, x_offsets[batch]);
+    y_offset_max = std::max(y_offset_max, y_offsets[batch]);
+  }
+  const auto a_size = a_offset_max + ((layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld);
+  const auto x_size = x_offset_max + ((a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc);
+  const auto y_size = y_offset_max + ((a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc);
+  auto a_buffer = clblast::Buffer<float2>(context, a_size);
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto y_buffer = clblast::Buffer<float2>(context, y_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto queue_cl = queue();
+  auto s =
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n,
+                           alphas_cpp.data(), a_buffer(), a_offsets_cpp.data(), a_ld, x_buffer(), x_offsets_cpp.data(),
+                           x_inc, betas_cpp.data(), y_buffer(), y_offsets_cpp.data(), y_inc, batch_count, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+}
+void cblas_zgemvbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m, const int n,
+                        const void* alphas, const void* a, const int* a_offsets, const int a_ld, const void* x,
+                        const int* x_offsets, const int x_inc, const void* betas, void* y, const int* y_offsets,
+                        const int y_inc, const int batch_count) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  auto alphas_cpp = std::vector<double2>();
+  auto betas_cpp = std::vector<double2>();
+  auto a_offsets_cpp = std::vector<size_t>();
+  auto x_offsets_cpp = std::vector<size_t>();
+  auto y_offsets_cpp = std::vector<size_t>();
+  auto a_offset_max = 0;
+  auto x_offset_max = 0;
+  auto y_offset_max = 0;
+  for (auto batch = 0; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{reinterpret_cast<const double*>(alphas)[2 * batch],
+                              reinterpret_cast<const double*>(alphas)[2 * batch + 1]});
+    betas_cpp.push_back(double2{reinterpret_cast<const double*>(betas)[2 * batch],
+                             reinterpret_cast<const double*>(betas)[2 * batch + 1]});
+    a_offsets_cpp.push_back(static_cast<size_t>(a_offsets[batch]));
+    x_offsets_cpp.push_back(static_cast<size_t>(x_offsets[batch]));
+    y_offsets_cpp.push_back(static_cast<size_t>(y_offsets[batch]));
+    a_offset_max = std::max(a_offset_max, a_offsets[batch]);
+    x_offset_max = std::max(x_offset_max, x_offsets[batch]);
+    y_offset_max = std::max(y_offset_max, y_offsets[batch]);
+  }
+  const auto a_size = a_offset_max + ((layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld);
+  const auto x_size = x_offset_max + ((a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc);
+  const auto y_size = y_offset_max + ((a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc);
+  auto a_buffer = clblast::Buffer<double2>(context, a_size);
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto y_buffer = clblast::Buffer<double2>(context, y_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto queue_cl = queue();
+  auto s =
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m, n,
+                           alphas_cpp.data(), a_buffer(), a_offsets_cpp.data(), a_ld, x_buffer(), x_offsets_cpp.data(),
+                           x_inc, betas_cpp.data(), y_buffer(), y_offsets_cpp.data(), y_inc, batch_count, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+}
+
+// GEMVSTRIDEDBATCHED
+void cblas_sgemvstridedbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m, const int n,
+                               const float alpha, const float* a, const int a_ld, const int a_stride, const float* x,
+                               const int x_inc, const int x_stride, const float beta, float* y, const int y_inc,
+                               const int y_stride, const int batch_count) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto a_size = a_stride * (batch_count - 1) + ((layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld);
+  const auto x_size = x_stride * (batch_count - 1) + ((a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc);
+  const auto y_size = y_stride * (batch_count - 1) + ((a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc);
+  auto a_buffer = clblast::Buffer<float>(context, a_size);
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto queue_cl = queue();
+  auto s =
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m,
+                                  n, alpha_cpp, a_buffer(), 0, a_ld, a_stride, x_buffer(), 0, x_inc, x_stride, beta_cpp,
+                                  y_buffer(), 0, y_inc, y_stride, batch_count, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+}
+void cblas_dgemvstridedbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m, const int n,
+                               const double alpha, const double* a, const int a_ld, const int a_stride, const double* x,
+                               const int x_inc, const int x_stride, const double beta, double* y, const int y_inc,
+                               const int y_stride, const int batch_count) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto a_size = a_stride * (batch_count - 1) + ((layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld);
+  const auto x_size = x_stride * (batch_count - 1) + ((a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc);
+  const auto y_size = y_stride * (batch_count - 1) + ((a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc);
+  auto a_buffer = clblast::Buffer<double>(context, a_size);
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto queue_cl = queue();
+  auto s =
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m,
+                                  n, alpha_cpp, a_buffer(), 0, a_ld, a_stride, x_buffer(), 0, x_inc, x_stride, beta_cpp,
+                                  y_buffer(), 0, y_inc, y_stride, batch_count, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+}
+void cblas_cgemvstridedbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m, const int n,
+                               const void* alpha, const void* a, const int a_ld, const int a_stride, const void* x,
+                               const int x_inc, const int x_stride, const void* beta, void* y, const int y_inc,
+                               const int y_stride, const int batch_count) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  const auto a_size = a_stride * (batch_count - 1) + ((layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld);
+  const auto x_size = x_stride * (batch_count - 1) + ((a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc);
+  const auto y_size = y_stride * (batch_count - 1) + ((a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc);
+  auto a_buffer = clblast::Buffer<float2>(context, a_size);
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto y_buffer = clblast::Buffer<float2>(context, y_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto queue_cl = queue();
+  auto s =
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m,
+                                  n, alpha_cpp, a_buffer(), 0, a_ld, a_stride, x_buffer(), 0, x_inc, x_stride, beta_cpp,
+                                  y_buffer(), 0, y_inc, y_stride, batch_count, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+}
+void cblas_zgemvstridedbatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m, const int n,
+                               const void* alpha, const void* a, const int a_ld, const int a_stride, const void* x,
+                               const int x_inc, const int x_stride, const void* beta, void* y, const int y_inc,
+                               const int y_stride, const int batch_count) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  const auto a_size = a_stride * (batch_count - 1) + ((layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld);
+  const auto x_size = x_stride * (batch_count - 1) + ((a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc);
+  const auto y_size = y_stride * (batch_count - 1) + ((a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc);
+  auto a_buffer = clblast::Buffer<double2>(context, a_size);
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto y_buffer = clblast::Buffer<double2>(context, y_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto queue_cl = queue();
+  auto s =
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), m,
+                                  n, alpha_cpp, a_buffer(), 0, a_ld, a_stride, x_buffer(), 0, x_inc, x_stride, beta_cpp,
+                                  y_buffer(), 0, y_inc, y_stride, batch_count, &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+}
+
 // OMATCOPY
 void cblas_somatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const int m, const int n,
                      const float alpha, const float* a, const int a_ld, float* b, const int b_ld) {
@@ -759,6 +759,13 @@ class Buffer {
     queue.Finish();
   }
 
+  // As above, but copies from and into the given element offsets of the two buffers
+  void CopyToAsync(const Queue& queue, const size_t size, const Buffer<T>& destination, const size_t offset,
+                   const size_t destination_offset, EventPointer event = nullptr) const {
+    CheckError(clEnqueueCopyBuffer(queue(), *buffer_, destination(), offset * sizeof(T), destination_offset * sizeof(T),
+                                   size * sizeof(T), 0, nullptr, event));
+  }
+
   // Retrieves the actual allocated size in bytes
   size_t GetSize() const {
     const auto bytes = sizeof(size_t);
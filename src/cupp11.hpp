@@ -671,6 +671,13 @@ class Buffer {
     queue.Finish();
   }
 
+  // As above, but copies from and into the given element offsets of the two buffers
+  void CopyToAsync(const Queue& queue, const size_t size, const Buffer<T>& destination, const size_t offset,
+                   const size_t destination_offset, EventPointer event = nullptr) const {
+    CheckError(cuMemcpyDtoDAsync(destination() + destination_offset * sizeof(T), *buffer_ + offset * sizeof(T),
+                                 size * sizeof(T), queue()));
+  }
+
   // Retrieves the actual allocated size in bytes
   size_t GetSize() const {
     auto result = size_t{0};
@@ -28,10 +28,10 @@ const DatabaseEntry XaxpyApple = {
 const DatabaseEntry XdotApple = {
     "Xdot",
     Precision::kAny,
-    {"WGS1", "WGS2"},
+    {"SINGLE_PASS", "WGS1", "WGS2"},
     {{kDeviceTypeAll,
       "default",
-      {{"default", {{kDeviceNameDefault, Params{1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}}}}}};
+      {{"default", {{kDeviceNameDefault, Params{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}}}}}};
 const DatabaseEntry XgemvApple = {
     "Xgemv",
     Precision::kAny,
@@ -53,6 +53,34 @@ const DatabaseEntry XgemvFastRotApple = {
     {{kDeviceTypeAll,
       "default",
       {{"default", {{kDeviceNameDefault, Params{1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}}}}}};
+const DatabaseEntry XgbmvApple = {
+    "Xgbmv",
+    Precision::kAny,
+    {"DIAGS", "WGS"},
+    {{kDeviceTypeAll,
+      "default",
+      {{"default", {{kDeviceNameDefault, Params{1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}}}}}};
+const DatabaseEntry XsymvApple = {
+    "Xsymv",
+    Precision::kAny,
+    {"SLOTS", "WGS"},
+    {{kDeviceTypeAll,
+      "default",
+      {{"default", {{kDeviceNameDefault, Params{16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}}}}}};
+const DatabaseEntry XsprApple = {
+    "Xspr",
+    Precision::kAny,
+    {"WGS", "WPT"},
+    {{kDeviceTypeAll,
+      "default",
+      {{"default", {{kDeviceNameDefault, Params{1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}}}}}};
+const DatabaseEntry XdgmmApple = {
+    "Xdgmm",
+    Precision::kAny,
+    {"DGMM_DIMX", "DGMM_DIMY", "DGMM_WPTX", "DGMM_WPTY"},
+    {{kDeviceTypeAll,
+      "default",
+      {{"default", {{kDeviceNameDefault, Params{1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}}}}}};
 const DatabaseEntry XgerApple = {
     "Xger",
     Precision::kAny,
@@ -131,6 +159,20 @@ const DatabaseEntry TrsvRoutineApple = {
     {{kDeviceTypeAll,
       "default",
       {{"default", {{kDeviceNameDefault, Params{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}}}}}};
+const DatabaseEntry TrsmRoutineApple = {
+    "TrsmRoutine",
+    Precision::kAny,
+    {"TRSM_BLOCK_SIZE"},
+    {{kDeviceTypeAll,
+      "default",
+      {{"default", {{kDeviceNameDefault, Params{16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}}}}}};
+const DatabaseEntry TrmmRoutineApple = {
+    "TrmmRoutine",
+    Precision::kAny,
+    {"TRMM_BLOCK_SIZE"},
+    {{kDeviceTypeAll,
+      "default",
+      {{"default", {{kDeviceNameDefault, Params{64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}}}}}};
 
 // =================================================================================================
 }  // namespace database
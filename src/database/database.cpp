@@ -23,16 +23,22 @@
 #include "database/kernels/pad/pad.hpp"
 #include "database/kernels/padtranspose/padtranspose.hpp"
 #include "database/kernels/transpose/transpose.hpp"
+#include "database/kernels/trmm_routine/trmm_routine.hpp"
+#include "database/kernels/trsm_routine/trsm_routine.hpp"
 #include "database/kernels/trsv_routine/trsv_routine.hpp"
 #include "database/kernels/xaxpy/xaxpy.hpp"
 #include "database/kernels/xconvgemm/xconvgemm.hpp"
+#include "database/kernels/xdgmm/xdgmm.hpp"
 #include "database/kernels/xdot/xdot.hpp"
+#include "database/kernels/xgbmv/xgbmv.hpp"
 #include "database/kernels/xgemm/xgemm.hpp"
 #include "database/kernels/xgemm_direct/xgemm_direct.hpp"
 #include "database/kernels/xgemv/xgemv.hpp"
 #include "database/kernels/xgemv_fast/xgemv_fast.hpp"
 #include "database/kernels/xgemv_fast_rot/xgemv_fast_rot.hpp"
 #include "database/kernels/xger/xger.hpp"
+#include "database/kernels/xspr/xspr.hpp"
+#include "database/kernels/xsymv/xsymv.hpp"
 #include "utilities/backend.hpp"
 #include "utilities/clblast_exceptions.hpp"
 #include "utilities/utilities.hpp"
@@ -45,7 +51,9 @@ const std::vector<database::DatabaseEntry> Database::apple_cpu_fallback = std::v
     database::XaxpyApple,        database::XdotApple,         database::XgemvApple,  database::XgemvFastApple,
     database::XgemvFastRotApple, database::XgerApple,         database::XtrsvApple,  database::XgemmApple,
     database::XgemmDirectApple,  database::XconvgemmApple,    database::CopyApple,   database::PadApple,
-    database::TransposeApple,    database::PadtransposeApple, database::InvertApple, database::TrsvRoutineApple};
+    database::TransposeApple,    database::PadtransposeApple, database::InvertApple, database::TrsvRoutineApple,
+    database::TrsmRoutineApple,  database::XgbmvApple,        database::XsymvApple,  database::XsprApple,
+    database::XdgmmApple,        database::TrmmRoutineApple};
 
 // The default values
 const std::string Database::kDeviceVendorAll = "default";
@@ -84,11 +92,31 @@ Database::Database(const Device& device, const std::string& kernel_name, const P
                                                     database::XgemvFastRotDouble,
                                                     database::XgemvFastRotComplexSingle,
                                                     database::XgemvFastRotComplexDouble,
+                                                    database::XgbmvHalf,
+                                                    database::XgbmvSingle,
+                                                    database::XgbmvDouble,
+                                                    database::XgbmvComplexSingle,
+                                                    database::XgbmvComplexDouble,
+                                                    database::XsymvHalf,
+                                                    database::XsymvSingle,
+                                                    database::XsymvDouble,
+                                                    database::XsymvComplexSingle,
+                                                    database::XsymvComplexDouble,
                                                     database::XgerHalf,
                                                     database::XgerSingle,
                                                     database::XgerDouble,
                                                     database::XgerComplexSingle,
                                                     database::XgerComplexDouble,
+                                                    database::XsprHalf,
+                                                    database::XsprSingle,
+                                                    database::XsprDouble,
+                                                    database::XsprComplexSingle,
+                                                    database::XsprComplexDouble,
+                                                    database::XdgmmHalf,
+                                                    database::XdgmmSingle,
+                                                    database::XdgmmDouble,
+                                                    database::XdgmmComplexSingle,
+                                                    database::XdgmmComplexDouble,
                                                     database::XgemmHalf,
                                                     database::XgemmSingle,
                                                     database::XgemmDouble,
@@ -138,7 +166,17 @@ Database::Database(const Device& device, const std::string& kernel_name, const P
                                                     database::TrsvRoutineSingle,
                                                     database::TrsvRoutineDouble,
                                                     database::TrsvRoutineComplexSingle,
-                                                    database::TrsvRoutineComplexDouble};
+                                                    database::TrsvRoutineComplexDouble,
+                                                    database::TrsmRoutineHalf,
+                                                    database::TrsmRoutineSingle,
+                                                    database::TrsmRoutineDouble,
+                                                    database::TrsmRoutineComplexSingle,
+                                                    database::TrsmRoutineComplexDouble,
+                                                    database::TrmmRoutineHalf,
+                                                    database::TrmmRoutineSingle,
+                                                    database::TrmmRoutineDouble,
+                                                    database::TrmmRoutineComplexSingle,
+                                                    database::TrmmRoutineComplexDouble};
   }
 
   // Finds device information
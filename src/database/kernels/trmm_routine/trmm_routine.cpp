@@ -0,0 +1,16 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Trmm_Routine' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/trmm_routine/trmm_routine.hpp"
+
+#include "database/kernels/trmm_routine/trmm_routine_16.hpp"
+#include "database/kernels/trmm_routine/trmm_routine_32.hpp"
+#include "database/kernels/trmm_routine/trmm_routine_3232.hpp"
+#include "database/kernels/trmm_routine/trmm_routine_64.hpp"
+#include "database/kernels/trmm_routine/trmm_routine_6464.hpp"
@@ -0,0 +1,25 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Trsm_Routine6464' kernels.
+//
+// =================================================================================================
+#include "database/kernels/trsm_routine/trsm_routine.hpp"
+namespace clblast {
+namespace database {
+
+const DatabaseEntry TrsmRoutineComplexDouble = {
+  "TrsmRoutine", Precision::kComplexDouble, {"TRSM_BLOCK_SIZE"}, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default", {
+          { kDeviceNameDefault                                        , Params{ 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } },
+        } },
+      }
+    },
+  }
+};
+
+} // namespace database
+} // namespace clblast
@@ -0,0 +1,16 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Xdgmm' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/xdgmm/xdgmm.hpp"
+
+#include "database/kernels/xdgmm/xdgmm_16.hpp"
+#include "database/kernels/xdgmm/xdgmm_32.hpp"
+#include "database/kernels/xdgmm/xdgmm_3232.hpp"
+#include "database/kernels/xdgmm/xdgmm_64.hpp"
+#include "database/kernels/xdgmm/xdgmm_6464.hpp"
@@ -0,0 +1,25 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Xdgmm3232' kernels.
+//
+// =================================================================================================
+#include "database/kernels/xdgmm/xdgmm.hpp"
+namespace clblast {
+namespace database {
+
+const DatabaseEntry XdgmmComplexSingle = {
+  "Xdgmm", Precision::kComplexSingle, {"DGMM_DIMX", "DGMM_DIMY", "DGMM_WPTX", "DGMM_WPTY"}, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default", {
+          { kDeviceNameDefault                                        , Params{ 8, 8, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } },
+        } },
+      }
+    },
+  }
+};
+
+} // namespace database
+} // namespace clblast
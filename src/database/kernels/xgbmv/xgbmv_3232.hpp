@@ -0,0 +1,25 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Xgbmv3232' kernels.
+//
+// =================================================================================================
+#include "database/kernels/xgbmv/xgbmv.hpp"
+namespace clblast {
+namespace database {
+
+const DatabaseEntry XgbmvComplexSingle = {
+  "Xgbmv", Precision::kComplexSingle, {"DIAGS", "WGS"}, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default", {
+          { kDeviceNameDefault                                        , Params{ 8, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } },
+        } },
+      }
+    },
+  }
+};
+
+} // namespace database
+} // namespace clblast
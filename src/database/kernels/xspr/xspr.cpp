@@ -0,0 +1,16 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Xspr' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/xspr/xspr.hpp"
+
+#include "database/kernels/xspr/xspr_16.hpp"
+#include "database/kernels/xspr/xspr_32.hpp"
+#include "database/kernels/xspr/xspr_3232.hpp"
+#include "database/kernels/xspr/xspr_64.hpp"
+#include "database/kernels/xspr/xspr_6464.hpp"
@@ -0,0 +1,25 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Xspr3232' kernels.
+//
+// =================================================================================================
+#include "database/kernels/xspr/xspr.hpp"
+namespace clblast {
+namespace database {
+
+const DatabaseEntry XsprComplexSingle = {
+  "Xspr", Precision::kComplexSingle, {"WGS", "WPT"}, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default", {
+          { kDeviceNameDefault                                        , Params{ 64, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } },
+        } },
+      }
+    },
+  }
+};
+
+} // namespace database
+} // namespace clblast
@@ -76,6 +76,10 @@ typedef struct { double s0; double s1; double s2; double s3;
 
 // Replaces OpenCL synchronisation with CUDA synchronisation
 #define barrier(x) __syncthreads()
+#define mem_fence(x) __threadfence()
+
+// Replaces OpenCL atomics with CUDA atomics
+#define atomic_inc(x) atomicAdd(x, 1)
 
 // =================================================================================================
 
@@ -27,17 +27,21 @@ namespace clblast {
 // =================================================================================================
 
 // For each kernel this map contains a list of routines it is used in
-const std::vector<std::string> Routine::routines_axpy = {"AXPY", "COPY", "SCAL", "SWAP"};
-const std::vector<std::string> Routine::routines_dot = {"AMAX", "ASUM", "DOT",  "DOTC", "DOTU",
-                                                        "MAX",  "MIN",  "NRM2", "SUM"};
-const std::vector<std::string> Routine::routines_ger = {"GER",  "GERC", "GERU", "HER", "HER2", "HPR",
-                                                        "HPR2", "SPR",  "SPR2", "SYR", "SYR2"};
-const std::vector<std::string> Routine::routines_gemv = {"GBMV", "GEMV", "HBMV", "HEMV", "HPMV", "SBMV",
-                                                         "SPMV", "SYMV", "TMBV", "TPMV", "TRMV", "TRSV"};
+const std::vector<std::string> Routine::routines_axpy = {"AXPBY", "AXPY", "COPY", "ELEMENTWISE", "ROT",
+                                                         "ROTM",  "SCAL", "SWAP", "WAXPBY"};
+const std::vector<std::string> Routine::routines_dot = {"AMAX",      "ASUM", "DOT", "DOTC", "DOTU",
+                                                        "MAPREDUCE", "MAX",  "MIN", "NRM2", "SUM"};
+const std::vector<std::string> Routine::routines_ger = {"GER", "GERC", "GERU", "HER", "HER2", "SYR", "SYR2"};
+const std::vector<std::string> Routine::routines_spr = {"HPR", "HPR2", "SPR", "SPR2"};
+const std::vector<std::string> Routine::routines_dgmm = {"DGMM"};
+const std::vector<std::string> Routine::routines_gemv = {"GEMV", "TBSV", "TPMV", "TPSV", "TRMV", "TRSV"};
+const std::vector<std::string> Routine::routines_gbmv = {"GBMV", "HBMV", "SBMV", "TBMV"};
+const std::vector<std::string> Routine::routines_symv = {"HEMV", "HPMV", "SPMV", "SYMV"};
 const std::vector<std::string> Routine::routines_gemm = {"GEMM", "HEMM", "SYMM", "TRMM"};
 const std::vector<std::string> Routine::routines_gemm_syrk = {"GEMM",  "HEMM", "HER2K", "HERK", "SYMM",
                                                               "SYR2K", "SYRK", "TRMM",  "TRSM"};
 const std::vector<std::string> Routine::routines_trsm = {"TRSM"};
+const std::vector<std::string> Routine::routines_trmm = {"TRMM"};
 const std::unordered_map<std::string, const std::vector<std::string>> Routine::routines_by_kernel = {
     {"Xaxpy", routines_axpy},
     {"Xdot", routines_dot},
@@ -45,15 +49,21 @@ const std::unordered_map<std::string, const std::vector<std::string>> Routine::r
     {"XgemvFast", routines_gemv},
     {"XgemvFastRot", routines_gemv},
     {"Xtrsv", routines_gemv},
+    {"Xgbmv", routines_gbmv},
+    {"Xsymv", routines_symv},
     {"Xger", routines_ger},
+    {"Xspr", routines_spr},
+    {"Xdgmm", routines_dgmm},
     {"Copy", routines_gemm_syrk},
     {"Pad", routines_gemm_syrk},
     {"Transpose", routines_gemm_syrk},
     {"Padtranspose", routines_gemm_syrk},
     {"Xgemm", routines_gemm_syrk},
-    {"XgemmDirect", routines_gemm},
-    {"GemmRoutine", routines_gemm},
+    {"XgemmDirect", routines_gemm_syrk},
+    {"GemmRoutine", routines_gemm_syrk},
     {"Invert", routines_trsm},
+    {"TrsmRoutine", routines_trsm},
+    {"TrmmRoutine", routines_trmm},
 };
 // =================================================================================================
 
@@ -61,9 +71,17 @@ const std::unordered_map<std::string, const std::vector<std::string>> Routine::r
 Routine::Routine(Queue& queue, EventPointer event, const std::string& name,
                  const std::vector<std::string>& kernel_names, const Precision precision,
                  const std::vector<database::DatabaseEntry>& userDatabase, std::initializer_list<const char*> source)
+    : Routine(queue, event, name, kernel_names, precision, userDatabase, std::string{}, false, source) {}
+
+Routine::Routine(Queue& queue, EventPointer event, const std::string& name,
+                 const std::vector<std::string>& kernel_names, const Precision precision,
+                 const std::vector<database::DatabaseEntry>& userDatabase, const std::string& source_key,
+                 const bool device_scalars, std::initializer_list<const char*> source)
     : precision_(precision),
       routine_name_(name),
       kernel_names_(kernel_names),
+      source_key_(source_key),
+      device_scalars_(device_scalars),
       queue_(queue),
       event_(event),
       context_(queue_.GetContext()),
@@ -79,6 +97,12 @@ void Routine::InitProgram(std::initializer_list<const char*> source) {
   for (const auto& kernel_name : kernel_names_) {
     routine_info += "_" + kernel_name + db_(kernel_name).GetValuesString();
   }
+  if (!source_key_.empty()) {
+    routine_info += "_" + source_key_;
+  }
+  if (device_scalars_) {
+    routine_info += "_DEVICE_SCALARS";
+  }
   log_debug(routine_info);
 
   // Queries the cache to see whether or not the program (context-specific) is already there
@@ -137,7 +161,8 @@ void Routine::InitProgram(std::initializer_list<const char*> source) {
   }
 
   // Completes the source and compiles the kernel
-  program_ = CompileFromSource(source_string, precision_, routine_name_, device_, context_, options, 0);
+  program_ = CompileFromSource(source_string, precision_, routine_name_, device_, context_, options, 0, false,
+                               device_scalars_);
 
   // Store the compiled binary and program in the cache
   BinaryCache::Instance().Store(BinaryKey{platform_id, precision_, routine_info, device_name}, program_->GetIR());
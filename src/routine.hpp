@@ -61,14 +61,27 @@ class Routine {
                    const Precision precision, const std::vector<database::DatabaseEntry>& userDatabase,
                    std::initializer_list<const char*> source);
 
+  // As above, but for routines with a kernel generated at run-time or with device-side scalars. The
+  // 'source_key' identifies the generated part of the source and is part of the keys of the program
+  // and binary caches. With 'device_scalars' set, the kernels read their scalar arguments (e.g.
+  // alpha and beta) from device memory instead of receiving them by value.
+  explicit Routine(Queue& queue, EventPointer event, const std::string& name, const std::vector<std::string>& routines,
+                   const Precision precision, const std::vector<database::DatabaseEntry>& userDatabase,
+                   const std::string& source_key, const bool device_scalars, std::initializer_list<const char*> source);
+
   // List of kernel-routine look-ups
   static const std::vector<std::string> routines_axpy;
   static const std::vector<std::string> routines_dot;
   static const std::vector<std::string> routines_ger;
+  static const std::vector<std::string> routines_spr;
+  static const std::vector<std::string> routines_dgmm;
   static const std::vector<std::string> routines_gemv;
+  static const std::vector<std::string> routines_gbmv;
+  static const std::vector<std::string> routines_symv;
   static const std::vector<std::string> routines_gemm;
   static const std::vector<std::string> routines_gemm_syrk;
   static const std::vector<std::string> routines_trsm;
+  static const std::vector<std::string> routines_trmm;
   static const std::unordered_map<std::string, const std::vector<std::string>> routines_by_kernel;
 
  private:
@@ -82,6 +95,8 @@ class Routine {
   // The routine's name and the corresponding kernels
   const std::string routine_name_;
   const std::vector<std::string> kernel_names_;
+  const std::string source_key_;
+  const bool device_scalars_;
 
   // The OpenCL objects, accessible only from derived classes
   Queue queue_;
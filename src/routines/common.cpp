@@ -9,6 +9,7 @@
 
 #include "routines/common.hpp"
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <vector>
@@ -84,6 +85,100 @@ void RunKernel(Kernel& kernel, Queue& queue, const Device& device, std::vector<s
 #endif
 }
 
+// Creates a single-element counter buffer, set to zero through an asynchronous write. The source is
+// static, such that it remains valid until the copy has actually taken place.
+Buffer<unsigned int> CreateWorkGroupCounter(const Context& context, Queue& queue) {
+  static const auto kZero = 0u;
+  auto counter_buffer = Buffer<unsigned int>(context, 1);
+  counter_buffer.WriteAsync(queue, 1, &kZero);
+  return counter_buffer;
+}
+
+// =================================================================================================
+
+// The accumulation mode is a global setting, which can be changed from any thread
+namespace {
+std::atomic<ReductionMode>& CurrentReductionMode() {
+  static std::atomic<ReductionMode> mode{ReductionMode::kDefault};
+  return mode;
+}
+}  // namespace
+
+ReductionMode GetCurrentReductionMode() { return CurrentReductionMode().load(); }
+
+void SetCurrentReductionMode(const ReductionMode mode) { CurrentReductionMode().store(mode); }
+
+// The temporary buffer holds the partial results of all but the last reduction step behind each other
+size_t ReproducibleReductionTempSize(const size_t n) {
+  auto temp_size = size_t{1};
+  for (auto num_blocks = CeilDiv(n, kReproducibleBlockSize); num_blocks > 1;
+       num_blocks = CeilDiv(num_blocks, kReproducibleBlockSize)) {
+    temp_size += num_blocks;
+  }
+  return temp_size;
+}
+
+// Runs the main kernel with one work-group per block, followed by as many reduction steps as needed
+template <typename T>
+void RunReproducibleReduction(Queue& queue, const Device& device, const std::shared_ptr<Program> program,
+                              EventPointer event, Kernel& kernel, const size_t n, const size_t local_size,
+                              const Buffer<T>& temp_buffer, const Buffer<T>& result_buffer,
+                              const size_t result_offset) {
+  auto num_blocks = CeilDiv(n, kReproducibleBlockSize);
+  auto local = std::vector<size_t>{local_size};
+  auto global = std::vector<size_t>{num_blocks * local_size};
+  if (num_blocks == 1) {
+    RunKernel(kernel, queue, device, global, local, event);
+    return;
+  }
+  auto eventWaitList = std::vector<Event>();
+  auto kernel_event = Event();
+  RunKernel(kernel, queue, device, global, local, kernel_event.pointer());
+  eventWaitList.push_back(kernel_event);
+
+  // Each step reads the results of the previous step and stores its own results right behind them
+  auto input_offset = size_t{0};
+  while (num_blocks > 1) {
+    const auto num_values = num_blocks;
+    const auto output_offset = input_offset + num_values;
+    num_blocks = CeilDiv(num_values, kReproducibleBlockSize);
+    auto reduce_kernel = Kernel(program, "XreduceReproducible");
+    reduce_kernel.SetArgument(0, static_cast<int>(num_values));
+    reduce_kernel.SetArgument(1, temp_buffer());
+    reduce_kernel.SetArgument(2, static_cast<int>(input_offset));
+    reduce_kernel.SetArgument(3, temp_buffer());
+    reduce_kernel.SetArgument(4, static_cast<int>(output_offset));
+    reduce_kernel.SetArgument(5, result_buffer());
+    reduce_kernel.SetArgument(6, static_cast<int>(result_offset));
+    global = std::vector<size_t>{num_blocks * local_size};
+    if (num_blocks == 1) {
+      RunKernel(reduce_kernel, queue, device, global, local, event, eventWaitList);
+    } else {
+      auto reduce_event = Event();
+      RunKernel(reduce_kernel, queue, device, global, local, reduce_event.pointer(), eventWaitList);
+      eventWaitList = {reduce_event};
+    }
+    input_offset = output_offset;
+  }
+}
+
+// Compiles the above function
+template void RunReproducibleReduction<half>(Queue&, const Device&, const std::shared_ptr<Program>, EventPointer,
+                                             Kernel&, const size_t, const size_t, const Buffer<half>&,
+                                             const Buffer<half>&, const size_t);
+template void RunReproducibleReduction<float>(Queue&, const Device&, const std::shared_ptr<Program>, EventPointer,
+                                              Kernel&, const size_t, const size_t, const Buffer<float>&,
+                                              const Buffer<float>&, const size_t);
+template void RunReproducibleReduction<double>(Queue&, const Device&, const std::shared_ptr<Program>, EventPointer,
+                                               Kernel&, const size_t, const size_t, const Buffer<double>&,
+                                               const Buffer<double>&, const size_t);
+template void RunReproducibleReduction<float2>(Queue&, const Device&, const std::shared_ptr<Program>, EventPointer,
+                                               Kernel&, const size_t, const size_t, const Buffer<float2>&,
+                                               const Buffer<float2>&, const size_t);
+template void RunReproducibleReduction<double2>(Queue&, const Device&, const std::shared_ptr<Program>, EventPointer,
+                                                Kernel&, const size_t, const size_t, const Buffer<double2>&,
+                                                const Buffer<double2>&, const size_t);
+
 // =================================================================================================
 
 // Sets all elements of a matrix to a constant value
@@ -153,5 +248,86 @@ template void FillVector<double2>(Queue&, const Device&, const std::shared_ptr<P
                                   const std::vector<Event>&, const size_t, const size_t, const size_t,
                                   const Buffer<double2>&, const double2, const size_t);
 
+// =================================================================================================
+
+// In-place triangular matrix-vector multiplication
+template <typename T>
+void TriangularMatVec(Queue& queue, const Device& device, const Context& context,
+                      const std::shared_ptr<Program> program, EventPointer event, const size_t n, const size_t k,
+                      const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer,
+                      const size_t x_offset, const size_t x_inc, const bool a_rotated, const bool a_conjugate,
+                      const size_t parameter, const size_t local_size) {
+  const auto num_blocks = CeilDiv(n, local_size);
+  auto local = std::vector<size_t>{local_size};
+  auto global = std::vector<size_t>{num_blocks * local_size};
+
+  // The kernel for the blocks on the diagonal, which overwrites x
+  auto kernel = Kernel(program, "XtrmvDiagonal");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(k));
+  kernel.SetArgument(2, a_buffer());
+  kernel.SetArgument(3, static_cast<int>(a_offset));
+  kernel.SetArgument(4, static_cast<int>(a_ld));
+  kernel.SetArgument(5, x_buffer());
+  kernel.SetArgument(6, static_cast<int>(x_offset));
+  kernel.SetArgument(7, static_cast<int>(x_inc));
+  kernel.SetArgument(10, static_cast<int>(a_rotated));
+  kernel.SetArgument(11, static_cast<int>(a_conjugate));
+  kernel.SetArgument(12, static_cast<int>(parameter));
+
+  // In case x consists of a single block, the result is computed directly without a workspace
+  if (num_blocks == 1) {
+    kernel.SetArgument(8, x_buffer());  // unused
+    kernel.SetArgument(9, 0);
+    RunKernel(kernel, queue, device, global, local, event);
+    return;
+  }
+
+  // Otherwise, the contributions of the off-diagonal blocks are first computed into a workspace
+  auto w_buffer = Buffer<T>(context, n);
+  auto off_diagonal_kernel = Kernel(program, "XtrmvOffDiagonal");
+  off_diagonal_kernel.SetArgument(0, static_cast<int>(n));
+  off_diagonal_kernel.SetArgument(1, static_cast<int>(k));
+  off_diagonal_kernel.SetArgument(2, a_buffer());
+  off_diagonal_kernel.SetArgument(3, static_cast<int>(a_offset));
+  off_diagonal_kernel.SetArgument(4, static_cast<int>(a_ld));
+  off_diagonal_kernel.SetArgument(5, x_buffer());
+  off_diagonal_kernel.SetArgument(6, static_cast<int>(x_offset));
+  off_diagonal_kernel.SetArgument(7, static_cast<int>(x_inc));
+  off_diagonal_kernel.SetArgument(8, w_buffer());
+  off_diagonal_kernel.SetArgument(9, static_cast<int>(a_rotated));
+  off_diagonal_kernel.SetArgument(10, static_cast<int>(a_conjugate));
+  off_diagonal_kernel.SetArgument(11, static_cast<int>(parameter));
+  auto off_diagonal_event = Event();
+  RunKernel(off_diagonal_kernel, queue, device, global, local, off_diagonal_event.pointer());
+
+  kernel.SetArgument(8, w_buffer());
+  kernel.SetArgument(9, 1);
+  auto eventWaitList = std::vector<Event>{off_diagonal_event};
+  RunKernel(kernel, queue, device, global, local, event, eventWaitList);
+}
+
+// Compiles the above function
+template void TriangularMatVec<half>(Queue&, const Device&, const Context&, const std::shared_ptr<Program>,
+                                     EventPointer, const size_t, const size_t, const Buffer<half>&, const size_t,
+                                     const size_t, const Buffer<half>&, const size_t, const size_t, const bool,
+                                     const bool, const size_t, const size_t);
+template void TriangularMatVec<float>(Queue&, const Device&, const Context&, const std::shared_ptr<Program>,
+                                      EventPointer, const size_t, const size_t, const Buffer<float>&, const size_t,
+                                      const size_t, const Buffer<float>&, const size_t, const size_t, const bool,
+                                      const bool, const size_t, const size_t);
+template void TriangularMatVec<double>(Queue&, const Device&, const Context&, const std::shared_ptr<Program>,
+                                       EventPointer, const size_t, const size_t, const Buffer<double>&, const size_t,
+                                       const size_t, const Buffer<double>&, const size_t, const size_t, const bool,
+                                       const bool, const size_t, const size_t);
+template void TriangularMatVec<float2>(Queue&, const Device&, const Context&, const std::shared_ptr<Program>,
+                                       EventPointer, const size_t, const size_t, const Buffer<float2>&, const size_t,
+                                       const size_t, const Buffer<float2>&, const size_t, const size_t, const bool,
+                                       const bool, const size_t, const size_t);
+template void TriangularMatVec<double2>(Queue&, const Device&, const Context&, const std::shared_ptr<Program>,
+                                        EventPointer, const size_t, const size_t, const Buffer<double2>&, const size_t,
+                                        const size_t, const Buffer<double2>&, const size_t, const size_t, const bool,
+                                        const bool, const size_t, const size_t);
+
 // =================================================================================================
 }  // namespace clblast
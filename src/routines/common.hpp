@@ -28,6 +28,32 @@ namespace clblast {
 void RunKernel(Kernel& kernel, Queue& queue, const Device& device, std::vector<size_t> global,
                const std::vector<size_t>& local, EventPointer event, const std::vector<Event>& waitForEvents = {});
 
+// Creates the counter of finished work-groups as used by the single-pass reduction kernels (see
+// 'IsLastWorkGroup' in common.opencl). The zero-initialisation is enqueued without waiting for it.
+Buffer<unsigned int> CreateWorkGroupCounter(const Context& context, Queue& queue);
+
+// =================================================================================================
+
+// Retrieves or changes the accumulation mode of the level-1 reduction routines for all devices
+ReductionMode GetCurrentReductionMode();
+void SetCurrentReductionMode(const ReductionMode mode);
+
+// The block size of the reproducible reductions. This is fixed, such that the order of summation
+// does not depend on the tuning parameters (see 'reproducible.opencl').
+constexpr size_t kReproducibleBlockSize = 1024;
+
+// Retrieves the size of the temporary buffer for the partial results of a reproducible reduction
+size_t ReproducibleReductionTempSize(const size_t n);
+
+// Runs a reproducible reduction of 'n' values. The routine-specific main 'kernel' has all its
+// arguments set already and stores its per-block results at the start of 'temp_buffer'. These are
+// reduced further by the 'XreduceReproducible' kernel until the final result is stored.
+template <typename T>
+void RunReproducibleReduction(Queue& queue, const Device& device, const std::shared_ptr<Program> program,
+                              EventPointer event, Kernel& kernel, const size_t n, const size_t local_size,
+                              const Buffer<T>& temp_buffer, const Buffer<T>& result_buffer,
+                              const size_t result_offset);
+
 // =================================================================================================
 
 // Sets all elements of a matrix to a constant value
@@ -44,6 +70,53 @@ void FillVector(Queue& queue, const Device& device, const std::shared_ptr<Progra
 
 // =================================================================================================
 
+// A scalar argument of a routine (e.g. alpha or beta): either a value, or for the versions of the
+// routines with device-side scalars, a value in device memory. In the latter case the kernels are
+// compiled with DEVICE_SCALARS set and read the first element of 'buffer' (see 'common.opencl').
+template <typename T>
+struct ScalarArgument {
+  // Scalar given by value. This is implicit, such that the routines can still be called with a 'T'.
+  ScalarArgument(const T scalar_value) : value(scalar_value), buffer(0), on_device(false) {}  // NOLINT
+
+  // Scalar stored in device memory at 'offset' in 'scalar_buffer'. A scalar at a non-zero offset is
+  // copied into a new buffer first. The copy is enqueued without waiting for it, such that the scalar
+  // can be the result of a preceding routine on the same queue.
+  ScalarArgument(const Context& context, Queue& queue, const Buffer<T>& scalar_buffer, const size_t offset)
+      : value(ConstantZero<T>()), buffer((offset == 0) ? scalar_buffer : Buffer<T>(context, 1)), on_device(true) {
+    if (offset != 0) {
+      scalar_buffer.CopyToAsync(queue, 1, buffer, offset, 0);
+    }
+  }
+
+  T value;           // Only valid if the scalar is not in device memory
+  Buffer<T> buffer;  // Only valid if the scalar is in device memory
+  bool on_device;
+};
+
+// Sets a scalar kernel argument, either by value or as a pointer to device memory
+template <typename T>
+void SetScalarArgument(Kernel& kernel, const size_t index, const ScalarArgument<T>& scalar) {
+  if (scalar.on_device) {
+    kernel.SetArgument(index, scalar.buffer());
+  } else {
+    kernel.SetArgument(index, GetRealArg(scalar.value));
+  }
+}
+
+// =================================================================================================
+
+// Computes the in-place triangular matrix-vector multiplication x = A * x of the TRMV, TPMV and TBMV routines
+// without a copy of x (see 'xtrmv.opencl'). The matrix is accessed as in the Xgemv and Xgbmv kernels, in which 'k' is
+// the number of sub/super-diagonals of a banded matrix and 'n' otherwise.
+template <typename T>
+void TriangularMatVec(Queue& queue, const Device& device, const Context& context,
+                      const std::shared_ptr<Program> program, EventPointer event, const size_t n, const size_t k,
+                      const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer,
+                      const size_t x_offset, const size_t x_inc, const bool a_rotated, const bool a_conjugate,
+                      const size_t parameter, const size_t local_size);
+
+// =================================================================================================
+
 // Copies or transposes a matrix and optionally pads/unpads it with zeros. This method is also able
 // to write to symmetric and triangular matrices through optional arguments.
 template <typename T>
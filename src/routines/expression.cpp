@@ -0,0 +1,275 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the parser of the run-time expressions (see the header for information).
+//
+// =================================================================================================
+
+#include "routines/expression.hpp"
+
+#include <cctype>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "utilities/clblast_exceptions.hpp"
+
+namespace clblast {
+// =================================================================================================
+namespace {
+
+// Recursive-descent parser generating the OpenCL code of an expression. Every operation stores its
+// result in a new temporary variable, such that the complex-number macros of 'common.opencl' (e.g.
+// 'Multiply') can be used without their inputs and outputs aliasing.
+class ExpressionParser {
+ public:
+  explicit ExpressionParser(const std::string& expression) : expression_(expression) {}
+
+  // Parses a list of assignments (ELEMENTWISE) or a single expression (MAPREDUCE)
+  Expression Parse(const bool is_reduction) {
+    auto result_name = std::string{};
+    if (is_reduction) {
+      result_name = ParseSum();
+    } else {
+      do {
+        ParseAssignment();
+      } while (Accept(';') && Peek() != '\0');
+    }
+    if (Peek() != '\0') {
+      Fail("unexpected character");
+    }
+    return Generate(is_reduction, result_name);
+  }
+
+ private:
+  // Throws an error pointing at the current position in the expression
+  [[noreturn]] void Fail(const std::string& message) const {
+    throw BLASError(StatusCode::kInvalidExpression,
+                    message + " at position " + ToString(position_) + " of '" + expression_ + "'");
+  }
+
+  // Returns the next non-whitespace character without consuming it, or '\0' at the end
+  char Peek() {
+    while (position_ < expression_.size() && std::isspace(static_cast<unsigned char>(expression_[position_]))) {
+      position_++;
+    }
+    return (position_ < expression_.size()) ? expression_[position_] : '\0';
+  }
+
+  // Consumes the next character if it matches 'c'
+  bool Accept(const char c) {
+    if (Peek() != c) {
+      return false;
+    }
+    position_++;
+    return true;
+  }
+
+  // Creates a new temporary variable with an operation applied to it. The operation is put in its
+  // own scope, since the complex version of 'DivideFull' declares local variables.
+  std::string NewTemporary(const std::string& operation, const std::string& args) {
+    const auto name = "t" + ToString(num_temporaries_++);
+    code_ += "real " + name + "; { " + operation + "(" + name + ", " + args + "); } ";
+    return name;
+  }
+
+  // statement := vector '=' expression
+  void ParseAssignment() {
+    Peek();
+    const auto start = position_;
+    const auto name = ParseName();
+    const auto index = LookUp(kExpressionVectorNames, name);
+    if (index == std::string::npos) {
+      position_ = start;
+      Fail("expected a vector 'x', 'y', 'z' or 'w'");
+    }
+    if (!Accept('=')) {
+      Fail("expected '='");
+    }
+    const auto value = ParseSum();
+    code_ += name + " = " + value + "; ";
+    vectors_.insert(index);
+    outputs_.insert(index);
+  }
+
+  // expression := term { ('+' | '-') term }
+  std::string ParseSum() {
+    auto result = ParseProduct();
+    while (true) {
+      if (Accept('+')) {
+        result = NewTemporary("Add", result + ", " + ParseProduct());
+      } else if (Accept('-')) {
+        result = NewTemporary("Subtract", result + ", " + ParseProduct());
+      } else {
+        return result;
+      }
+    }
+  }
+
+  // term := factor { ('*' | '/') factor }
+  std::string ParseProduct() {
+    auto result = ParseFactor();
+    while (true) {
+      if (Accept('*')) {
+        result = NewTemporary("Multiply", result + ", " + ParseFactor());
+      } else if (Accept('/')) {
+        result = NewTemporary("DivideFull", result + ", " + ParseFactor());
+      } else {
+        return result;
+      }
+    }
+  }
+
+  // factor := '-' factor | '(' expression ')' | vector | scalar | number
+  std::string ParseFactor() {
+    if (Accept('-')) {
+      const auto value = ParseFactor();
+      const auto name = "t" + ToString(num_temporaries_++);
+      code_ += "real " + name + " = " + value + "; Negate(" + name + "); ";
+      return name;
+    }
+    if (Accept('(')) {
+      const auto value = ParseSum();
+      if (!Accept(')')) {
+        Fail("expected ')'");
+      }
+      return value;
+    }
+    const auto c = Peek();
+    if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+      return ParseNumber();
+    }
+    const auto start = position_;
+    const auto name = ParseName();
+    const auto vector_index = LookUp(kExpressionVectorNames, name);
+    if (vector_index != std::string::npos) {
+      if (outputs_.count(vector_index) == 0) {
+        loaded_.insert(vector_index);
+      }
+      vectors_.insert(vector_index);
+      return name;
+    }
+    const auto scalar_index = LookUp(kExpressionScalarNames, name);
+    if (scalar_index != std::string::npos) {
+      scalars_.insert(scalar_index);
+      return name;
+    }
+    position_ = start;
+    Fail("expected a vector, a scalar, a number or '('");
+  }
+
+  // Parses a numeric constant, which becomes an extra scalar kernel argument 'kN'
+  std::string ParseNumber() {
+    const auto start = expression_.c_str() + position_;
+    char* end = nullptr;
+    const auto value = std::strtod(start, &end);
+    if (end == start) {
+      Fail("invalid number");
+    }
+    position_ += static_cast<size_t>(end - start);
+    for (auto i = size_t{0}; i < constants_.size(); ++i) {
+      if (constants_[i] == value) {
+        return "k" + ToString(i);
+      }
+    }
+    constants_.push_back(value);
+    return "k" + ToString(constants_.size() - 1);
+  }
+
+  // Parses an identifier (letters, digits and underscores), which is empty if there is none
+  std::string ParseName() {
+    Peek();
+    const auto start = position_;
+    while (position_ < expression_.size() &&
+           (std::isalnum(static_cast<unsigned char>(expression_[position_])) || expression_[position_] == '_')) {
+      position_++;
+    }
+    return expression_.substr(start, position_ - start);
+  }
+
+  // Returns the index of a single-letter operand name, or npos if the name is not one of them
+  static size_t LookUp(const char* names, const std::string& name) {
+    if (name.size() != 1) {
+      return std::string::npos;
+    }
+    const auto found = std::strchr(names, name[0]);
+    return (found == nullptr) ? std::string::npos : static_cast<size_t>(found - names);
+  }
+
+  // Generates the OpenCL macros used by the kernel templates:
+  // - EXPRESSION_ARGUMENTS: the kernel arguments, starting with a comma
+  // - EXPRESSION_SCALARS: the conversion of the scalar arguments
+  // - EXPRESSION_BODY(id): loads the vectors, computes the expression and stores the results
+  // - EXPRESSION_RESULT: the variable holding the value to be reduced (MAPREDUCE only)
+  Expression Generate(const bool is_reduction, const std::string& result_name) const {
+    auto result = Expression();
+    for (const auto c : expression_) {
+      if (!std::isspace(static_cast<unsigned char>(c))) {
+        result.key += c;
+      }
+    }
+    result.scalars = std::vector<size_t>(scalars_.begin(), scalars_.end());
+    result.vectors = std::vector<size_t>(vectors_.begin(), vectors_.end());
+    result.constants = constants_;
+
+    auto arguments = std::string{};
+    auto scalars = std::string{};
+    auto loads = std::string{};
+    auto stores = std::string{};
+    for (const auto index : result.scalars) {
+      const auto name = std::string(1, kExpressionScalarNames[index]);
+      arguments += ", const real_arg arg_" + name;
+      scalars += "const real " + name + " = GetRealArg(arg_" + name + "); ";
+    }
+    for (auto i = size_t{0}; i < result.constants.size(); ++i) {
+      const auto name = "k" + ToString(i);
+      arguments += ", const real_arg arg_" + name;
+      scalars += "const real " + name + " = GetRealArg(arg_" + name + "); ";
+    }
+    for (const auto index : result.vectors) {
+      const auto name = std::string(1, kExpressionVectorNames[index]);
+      const auto is_output = (outputs_.count(index) == 1);
+      const auto access = name + "gm[(id)*" + name + "_inc + " + name + "_offset]";
+      arguments += std::string{", "} + (is_output ? "" : "const ") + "__global real* " + name + "gm, const int " +
+                   name + "_offset, const int " + name + "_inc";
+      loads += (loaded_.count(index) == 1) ? "real " + name + " = " + access + "; " : "real " + name + "; ";
+      if (is_output) {
+        stores += access + " = " + name + "; ";
+      }
+    }
+    result.source = "#define EXPRESSION_ARGUMENTS " + arguments + "\n";
+    result.source += "#define EXPRESSION_SCALARS " + scalars + "\n";
+    result.source += "#define EXPRESSION_BODY(id) " + loads + code_ + stores + "\n";
+    if (is_reduction) {
+      result.source += "#define EXPRESSION_RESULT " + result_name + "\n";
+    }
+    return result;
+  }
+
+  const std::string expression_;
+  size_t position_ = 0;
+  size_t num_temporaries_ = 0;
+  std::string code_;
+  std::set<size_t> scalars_;
+  std::set<size_t> vectors_;
+  std::set<size_t> loaded_;   // vectors read before they are assigned
+  std::set<size_t> outputs_;  // vectors assigned to
+  std::vector<double> constants_;
+};
+
+}  // anonymous namespace
+
+// =================================================================================================
+
+// Parses the expression and generates the corresponding OpenCL code
+Expression ParseExpression(const std::string& expression, const bool is_reduction) {
+  return ExpressionParser(expression).Parse(is_reduction);
+}
+
+// =================================================================================================
+}  // namespace clblast
@@ -0,0 +1,94 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the parser of the run-time expressions of the ELEMENTWISE and MAPREDUCE
+// routines. An expression is translated into a few OpenCL pre-processor macros, which complete the
+// kernel templates in 'xelementwise.opencl' and 'xmapreduce.opencl'. The grammar is restricted to:
+//
+//   statements := statement { ';' statement }    (ELEMENTWISE, e.g. "y = a*x + y; z = y*z")
+//   statement  := vector '=' expression
+//   expression := term { ('+' | '-') term }        (MAPREDUCE, e.g. "a*x*y + 2*x")
+//   term       := factor { ('*' | '/') factor }
+//   factor     := '-' factor | '(' expression ')' | vector | scalar | number
+//
+// The vectors are named 'x', 'y', 'z' and 'w', the scalars 'a' up to 'h'. They refer to the entries
+// of the arrays of vectors and scalars as passed to the routine, e.g. 'z' is the third vector.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_EXPRESSION_H_
+#define CLBLAST_ROUTINES_EXPRESSION_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The names of the operands, their position is the index in the array of vectors or scalars
+constexpr auto kExpressionVectorNames = "xyzw";
+constexpr auto kExpressionScalarNames = "abcdefgh";
+
+// A parsed expression: the generated OpenCL code and the operands it uses. The kernel arguments are
+// ordered as the scalars, the numeric constants, and then the vectors (buffer, offset, increment).
+struct Expression {
+  std::string key;                // The expression without whitespace, identifies the program
+  std::string source;             // The generated OpenCL macros, to be put in front of the kernel
+  std::vector<size_t> scalars;    // Indices of the scalars used, in increasing order
+  std::vector<double> constants;  // Values of the numeric constants
+  std::vector<size_t> vectors;    // Indices of the vectors used, in increasing order
+};
+
+// Parses either a list of assignments (ELEMENTWISE) or a single expression (MAPREDUCE). Throws a
+// BLASError with status code 'kInvalidExpression' in case the expression is not valid.
+Expression ParseExpression(const std::string& expression, const bool is_reduction);
+
+// =================================================================================================
+
+// Tests the operands of a parsed expression for validity and sets them as kernel arguments starting
+// at index 'arg'. The vectors 'z' and 'w' are both tested as vector 'Z'. Returns the next index.
+template <typename T>
+size_t SetExpressionArguments(Kernel& kernel, size_t arg, const Expression& expression, const size_t n,
+                              const std::vector<T>& scalars, const std::vector<Buffer<T>>& buffers,
+                              const std::vector<size_t>& offsets, const std::vector<size_t>& incs) {
+  for (const auto index : expression.scalars) {
+    if (index >= scalars.size()) {
+      throw BLASError(StatusCode::kInvalidExpression,
+                      "missing scalar '" + std::string(1, kExpressionScalarNames[index]) + "'");
+    }
+    kernel.SetArgument(arg++, GetRealArg(scalars[index]));
+  }
+  for (const auto constant : expression.constants) {
+    kernel.SetArgument(arg++, GetRealArg(Constant<T>(constant)));
+  }
+  for (const auto index : expression.vectors) {
+    if (index >= buffers.size() || index >= offsets.size() || index >= incs.size()) {
+      throw BLASError(StatusCode::kInvalidExpression,
+                      "missing vector '" + std::string(1, kExpressionVectorNames[index]) + "'");
+    }
+    if (index == 0) {
+      TestVectorX(n, buffers[index], offsets[index], incs[index]);
+    } else if (index == 1) {
+      TestVectorY(n, buffers[index], offsets[index], incs[index]);
+    } else {
+      TestVectorZ(n, buffers[index], offsets[index], incs[index]);
+    }
+    kernel.SetArgument(arg++, buffers[index]());
+    kernel.SetArgument(arg++, static_cast<int>(offsets[index]));
+    kernel.SetArgument(arg++, static_cast<int>(incs[index]));
+  }
+  return arg;
+}
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_EXPRESSION_H_
+#endif
@@ -47,14 +47,16 @@ void Xamax<T>::DoAmax(const size_t n, const Buffer<unsigned int>& imax_buffer, c
   TestVectorX(n, x_buffer, x_offset, x_inc);
   TestVectorIndex(1, imax_buffer, imax_offset);
 
-  // Retrieves the Xamax kernels from the compiled binary
+  // Retrieves the Xamax kernel from the compiled binary
   auto kernel1 = Kernel(program_, "Xamax");
-  auto kernel2 = Kernel(program_, "XamaxEpilogue");
 
-  // Creates the buffer for intermediate values
+  // Creates the buffers for intermediate values and for the single-pass work-group counter. The
+  // two-pass version doesn't use the counter, such that it is given the temporary buffer instead.
   auto temp_size = 2 * db_["WGS2"];
   auto temp_buffer1 = Buffer<T>(context_, temp_size);
   auto temp_buffer2 = Buffer<unsigned int>(context_, temp_size);
+  auto counter_buffer = (db_["SINGLE_PASS"] == 1) ? CreateWorkGroupCounter(context_, queue_)
+                                                  : Buffer<unsigned int>(temp_buffer2());
 
   // Sets the kernel arguments
   kernel1.SetArgument(0, static_cast<int>(n));
@@ -63,18 +65,24 @@ void Xamax<T>::DoAmax(const size_t n, const Buffer<unsigned int>& imax_buffer, c
   kernel1.SetArgument(3, static_cast<int>(x_inc));
   kernel1.SetArgument(4, temp_buffer1());
   kernel1.SetArgument(5, temp_buffer2());
+  kernel1.SetArgument(6, counter_buffer());
+  kernel1.SetArgument(7, imax_buffer());
+  kernel1.SetArgument(8, static_cast<int>(imax_offset));
 
-  // Event waiting list
-  auto eventWaitList = std::vector<Event>();
-
-  // Launches the main kernel
+  // Launches the main kernel. In the single-pass version it also computes the final result.
   auto global1 = std::vector<size_t>{db_["WGS1"] * temp_size};
   auto local1 = std::vector<size_t>{db_["WGS1"]};
+  if (db_["SINGLE_PASS"] == 1) {
+    RunKernel(kernel1, queue_, device_, global1, local1, event_);
+    return;
+  }
+  auto eventWaitList = std::vector<Event>();
   auto kernelEvent = Event();
   RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
   eventWaitList.push_back(kernelEvent);
 
   // Sets the arguments for the epilogue kernel
+  auto kernel2 = Kernel(program_, "XamaxEpilogue");
   kernel2.SetArgument(0, temp_buffer1());
   kernel2.SetArgument(1, temp_buffer2());
   kernel2.SetArgument(2, imax_buffer());
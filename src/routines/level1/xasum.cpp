@@ -28,6 +28,8 @@ template <typename T>
 Xasum<T>::Xasum(Queue& queue, EventPointer event, const std::string& name)
     : Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {},
               {
+#include "../../kernels/level1/reproducible.opencl"
+// (comment to prevent auto-re-ordering)
 #include "../../kernels/level1/xasum.opencl"
               }) {
 }
@@ -47,13 +49,31 @@ void Xasum<T>::DoAsum(const size_t n, const Buffer<T>& asum_buffer, const size_t
   TestVectorX(n, x_buffer, x_offset, x_inc);
   TestVectorScalar(1, asum_buffer, asum_offset);
 
-  // Retrieves the Xasum kernels from the compiled binary
+  // The reproducible mode uses its own main kernel with a fixed order of summation
+  if (GetCurrentReductionMode() == ReductionMode::kReproducible) {
+    auto kernel = Kernel(program_, "XasumReproducible");
+    auto temp_buffer = Buffer<T>(context_, ReproducibleReductionTempSize(n));
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer());
+    kernel.SetArgument(2, static_cast<int>(x_offset));
+    kernel.SetArgument(3, static_cast<int>(x_inc));
+    kernel.SetArgument(4, temp_buffer());
+    kernel.SetArgument(5, asum_buffer());
+    kernel.SetArgument(6, static_cast<int>(asum_offset));
+    RunReproducibleReduction(queue_, device_, program_, event_, kernel, n, db_["WGS1"], temp_buffer, asum_buffer,
+                             asum_offset);
+    return;
+  }
+
+  // Retrieves the Xasum kernel from the compiled binary
   auto kernel1 = Kernel(program_, "Xasum");
-  auto kernel2 = Kernel(program_, "XasumEpilogue");
 
-  // Creates the buffer for intermediate values
+  // Creates the buffers for intermediate values and for the single-pass work-group counter. The
+  // two-pass version doesn't use the counter, such that it is given the temporary buffer instead.
   auto temp_size = 2 * db_["WGS2"];
   auto temp_buffer = Buffer<T>(context_, temp_size);
+  auto counter_buffer = (db_["SINGLE_PASS"] == 1) ? CreateWorkGroupCounter(context_, queue_)
+                                                  : Buffer<unsigned int>(temp_buffer());
 
   // Sets the kernel arguments
   kernel1.SetArgument(0, static_cast<int>(n));
@@ -61,18 +81,25 @@ void Xasum<T>::DoAsum(const size_t n, const Buffer<T>& asum_buffer, const size_t
   kernel1.SetArgument(2, static_cast<int>(x_offset));
   kernel1.SetArgument(3, static_cast<int>(x_inc));
   kernel1.SetArgument(4, temp_buffer());
+  kernel1.SetArgument(5, counter_buffer());
+  kernel1.SetArgument(6, asum_buffer());
+  kernel1.SetArgument(7, static_cast<int>(asum_offset));
+  kernel1.SetArgument(8, static_cast<int>(GetCurrentReductionMode() == ReductionMode::kCompensated));
 
-  // Event waiting list
-  auto eventWaitList = std::vector<Event>();
-
-  // Launches the main kernel
+  // Launches the main kernel. In the single-pass version it also computes the final result.
   auto global1 = std::vector<size_t>{db_["WGS1"] * temp_size};
   auto local1 = std::vector<size_t>{db_["WGS1"]};
+  if (db_["SINGLE_PASS"] == 1) {
+    RunKernel(kernel1, queue_, device_, global1, local1, event_);
+    return;
+  }
+  auto eventWaitList = std::vector<Event>();
   auto kernelEvent = Event();
   RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
   eventWaitList.push_back(kernelEvent);
 
   // Sets the arguments for the epilogue kernel
+  auto kernel2 = Kernel(program_, "XasumEpilogue");
   kernel2.SetArgument(0, temp_buffer());
   kernel2.SetArgument(1, asum_buffer());
   kernel2.SetArgument(2, static_cast<int>(asum_offset));
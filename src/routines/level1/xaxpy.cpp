@@ -25,8 +25,8 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xaxpy<T>::Xaxpy(Queue& queue, EventPointer event, const std::string& name)
-    : Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {},
+Xaxpy<T>::Xaxpy(Queue& queue, EventPointer event, const std::string& name, const bool device_scalars)
+    : Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, std::string{}, device_scalars,
               {
 #include "../../kernels/level1/level1.opencl"
 // (comment to prevent auto-re-ordering)
@@ -38,8 +38,9 @@ Xaxpy<T>::Xaxpy(Queue& queue, EventPointer event, const std::string& name)
 
 // The main routine
 template <typename T>
-void Xaxpy<T>::DoAxpy(const size_t n, const T alpha, const Buffer<T>& x_buffer, const size_t x_offset,
-                      const size_t x_inc, const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc) {
+void Xaxpy<T>::DoAxpy(const size_t n, const ScalarArgument<T>& alpha, const Buffer<T>& x_buffer,
+                      const size_t x_offset, const size_t x_inc, const Buffer<T>& y_buffer, const size_t y_offset,
+                      const size_t y_inc) {
   // Makes sure all dimensions are larger than zero
   if (n == 0) {
     throw BLASError(StatusCode::kInvalidDimension);
@@ -63,12 +64,12 @@ void Xaxpy<T>::DoAxpy(const size_t n, const T alpha, const Buffer<T>& x_buffer,
   // Sets the kernel arguments
   if (use_faster_kernel || use_fastest_kernel) {
     kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, GetRealArg(alpha));
+    SetScalarArgument(kernel, 1, alpha);
     kernel.SetArgument(2, x_buffer());
     kernel.SetArgument(3, y_buffer());
   } else {
     kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, GetRealArg(alpha));
+    SetScalarArgument(kernel, 1, alpha);
     kernel.SetArgument(2, x_buffer());
     kernel.SetArgument(3, static_cast<int>(x_offset));
     kernel.SetArgument(4, static_cast<int>(x_inc));
@@ -14,6 +14,7 @@
 #include <string>
 
 #include "routine.hpp"
+#include "routines/common.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -23,12 +24,12 @@ namespace clblast {
 template <typename T>
 class Xaxpy : public Routine {
  public:
-  // Constructor
-  Xaxpy(Queue& queue, EventPointer event, const std::string& name = "AXPY");
+  // Constructor, optionally for a version of the routine with the scalar in device memory
+  Xaxpy(Queue& queue, EventPointer event, const std::string& name = "AXPY", const bool device_scalars = false);
 
   // Templated-precision implementation of the routine
-  void DoAxpy(const size_t n, const T alpha, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
-              const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc);
+  void DoAxpy(const size_t n, const ScalarArgument<T>& alpha, const Buffer<T>& x_buffer, const size_t x_offset,
+              const size_t x_inc, const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc);
 };
 
 // =================================================================================================
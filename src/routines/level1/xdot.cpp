@@ -28,6 +28,8 @@ template <typename T>
 Xdot<T>::Xdot(Queue& queue, EventPointer event, const std::string& name)
     : Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {},
               {
+#include "../../kernels/level1/reproducible.opencl"
+// (comment to prevent auto-re-ordering)
 #include "../../kernels/level1/xdot.opencl"
               }) {
 }
@@ -49,13 +51,35 @@ void Xdot<T>::DoDot(const size_t n, const Buffer<T>& dot_buffer, const size_t do
   TestVectorY(n, y_buffer, y_offset, y_inc);
   TestVectorScalar(1, dot_buffer, dot_offset);
 
-  // Retrieves the Xdot kernels from the compiled binary
+  // The reproducible mode uses its own main kernel with a fixed order of summation
+  if (GetCurrentReductionMode() == ReductionMode::kReproducible) {
+    auto kernel = Kernel(program_, "XdotReproducible");
+    auto temp_buffer = Buffer<T>(context_, ReproducibleReductionTempSize(n));
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer());
+    kernel.SetArgument(2, static_cast<int>(x_offset));
+    kernel.SetArgument(3, static_cast<int>(x_inc));
+    kernel.SetArgument(4, y_buffer());
+    kernel.SetArgument(5, static_cast<int>(y_offset));
+    kernel.SetArgument(6, static_cast<int>(y_inc));
+    kernel.SetArgument(7, temp_buffer());
+    kernel.SetArgument(8, static_cast<int>(do_conjugate));
+    kernel.SetArgument(9, dot_buffer());
+    kernel.SetArgument(10, static_cast<int>(dot_offset));
+    RunReproducibleReduction(queue_, device_, program_, event_, kernel, n, db_["WGS1"], temp_buffer, dot_buffer,
+                             dot_offset);
+    return;
+  }
+
+  // Retrieves the Xdot kernel from the compiled binary
   auto kernel1 = Kernel(program_, "Xdot");
-  auto kernel2 = Kernel(program_, "XdotEpilogue");
 
-  // Creates the buffer for intermediate values
+  // Creates the buffers for intermediate values and for the single-pass work-group counter. The
+  // two-pass version doesn't use the counter, such that it is given the temporary buffer instead.
   auto temp_size = 2 * db_["WGS2"];
   auto temp_buffer = Buffer<T>(context_, temp_size);
+  auto counter_buffer = (db_["SINGLE_PASS"] == 1) ? CreateWorkGroupCounter(context_, queue_)
+                                                  : Buffer<unsigned int>(temp_buffer());
 
   // Sets the kernel arguments
   kernel1.SetArgument(0, static_cast<int>(n));
@@ -67,18 +91,25 @@ void Xdot<T>::DoDot(const size_t n, const Buffer<T>& dot_buffer, const size_t do
   kernel1.SetArgument(6, static_cast<int>(y_inc));
   kernel1.SetArgument(7, temp_buffer());
   kernel1.SetArgument(8, static_cast<int>(do_conjugate));
+  kernel1.SetArgument(9, counter_buffer());
+  kernel1.SetArgument(10, dot_buffer());
+  kernel1.SetArgument(11, static_cast<int>(dot_offset));
+  kernel1.SetArgument(12, static_cast<int>(GetCurrentReductionMode() == ReductionMode::kCompensated));
 
-  // Event waiting list
-  auto eventWaitList = std::vector<Event>();
-
-  // Launches the main kernel
+  // Launches the main kernel. In the single-pass version it also computes the final result.
   auto global1 = std::vector<size_t>{db_["WGS1"] * temp_size};
   auto local1 = std::vector<size_t>{db_["WGS1"]};
+  if (db_["SINGLE_PASS"] == 1) {
+    RunKernel(kernel1, queue_, device_, global1, local1, event_);
+    return;
+  }
+  auto eventWaitList = std::vector<Event>();
   auto kernelEvent = Event();
   RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
   eventWaitList.push_back(kernelEvent);
 
   // Sets the arguments for the epilogue kernel
+  auto kernel2 = Kernel(program_, "XdotEpilogue");
   kernel2.SetArgument(0, temp_buffer());
   kernel2.SetArgument(1, dot_buffer());
   kernel2.SetArgument(2, static_cast<int>(dot_offset));
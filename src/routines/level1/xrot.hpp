@@ -0,0 +1,38 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrot routine. The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XROT_H_
+#define CLBLAST_ROUTINES_XROT_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xrot : public Routine {
+ public:
+  // Constructor
+  Xrot(Queue& queue, EventPointer event, const std::string& name = "ROT");
+
+  // Templated-precision implementation of the routine
+  void DoRot(const size_t n, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+             const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc, const T cos, const T sin);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XROT_H_
+#endif
@@ -0,0 +1,38 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotg routine. The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XROTG_H_
+#define CLBLAST_ROUTINES_XROTG_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xrotg : public Routine {
+ public:
+  // Constructor
+  Xrotg(Queue& queue, EventPointer event, const std::string& name = "ROTG");
+
+  // Templated-precision implementation of the routine
+  void DoRotg(const Buffer<T>& sa_buffer, const size_t sa_offset, const Buffer<T>& sb_buffer, const size_t sb_offset,
+              const Buffer<T>& sc_buffer, const size_t sc_offset, const Buffer<T>& ss_buffer, const size_t ss_offset);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XROTG_H_
+#endif
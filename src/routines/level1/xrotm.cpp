@@ -0,0 +1,103 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotm class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level1/xrotm.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xrotm<T>::Xrotm(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level1/level1.opencl"
+// (comment to prevent auto-re-ordering)
+#include "../../kernels/level1/xrot.opencl"
+              }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xrotm<T>::DoRotm(const size_t n, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                      const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc,
+                      const Buffer<T>& sparam_buffer, const size_t sparam_offset) {
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the vectors for validity. The parameter array consists of the flag and the 4 elements of H
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+  TestVectorScalar(5, sparam_buffer, sparam_offset);
+
+  // Determines whether or not the fast-version can be used
+  const auto use_fast_kernel = (x_offset == 0) && (x_inc == 1) && (y_offset == 0) && (y_inc == 1) &&
+                               IsMultiple(n, db_["WGS"] * db_["WPT"] * db_["VW"]);
+
+  // If possible, run the fast-version of the kernel
+  const auto kernel_name = (use_fast_kernel) ? "XrotmFast" : "Xrotm";
+
+  // Retrieves the Xrotm kernel from the compiled binary
+  auto kernel = Kernel(program_, kernel_name);
+
+  // Sets the kernel arguments
+  if (use_fast_kernel) {
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer());
+    kernel.SetArgument(2, y_buffer());
+    kernel.SetArgument(3, sparam_buffer());
+    kernel.SetArgument(4, static_cast<int>(sparam_offset));
+  } else {
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer());
+    kernel.SetArgument(2, static_cast<int>(x_offset));
+    kernel.SetArgument(3, static_cast<int>(x_inc));
+    kernel.SetArgument(4, y_buffer());
+    kernel.SetArgument(5, static_cast<int>(y_offset));
+    kernel.SetArgument(6, static_cast<int>(y_inc));
+    kernel.SetArgument(7, sparam_buffer());
+    kernel.SetArgument(8, static_cast<int>(sparam_offset));
+  }
+
+  // Launches the kernel
+  if (use_fast_kernel) {
+    auto global = std::vector<size_t>{CeilDiv(n, db_["WPT"] * db_["VW"])};
+    auto local = std::vector<size_t>{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  } else {
+    auto n_ceiled = Ceil(n, db_["WGS"] * db_["WPT"]);
+    auto global = std::vector<size_t>{n_ceiled / db_["WPT"]};
+    auto local = std::vector<size_t>{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xrotm<float>;
+template class Xrotm<double>;
+
+// =================================================================================================
+}  // namespace clblast
@@ -0,0 +1,39 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotm routine. The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XROTM_H_
+#define CLBLAST_ROUTINES_XROTM_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xrotm : public Routine {
+ public:
+  // Constructor
+  Xrotm(Queue& queue, EventPointer event, const std::string& name = "ROTM");
+
+  // Templated-precision implementation of the routine
+  void DoRotm(const size_t n, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+              const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc, const Buffer<T>& sparam_buffer,
+              const size_t sparam_offset);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XROTM_H_
+#endif
@@ -25,8 +25,8 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xscal<T>::Xscal(Queue& queue, EventPointer event, const std::string& name)
-    : Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {},
+Xscal<T>::Xscal(Queue& queue, EventPointer event, const std::string& name, const bool device_scalars)
+    : Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, std::string{}, device_scalars,
               {
 #include "../../kernels/level1/level1.opencl"
 // (comment to prevent auto-re-ordering)
@@ -38,8 +38,8 @@ Xscal<T>::Xscal(Queue& queue, EventPointer event, const std::string& name)
 
 // The main routine
 template <typename T>
-void Xscal<T>::DoScal(const size_t n, const T alpha, const Buffer<T>& x_buffer, const size_t x_offset,
-                      const size_t x_inc) {
+void Xscal<T>::DoScal(const size_t n, const ScalarArgument<T>& alpha, const Buffer<T>& x_buffer,
+                      const size_t x_offset, const size_t x_inc) {
   // Makes sure all dimensions are larger than zero
   if (n == 0) {
     throw BLASError(StatusCode::kInvalidDimension);
@@ -60,11 +60,11 @@ void Xscal<T>::DoScal(const size_t n, const T alpha, const Buffer<T>& x_buffer,
   // Sets the kernel arguments
   if (use_fast_kernel) {
     kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, GetRealArg(alpha));
+    SetScalarArgument(kernel, 1, alpha);
     kernel.SetArgument(2, x_buffer());
   } else {
     kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, GetRealArg(alpha));
+    SetScalarArgument(kernel, 1, alpha);
     kernel.SetArgument(2, x_buffer());
     kernel.SetArgument(3, static_cast<int>(x_offset));
     kernel.SetArgument(4, static_cast<int>(x_inc));
@@ -14,6 +14,7 @@
 #include <string>
 
 #include "routine.hpp"
+#include "routines/common.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -23,11 +24,12 @@ namespace clblast {
 template <typename T>
 class Xscal : public Routine {
  public:
-  // Constructor
-  Xscal(Queue& queue, EventPointer event, const std::string& name = "SCAL");
+  // Constructor, optionally for a version of the routine with the scalar in device memory
+  Xscal(Queue& queue, EventPointer event, const std::string& name = "SCAL", const bool device_scalars = false);
 
   // Templated-precision implementation of the routine
-  void DoScal(const size_t n, const T alpha, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc);
+  void DoScal(const size_t n, const ScalarArgument<T>& alpha, const Buffer<T>& x_buffer, const size_t x_offset,
+              const size_t x_inc);
 };
 
 // =================================================================================================
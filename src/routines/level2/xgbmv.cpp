@@ -11,9 +11,13 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
-#include "routines/level2/xgemv.hpp"
+#include "routine.hpp"
+#include "routines/common.hpp"
 #include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
 #include "utilities/utilities.hpp"
 
 namespace clblast {
@@ -21,7 +25,13 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xgbmv<T>::Xgbmv(Queue& queue, EventPointer event, const std::string& name) : Xgemv<T>(queue, event, name) {}
+Xgbmv<T>::Xgbmv(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xgbmv"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level2/xgbmv.opencl"
+#include "../../kernels/level2/xtrmv.opencl"
+              }) {
+}
 
 // =================================================================================================
 
@@ -36,12 +46,76 @@ void Xgbmv<T>::DoGbmv(const Layout layout, const Transpose a_transpose, const si
   auto kl_real = (rotated) ? ku : kl;
   auto ku_real = (rotated) ? kl : ku;
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific hermitian matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_GBMV define.
-  bool fast_kernels = false;
-  MatVec(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer,
-         y_offset, y_inc, fast_kernels, fast_kernels, 0, false, kl_real, ku_real);
+  // Runs the banded matrix-vector multiplication on the full band
+  BandedMatVec(layout, a_transpose, m, n, kl_real, ku_real, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc,
+               beta, y_buffer, y_offset, y_inc, 0);
+}
+
+// =================================================================================================
+
+// The generic banded implementation, also used by SBMV and HBMV. This follows the set-up of 'Xgemv::MatVec':
+// the kernel computes y = alpha * A * x + beta * y for the (rotated) band of A.
+template <typename T>
+void Xgbmv<T>::BandedMatVec(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                            const size_t kl, const size_t ku, const T alpha, const Buffer<T>& a_buffer,
+                            const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset,
+                            const size_t x_inc, const T beta, const Buffer<T>& y_buffer, const size_t y_offset,
+                            const size_t y_inc, const size_t parameter, EventPointer event,
+                            const std::vector<Event>& wait_for_events) {
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major). The band storage holds the
+  // kl+ku+1 diagonals of each column (or row).
+  const auto a_altlayout = (layout == Layout::kRowMajor);
+  const auto a_one = kl + ku + 1;
+  const auto a_two = (a_altlayout) ? m : n;
+
+  // Swap m and n if the matrix is transposed
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto m_real = (a_transposed) ? n : m;
+  const auto n_real = (a_transposed) ? m : n;
+
+  // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
+  const auto a_rotated = a_transposed ^ a_altlayout;
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // Tests the matrix and the vectors for validity
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestVectorX(n_real, x_buffer, x_offset, x_inc);
+  TestVectorY(m_real, y_buffer, y_offset, y_inc);
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, "Xgbmv");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m_real));
+  kernel.SetArgument(1, static_cast<int>(n_real));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, GetRealArg(beta));
+  kernel.SetArgument(4, static_cast<int>(a_rotated));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, x_buffer());
+  kernel.SetArgument(9, static_cast<int>(x_offset));
+  kernel.SetArgument(10, static_cast<int>(x_inc));
+  kernel.SetArgument(11, y_buffer());
+  kernel.SetArgument(12, static_cast<int>(y_offset));
+  kernel.SetArgument(13, static_cast<int>(y_inc));
+  kernel.SetArgument(14, static_cast<int>(a_conjugate));
+  kernel.SetArgument(15, static_cast<int>(parameter));
+  kernel.SetArgument(16, static_cast<int>(kl));
+  kernel.SetArgument(17, static_cast<int>(ku));
+
+  // Launches the kernel, one thread per element of y
+  auto global = std::vector<size_t>{Ceil(m_real, db_["WGS"])};
+  auto local = std::vector<size_t>{db_["WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, (event != nullptr) ? event : event_, wait_for_events);
 }
 
 // =================================================================================================
@@ -3,9 +3,10 @@
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xgbmv routine. It is based on the generalized mat-vec multiplication
-// routine (Xgemv). The Xgbmv class inherits from the templated class Xgemv, allowing it to call the
-// "MatVec" function directly.
+// This file implements the Xgbmv routine. It uses a dedicated banded kernel which only iterates over
+// the diagonals of the band. The generic "BandedMatVec" function is also used by the other banded
+// matrix-vector routines (SBMV, HBMV), which inherit from this class. TBMV inherits from this class
+// as well, but uses the in-place triangular kernels.
 //
 // =================================================================================================
 
@@ -14,8 +15,9 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
-#include "routines/level2/xgemv.hpp"
+#include "routine.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -23,11 +25,8 @@ namespace clblast {
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xgbmv : public Xgemv<T> {
+class Xgbmv : public Routine {
  public:
-  // Uses the generic matrix-vector routine
-  using Xgemv<T>::MatVec;
-
   // Constructor
   Xgbmv(Queue& queue, EventPointer event, const std::string& name = "GBMV");
 
@@ -36,6 +35,15 @@ class Xgbmv : public Xgemv<T> {
               const size_t ku, const T alpha, const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
               const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, const T beta,
               const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc);
+
+  // Generic version used also for the other banded matrix-vector multiplications. The arguments 'kl' and 'ku' are
+  // those of the band as stored in memory, 'parameter' is passed on to the kernel (see 'xgbmv.opencl').
+  void BandedMatVec(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                    const size_t kl, const size_t ku, const T alpha, const Buffer<T>& a_buffer, const size_t a_offset,
+                    const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                    const T beta, const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc,
+                    const size_t parameter, EventPointer event = nullptr,
+                    const std::vector<Event>& wait_for_events = {});
 };
 
 // =================================================================================================
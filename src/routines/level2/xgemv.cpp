@@ -25,12 +25,14 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xgemv<T>::Xgemv(Queue& queue, EventPointer event, const std::string& name)
+Xgemv<T>::Xgemv(Queue& queue, EventPointer event, const std::string& name, const bool device_scalars)
     : Routine(queue, event, name, {"Xgemv", "XgemvFast", "XgemvFastRot", "TrsvRoutine"}, PrecisionValue<T>(), {},
+              std::string{}, device_scalars,
               {
 #include "../../kernels/level2/xgemv.opencl"
 #include "../../kernels/level2/xgemv_fast.opencl"
 #include "../../kernels/level2/xtrsv.opencl"
+#include "../../kernels/level2/xtrmv.opencl"
               }) {
 }
 
@@ -38,10 +40,11 @@ Xgemv<T>::Xgemv(Queue& queue, EventPointer event, const std::string& name)
 
 // The main routine
 template <typename T>
-void Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n, const T alpha,
-                      const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer,
-                      const size_t x_offset, const size_t x_inc, const T beta, const Buffer<T>& y_buffer,
-                      const size_t y_offset, const size_t y_inc) {
+void Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                      const ScalarArgument<T>& alpha, const Buffer<T>& a_buffer, const size_t a_offset,
+                      const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                      const ScalarArgument<T>& beta, const Buffer<T>& y_buffer, const size_t y_offset,
+                      const size_t y_inc) {
   // Performs the matrix-vector multiplication
   MatVec(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer,
          y_offset, y_inc, true, true, 0, false, 0, 0);  // N/A for this routine
@@ -51,11 +54,13 @@ void Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose, const si
 
 // The generic implementation, also suited for other (non general) matrix-vector multiplications
 template <typename T>
-void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n, const T alpha,
-                      const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer,
-                      const size_t x_offset, const size_t x_inc, const T beta, const Buffer<T>& y_buffer,
-                      const size_t y_offset, const size_t y_inc, bool fast_kernel, bool fast_kernel_rot,
-                      const size_t parameter, const bool packed, const size_t kl, const size_t ku) {
+void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                      const ScalarArgument<T>& alpha, const Buffer<T>& a_buffer, const size_t a_offset,
+                      const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                      const ScalarArgument<T>& beta, const Buffer<T>& y_buffer, const size_t y_offset,
+                      const size_t y_inc, bool fast_kernel, bool fast_kernel_rot,
+                      const size_t parameter, const bool packed, const size_t kl, const size_t ku,
+                      EventPointer event, const std::vector<Event>& wait_for_events) {
   // Makes sure all dimensions are larger than zero
   if (m == 0 || n == 0) {
     throw BLASError(StatusCode::kInvalidDimension);
@@ -63,7 +68,7 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose, const si
 
   // Computes whether or not the matrix has an alternative layout (row or column-major).
   const auto a_altlayout = (layout == Layout::kRowMajor);
-  auto a_one = (a_altlayout) ? n : m;
+  const auto a_one = (a_altlayout) ? n : m;
   const auto a_two = (a_altlayout) ? m : n;
 
   // Swap m and n if the matrix is transposed
@@ -71,11 +76,6 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose, const si
   const auto m_real = (a_transposed) ? n : m;
   const auto n_real = (a_transposed) ? m : n;
 
-  // Special adjustments for banded matrices
-  if (kl != 0 || ku != 0) {
-    a_one = kl + ku + 1;
-  }
-
   // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
   const auto a_rotated = a_transposed ^ a_altlayout;
 
@@ -91,37 +91,103 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose, const si
   TestVectorX(n_real, x_buffer, x_offset, x_inc);
   TestVectorY(m_real, y_buffer, y_offset, y_inc);
 
-  // Determines whether or not the fast-version can be used
-  fast_kernel = fast_kernel && (a_offset == 0) && (a_rotated == 0) && (a_conjugate == 0) &&
-                IsMultiple(m, db_["WGS2"] * db_["WPT2"]) && IsMultiple(n, db_["WGS2"]) && IsMultiple(a_ld, db_["VW2"]);
-  fast_kernel_rot = fast_kernel_rot && (a_offset == 0) && (a_rotated == 1) && (a_conjugate == 0) &&
-                    IsMultiple(m, db_["WGS3"] * db_["WPT3"]) && IsMultiple(n, db_["WGS3"]) &&
-                    IsMultiple(a_ld, db_["VW3"]);
-
-  // If possible, run the fast-version (rotated or non-rotated) of the kernel
-  auto kernel_name = std::string{"Xgemv"};
-  const auto m_ceiled = Ceil(m_real, db_["WGS1"] * db_["WPT1"]);
-  auto global_size = m_ceiled / db_["WPT1"];
-  auto local_size = db_["WGS1"];
+  // Determines whether or not the fast-version can be used. The fast kernels only process the largest part of the
+  // matrix of which the sizes are multiples of their tile sizes, the remaining rows and columns are processed by the
+  // generic kernel. This assumes a general matrix: the fast kernels are not used for structured matrices.
+  fast_kernel = fast_kernel && (a_rotated == 0) && (a_conjugate == 0) && IsMultiple(a_offset, db_["VW2"]) &&
+                IsMultiple(a_ld, db_["VW2"]) && (m_real >= db_["WGS2"] * db_["WPT2"]) && (n_real >= db_["WGS2"]);
+  fast_kernel_rot = fast_kernel_rot && (a_rotated == 1) && (a_conjugate == 0) && IsMultiple(a_offset, db_["VW3"]) &&
+                    IsMultiple(a_ld, db_["VW3"]) && (m_real >= db_["WGS3"] * db_["WPT3"]) && (n_real >= db_["WGS3"]);
+
+  // With the scalars in device memory there is no value of one to pass as beta for the remaining columns (see below),
+  // so then the fast kernels are only used if the number of columns is a multiple of their tile size
+  if (device_scalars_) {
+    fast_kernel = fast_kernel && IsMultiple(n_real, db_["WGS2"]);
+    fast_kernel_rot = fast_kernel_rot && IsMultiple(n_real, db_["WGS3"]);
+  }
+
+  // Signals the routine's event with the last kernel launch unless a separate event is given
+  auto last_event = (event != nullptr) ? event : event_;
+
+  // If not possible, runs the generic version of the kernel on the whole matrix
+  if (!fast_kernel && !fast_kernel_rot) {
+    const auto m_ceiled = Ceil(m_real, db_["WGS1"] * db_["WPT1"]);
+    MatVecKernel("Xgemv", m_real, n_real, alpha, beta, a_rotated, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc, a_conjugate, parameter, kl, ku, m_ceiled / db_["WPT1"], db_["WGS1"],
+                 last_event, wait_for_events);
+    return;
+  }
+
+  // Splits the matrix into a bulk part for the fast (rotated or non-rotated) kernel and tails for the generic kernel
+  const auto m_tile = (fast_kernel) ? db_["WGS2"] * db_["WPT2"] : db_["WGS3"] * db_["WPT3"];
+  const auto n_tile = (fast_kernel) ? db_["WGS2"] : db_["WGS3"];
+  const auto m_bulk = (m_real / m_tile) * m_tile;
+  const auto n_bulk = (n_real / n_tile) * n_tile;
+  const auto m_tail = m_real - m_bulk;
+  const auto n_tail = n_real - n_bulk;
+
+  // The distances in the matrix between two consecutive rows and columns of the (rotated) matrix
+  const auto a_row_stride = (a_rotated) ? a_ld : size_t{1};
+  const auto a_col_stride = (a_rotated) ? size_t{1} : a_ld;
+
+  // Runs the fast kernel on the bulk part: the top-left m_bulk by n_bulk part of the matrix
+  auto event_wait_list = wait_for_events;
+  auto bulk_event = Event();
+  const auto bulk_is_last = (m_tail == 0) && (n_tail == 0);
   if (fast_kernel) {
-    kernel_name = "XgemvFast";
-    global_size = m_real / db_["WPT2"];
-    local_size = db_["WGS2"];
+    MatVecKernel("XgemvFast", m_bulk, n_bulk, alpha, beta, a_rotated, a_buffer, a_offset, a_ld, x_buffer, x_offset,
+                 x_inc, y_buffer, y_offset, y_inc, a_conjugate, parameter, kl, ku, m_bulk / db_["WPT2"], db_["WGS2"],
+                 (bulk_is_last) ? last_event : bulk_event.pointer(), event_wait_list);
+  } else {
+    MatVecKernel("XgemvFastRot", m_bulk, n_bulk, alpha, beta, a_rotated, a_buffer, a_offset, a_ld, x_buffer, x_offset,
+                 x_inc, y_buffer, y_offset, y_inc, a_conjugate, parameter, kl, ku, m_bulk, db_["WGS3"],
+                 (bulk_is_last) ? last_event : bulk_event.pointer(), event_wait_list);
+  }
+  if (bulk_is_last) {
+    return;
   }
-  if (fast_kernel_rot) {
-    kernel_name = "XgemvFastRot";
-    global_size = m_real;
-    local_size = db_["WGS3"];
+  event_wait_list = {bulk_event};
+
+  // Adds the contribution of the remaining columns to the bulk rows of y (hence beta is one)
+  if (n_tail > 0) {
+    auto tail_event = Event();
+    const auto n_tail_is_last = (m_tail == 0);
+    const auto m_ceiled = Ceil(m_bulk, db_["WGS1"] * db_["WPT1"]);
+    MatVecKernel("Xgemv", m_bulk, n_tail, alpha, ConstantOne<T>(), a_rotated, a_buffer,
+                 a_offset + n_bulk * a_col_stride, a_ld, x_buffer, x_offset + n_bulk * x_inc, x_inc, y_buffer,
+                 y_offset, y_inc, a_conjugate, parameter, kl, ku, m_ceiled / db_["WPT1"], db_["WGS1"],
+                 (n_tail_is_last) ? last_event : tail_event.pointer(), event_wait_list);
+    if (n_tail_is_last) {
+      return;
+    }
+    event_wait_list = {tail_event};
   }
 
-  // Retrieves the Xgemv kernel from the compiled binary
+  // Computes the remaining rows of y, using all columns of the matrix
+  const auto m_ceiled = Ceil(m_tail, db_["WGS1"] * db_["WPT1"]);
+  MatVecKernel("Xgemv", m_tail, n_real, alpha, beta, a_rotated, a_buffer, a_offset + m_bulk * a_row_stride, a_ld,
+               x_buffer, x_offset, x_inc, y_buffer, y_offset + m_bulk * y_inc, y_inc, a_conjugate, parameter, kl, ku,
+               m_ceiled / db_["WPT1"], db_["WGS1"], last_event, event_wait_list);
+}
+
+// Sets the arguments of one of the matrix-vector kernels and launches it
+template <typename T>
+void Xgemv<T>::MatVecKernel(const std::string& kernel_name, const size_t m, const size_t n,
+                            const ScalarArgument<T>& alpha, const ScalarArgument<T>& beta, const bool a_rotated,
+                            const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                            const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc,
+                            const bool a_conjugate, const size_t parameter, const size_t kl, const size_t ku,
+                            const size_t global_size, const size_t local_size, EventPointer event,
+                            const std::vector<Event>& wait_for_events) {
+  // Retrieves the kernel from the compiled binary
   auto kernel = Kernel(program_, kernel_name);
 
   // Sets the kernel arguments
-  kernel.SetArgument(0, static_cast<int>(m_real));
-  kernel.SetArgument(1, static_cast<int>(n_real));
-  kernel.SetArgument(2, GetRealArg(alpha));
-  kernel.SetArgument(3, GetRealArg(beta));
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  SetScalarArgument(kernel, 2, alpha);
+  SetScalarArgument(kernel, 3, beta);
   kernel.SetArgument(4, static_cast<int>(a_rotated));
   kernel.SetArgument(5, a_buffer());
   kernel.SetArgument(6, static_cast<int>(a_offset));
@@ -140,7 +206,7 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose, const si
   // Launches the kernel
   auto global = std::vector<size_t>{global_size};
   auto local = std::vector<size_t>{local_size};
-  RunKernel(kernel, queue_, device_, global, local, event_);
+  RunKernel(kernel, queue_, device_, global, local, event, wait_for_events);
 }
 
 // =================================================================================================
@@ -12,8 +12,10 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "routine.hpp"
+#include "routines/common.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -23,21 +25,32 @@ namespace clblast {
 template <typename T>
 class Xgemv : public Routine {
  public:
-  // Constructor
-  Xgemv(Queue& queue, EventPointer event, const std::string& name = "GEMV");
+  // Constructor, optionally for a version of the routine with the scalars in device memory
+  Xgemv(Queue& queue, EventPointer event, const std::string& name = "GEMV", const bool device_scalars = false);
 
   // Templated-precision implementation of the routine
-  void DoGemv(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n, const T alpha,
-              const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer,
-              const size_t x_offset, const size_t x_inc, const T beta, const Buffer<T>& y_buffer, const size_t y_offset,
-              const size_t y_inc);
+  void DoGemv(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+              const ScalarArgument<T>& alpha, const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, const ScalarArgument<T>& beta,
+              const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc);
 
   // Generic version used also for other matrix-vector multiplications
-  void MatVec(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n, const T alpha,
-              const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer,
-              const size_t x_offset, const size_t x_inc, const T beta, const Buffer<T>& y_buffer, const size_t y_offset,
-              const size_t y_inc, bool fast_kernel, bool fast_kernel_rot, const size_t parameter, const bool packed,
-              const size_t kl, const size_t ku);
+  void MatVec(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+              const ScalarArgument<T>& alpha, const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, const ScalarArgument<T>& beta,
+              const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc, bool fast_kernel,
+              bool fast_kernel_rot, const size_t parameter, const bool packed, const size_t kl, const size_t ku,
+              EventPointer event = nullptr, const std::vector<Event>& wait_for_events = {});
+
+ private:
+  // Launches a single matrix-vector kernel on (a part of) the matrix
+  void MatVecKernel(const std::string& kernel_name, const size_t m, const size_t n, const ScalarArgument<T>& alpha,
+                    const ScalarArgument<T>& beta, const bool a_rotated, const Buffer<T>& a_buffer,
+                    const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset,
+                    const size_t x_inc, const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc,
+                    const bool a_conjugate, const size_t parameter, const size_t kl, const size_t ku,
+                    const size_t global_size, const size_t local_size, EventPointer event,
+                    const std::vector<Event>& wait_for_events);
 };
 
 // =================================================================================================
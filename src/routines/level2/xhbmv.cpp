@@ -12,7 +12,7 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xgemv.hpp"
+#include "routines/level2/xgbmv.hpp"
 #include "utilities/backend.hpp"
 #include "utilities/utilities.hpp"
 
@@ -21,7 +21,7 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xhbmv<T>::Xhbmv(Queue& queue, EventPointer event, const std::string& name) : Xgemv<T>(queue, event, name) {}
+Xhbmv<T>::Xhbmv(Queue& queue, EventPointer event, const std::string& name) : Xgbmv<T>(queue, event, name) {}
 
 // =================================================================================================
 
@@ -35,12 +35,10 @@ void Xhbmv<T>::DoHbmv(const Layout layout, const Triangle triangle, const size_t
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific hermitian banded matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_HBMV define.
-  bool fast_kernels = false;
-  MatVec(layout, Transpose::kNo, n, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer,
-         y_offset, y_inc, fast_kernels, fast_kernels, is_upper, false, k, 0);
+  // Runs the banded matrix-vector multiplication on the stored triangle of the band. The specific hermitian
+  // banded matrix-accesses are implemented in the kernel guarded by the ROUTINE_HBMV define.
+  BandedMatVec(layout, Transpose::kNo, n, n, k, 0, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta,
+               y_buffer, y_offset, y_inc, is_upper);
 }
 
 // =================================================================================================
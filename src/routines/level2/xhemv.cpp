@@ -21,7 +21,7 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xhemv<T>::Xhemv(Queue& queue, EventPointer event, const std::string& name) : Xgemv<T>(queue, event, name) {}
+Xhemv<T>::Xhemv(Queue& queue, EventPointer event, const std::string& name) : Xsymv<T>(queue, event, name) {}
 
 // =================================================================================================
 
@@ -35,12 +35,10 @@ void Xhemv<T>::DoHemv(const Layout layout, const Triangle triangle, const size_t
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific hermitian matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_HEMV define.
-  bool fast_kernels = false;
-  MatVec(layout, Transpose::kNo, n, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer,
-         y_offset, y_inc, fast_kernels, fast_kernels, is_upper, false, 0, 0);
+  // Runs the symmetric matrix-vector multiplication. The specific hermitian matrix-accesses are implemented
+  // in the kernel guarded by the ROUTINE_HEMV define.
+  SymMatVec(layout, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc,
+            is_upper, false);
 }
 
 // =================================================================================================
@@ -64,7 +64,7 @@ half Xher<half, half>::GetAlpha(const half alpha) {
 template <typename T, typename U>
 void Xher<T, U>::DoHer(const Layout layout, const Triangle triangle, const size_t n, const U alpha,
                        const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, const Buffer<T>& a_buffer,
-                       const size_t a_offset, const size_t a_ld, const bool packed) {
+                       const size_t a_offset, const size_t a_ld) {
   // Makes sure the dimensions are larger than zero
   if (n == 0) {
     throw BLASError(StatusCode::kInvalidDimension);
@@ -76,11 +76,7 @@ void Xher<T, U>::DoHer(const Layout layout, const Triangle triangle, const size_
   const auto is_rowmajor = (layout == Layout::kRowMajor);
 
   // Tests the matrix and the vectors for validity
-  if (packed) {
-    TestMatrixAP(n, a_buffer, a_offset);
-  } else {
-    TestMatrixA(n, n, a_buffer, a_offset, a_ld);
-  }
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
   TestVectorX(n, x_buffer, x_offset, x_inc);
 
   // If alpha is zero an update is not required
@@ -32,7 +32,7 @@ class Xher : public Routine {
   // Templated-precision implementation of the routine
   void DoHer(const Layout layout, const Triangle triangle, const size_t n, const U alpha, const Buffer<T>& x_buffer,
              const size_t x_offset, const size_t x_inc, const Buffer<T>& a_buffer, const size_t a_offset,
-             const size_t a_ld, const bool packed = false);
+             const size_t a_ld);
 };
 
 // =================================================================================================
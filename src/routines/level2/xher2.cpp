@@ -41,7 +41,7 @@ template <typename T>
 void Xher2<T>::DoHer2(const Layout layout, const Triangle triangle, const size_t n, const T alpha,
                       const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, const Buffer<T>& y_buffer,
                       const size_t y_offset, const size_t y_inc, const Buffer<T>& a_buffer, const size_t a_offset,
-                      const size_t a_ld, const bool packed) {
+                      const size_t a_ld) {
   // Makes sure the dimensions are larger than zero
   if (n == 0) {
     throw BLASError(StatusCode::kInvalidDimension);
@@ -53,11 +53,7 @@ void Xher2<T>::DoHer2(const Layout layout, const Triangle triangle, const size_t
   const auto is_rowmajor = (layout == Layout::kRowMajor);
 
   // Tests the matrix and the vectors for validity
-  if (packed) {
-    TestMatrixAP(n, a_buffer, a_offset);
-  } else {
-    TestMatrixA(n, n, a_buffer, a_offset, a_ld);
-  }
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
   TestVectorX(n, x_buffer, x_offset, x_inc);
   TestVectorY(n, y_buffer, y_offset, y_inc);
 
@@ -29,8 +29,7 @@ class Xher2 : public Routine {
   // Templated-precision implementation of the routine
   void DoHer2(const Layout layout, const Triangle triangle, const size_t n, const T alpha, const Buffer<T>& x_buffer,
               const size_t x_offset, const size_t x_inc, const Buffer<T>& y_buffer, const size_t y_offset,
-              const size_t y_inc, const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
-              const bool packed = false);
+              const size_t y_inc, const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld);
 };
 
 // =================================================================================================
@@ -3,9 +3,9 @@
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xhpmv routine. It is based on the generalized mat-vec multiplication
-// routine (Xgemv). The Xhpmv class inherits from the templated class Xgemv, allowing it to call the
-// "MatVec" function directly.
+// This file implements the Xhpmv routine. It is based on the symmetric mat-vec multiplication
+// routine (Xsymv). The Xhpmv class inherits from the templated class Xsymv, allowing it to call the
+// "SymMatVec" function directly.
 //
 // =================================================================================================
 
@@ -15,7 +15,7 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xgemv.hpp"
+#include "routines/level2/xsymv.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -23,10 +23,10 @@ namespace clblast {
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xhpmv : public Xgemv<T> {
+class Xhpmv : public Xsymv<T> {
  public:
-  // Uses the generic matrix-vector routine
-  using Xgemv<T>::MatVec;
+  // Uses the symmetric matrix-vector routine
+  using Xsymv<T>::SymMatVec;
 
   // Constructor
   Xhpmv(Queue& queue, EventPointer event, const std::string& name = "HPMV");
@@ -12,7 +12,7 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xher2.hpp"
+#include "routines/level2/xspr2.hpp"
 #include "utilities/backend.hpp"
 #include "utilities/utilities.hpp"
 
@@ -21,7 +21,7 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xhpr2<T>::Xhpr2(Queue& queue, EventPointer event, const std::string& name) : Xher2<T>(queue, event, name) {}
+Xhpr2<T>::Xhpr2(Queue& queue, EventPointer event, const std::string& name) : Xspr2<T>(queue, event, name) {}
 
 // =================================================================================================
 
@@ -31,8 +31,8 @@ void Xhpr2<T>::DoHpr2(const Layout layout, const Triangle triangle, const size_t
                       const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, const Buffer<T>& y_buffer,
                       const size_t y_offset, const size_t y_inc, const Buffer<T>& ap_buffer, const size_t ap_offset) {
   // Specific Xhpr2 functionality is implemented in the kernel using defines
-  DoHer2(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, n,
-         true);  // packed matrix
+  PackedUpdate(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset,
+               true);  // rank-2 update
 }
 
 // =================================================================================================
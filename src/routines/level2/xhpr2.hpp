@@ -3,7 +3,9 @@
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xhpr2 routine. The precision is implemented using a template argument.
+// This file implements the Xhpr2 routine. It is based on the packed rank-2 update routine (Xspr2).
+// The Xhpr2 class inherits from the templated class Xspr2, allowing it to call the "PackedUpdate"
+// function directly.
 //
 // =================================================================================================
 
@@ -13,7 +15,7 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xher2.hpp"
+#include "routines/level2/xspr2.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -21,10 +23,10 @@ namespace clblast {
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xhpr2 : public Xher2<T> {
+class Xhpr2 : public Xspr2<T> {
  public:
-  // Uses the regular Xher2 routine
-  using Xher2<T>::DoHer2;
+  // Uses the generic packed update routine
+  using Xspr2<T>::PackedUpdate;
 
   // Constructor
   Xhpr2(Queue& queue, EventPointer event, const std::string& name = "HPR2");
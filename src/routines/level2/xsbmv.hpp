@@ -3,9 +3,9 @@
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xsbmv routine. It is based on the generalized mat-vec multiplication
-// routine (Xgemv). The Xsbmv class inherits from the templated class Xgemv, allowing it to call the
-// "MatVec" function directly.
+// This file implements the Xsbmv routine. It is based on the banded mat-vec multiplication
+// routine (Xgbmv). The Xsbmv class inherits from the templated class Xgbmv, allowing it to call the
+// "BandedMatVec" function directly.
 //
 // =================================================================================================
 
@@ -15,7 +15,7 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xgemv.hpp"
+#include "routines/level2/xgbmv.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -23,10 +23,10 @@ namespace clblast {
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xsbmv : public Xgemv<T> {
+class Xsbmv : public Xgbmv<T> {
  public:
   // Uses the generic matrix-vector routine
-  using Xgemv<T>::MatVec;
+  using Xgbmv<T>::BandedMatVec;
 
   // Constructor
   Xsbmv(Queue& queue, EventPointer event, const std::string& name = "SBMV");
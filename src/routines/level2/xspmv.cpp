@@ -21,7 +21,7 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xspmv<T>::Xspmv(Queue& queue, EventPointer event, const std::string& name) : Xgemv<T>(queue, event, name) {}
+Xspmv<T>::Xspmv(Queue& queue, EventPointer event, const std::string& name) : Xsymv<T>(queue, event, name) {}
 
 // =================================================================================================
 
@@ -35,12 +35,10 @@ void Xspmv<T>::DoSpmv(const Layout layout, const Triangle triangle, const size_t
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific symmetric packed matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_SPMV define.
-  bool fast_kernels = false;
-  MatVec(layout, Transpose::kNo, n, n, alpha, ap_buffer, ap_offset, n, x_buffer, x_offset, x_inc, beta, y_buffer,
-         y_offset, y_inc, fast_kernels, fast_kernels, is_upper, true, 0, 0);
+  // Runs the symmetric matrix-vector multiplication. The specific symmetric packed matrix-accesses are implemented
+  // in the kernel guarded by the ROUTINE_SPMV define.
+  SymMatVec(layout, n, alpha, ap_buffer, ap_offset, n, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc,
+            is_upper, true);
 }
 
 // =================================================================================================
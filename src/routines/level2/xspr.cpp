@@ -12,7 +12,7 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xher.hpp"
+#include "routines/level2/xspr2.hpp"
 #include "utilities/backend.hpp"
 #include "utilities/utilities.hpp"
 
@@ -21,7 +21,7 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xspr<T>::Xspr(Queue& queue, EventPointer event, const std::string& name) : Xher<T, T>(queue, event, name) {}
+Xspr<T>::Xspr(Queue& queue, EventPointer event, const std::string& name) : Xspr2<T>(queue, event, name) {}
 
 // =================================================================================================
 
@@ -31,8 +31,8 @@ void Xspr<T>::DoSpr(const Layout layout, const Triangle triangle, const size_t n
                     const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, const Buffer<T>& ap_buffer,
                     const size_t ap_offset) {
   // Specific Xspr functionality is implemented in the kernel using defines
-  DoHer(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, n,
-        true);  // packed matrix
+  PackedUpdate(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, x_buffer, x_offset, x_inc, ap_buffer, ap_offset,
+               false);  // rank-1 update
 }
 
 // =================================================================================================
@@ -3,7 +3,9 @@
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xspr routine. The precision is implemented using a template argument.
+// This file implements the Xspr routine. It is based on the packed rank-2 update routine (Xspr2).
+// The Xspr class inherits from the templated class Xspr2, allowing it to call the "PackedUpdate"
+// function directly.
 //
 // =================================================================================================
 
@@ -13,7 +15,7 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xher.hpp"
+#include "routines/level2/xspr2.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -21,10 +23,10 @@ namespace clblast {
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xspr : public Xher<T, T> {
+class Xspr : public Xspr2<T> {
  public:
-  // Uses the regular Xher routine
-  using Xher<T, T>::DoHer;
+  // Uses the generic packed update routine
+  using Xspr2<T>::PackedUpdate;
 
   // Constructor
   Xspr(Queue& queue, EventPointer event, const std::string& name = "SPR");
@@ -1,4 +1,3 @@
-
 // =================================================================================================
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
@@ -11,9 +10,13 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
-#include "routines/level2/xher2.hpp"
+#include "routine.hpp"
+#include "routines/common.hpp"
 #include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
 #include "utilities/utilities.hpp"
 
 namespace clblast {
@@ -21,7 +24,14 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xspr2<T>::Xspr2(Queue& queue, EventPointer event, const std::string& name) : Xher2<T>(queue, event, name) {}
+Xspr2<T>::Xspr2(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xspr"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level2/level2.opencl"
+// (comment to prevent auto-re-ordering)
+#include "../../kernels/level2/xspr.opencl"
+              }) {
+}
 
 // =================================================================================================
 
@@ -30,9 +40,66 @@ template <typename T>
 void Xspr2<T>::DoSpr2(const Layout layout, const Triangle triangle, const size_t n, const T alpha,
                       const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, const Buffer<T>& y_buffer,
                       const size_t y_offset, const size_t y_inc, const Buffer<T>& ap_buffer, const size_t ap_offset) {
-  // Specific Xspr2 functionality is implemented in the kernel using defines
-  DoHer2(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, n,
-         true);  // packed matrix
+  PackedUpdate(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset,
+               true);  // rank-2 update
+}
+
+// =================================================================================================
+
+// The generic implementation, also used by SPR, HPR and HPR2
+template <typename T>
+void Xspr2<T>::PackedUpdate(const Layout layout, const Triangle triangle, const size_t n, const T alpha,
+                            const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                            const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc,
+                            const Buffer<T>& ap_buffer, const size_t ap_offset, const bool rank_two) {
+  // Makes sure the dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // The data is either in the upper or lower triangle
+  const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  const auto is_rowmajor = (layout == Layout::kRowMajor);
+
+  // Tests the matrix and the vectors for validity
+  TestMatrixAP(n, ap_buffer, ap_offset);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  if (rank_two) {
+    TestVectorY(n, y_buffer, y_offset, y_inc);
+  }
+
+  // If alpha is zero a rank-1 update is not required
+  if (!rank_two && alpha == T{0}) {
+    return;
+  }
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, (rank_two) ? "Xspr2" : "Xspr");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, GetRealArg(alpha));
+  kernel.SetArgument(2, x_buffer());
+  kernel.SetArgument(3, static_cast<int>(x_offset));
+  kernel.SetArgument(4, static_cast<int>(x_inc));
+  if (rank_two) {
+    kernel.SetArgument(5, y_buffer());
+    kernel.SetArgument(6, static_cast<int>(y_offset));
+    kernel.SetArgument(7, static_cast<int>(y_inc));
+  }
+  const auto a_arg = (rank_two) ? 8 : 5;
+  kernel.SetArgument(a_arg + 0, ap_buffer());
+  kernel.SetArgument(a_arg + 1, static_cast<int>(ap_offset));
+  kernel.SetArgument(a_arg + 2, static_cast<int>(is_upper));
+  kernel.SetArgument(a_arg + 3, static_cast<int>(is_rowmajor));
+
+  // Launches the kernel: every column of threads processes a pair of packed columns of n+1 elements in total
+  auto global_one = Ceil(CeilDiv(n + 1, db_["WPT"]), db_["WGS"]);
+  auto global_two = CeilDiv(n, size_t{2});
+  auto global = std::vector<size_t>{global_one, global_two};
+  auto local = std::vector<size_t>{db_["WGS"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
 }
 
 // =================================================================================================
@@ -41,6 +108,8 @@ void Xspr2<T>::DoSpr2(const Layout layout, const Triangle triangle, const size_t
 template class Xspr2<half>;
 template class Xspr2<float>;
 template class Xspr2<double>;
+template class Xspr2<float2>;
+template class Xspr2<double2>;
 
 // =================================================================================================
 }  // namespace clblast
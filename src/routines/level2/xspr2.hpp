@@ -1,9 +1,10 @@
-
 // =================================================================================================
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xspr2 routine. The precision is implemented using a template argument.
+// This file implements the Xspr2 routine. It uses dedicated packed kernels which iterate over the
+// packed storage directly. The generic "PackedUpdate" function is also used by the other packed
+// rank-1 and rank-2 update routines (SPR, HPR, HPR2), which inherit from this class.
 //
 // =================================================================================================
 
@@ -13,7 +14,7 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xher2.hpp"
+#include "routine.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -21,11 +22,8 @@ namespace clblast {
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xspr2 : public Xher2<T> {
+class Xspr2 : public Routine {
  public:
-  // Uses the regular Xher2 routine
-  using Xher2<T>::DoHer2;
-
   // Constructor
   Xspr2(Queue& queue, EventPointer event, const std::string& name = "SPR2");
 
@@ -33,6 +31,13 @@ class Xspr2 : public Xher2<T> {
   void DoSpr2(const Layout layout, const Triangle triangle, const size_t n, const T alpha, const Buffer<T>& x_buffer,
               const size_t x_offset, const size_t x_inc, const Buffer<T>& y_buffer, const size_t y_offset,
               const size_t y_inc, const Buffer<T>& ap_buffer, const size_t ap_offset);
+
+  // Generic version used also for the other packed matrix updates. For rank-1 updates ('rank_two' set to false) the
+  // y vector is not used.
+  void PackedUpdate(const Layout layout, const Triangle triangle, const size_t n, const T alpha,
+                    const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, const Buffer<T>& y_buffer,
+                    const size_t y_offset, const size_t y_inc, const Buffer<T>& ap_buffer, const size_t ap_offset,
+                    const bool rank_two);
 };
 
 // =================================================================================================
@@ -9,11 +9,16 @@
 
 #include "routines/level2/xsymv.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <string>
+#include <vector>
 
-#include "routines/level2/xgemv.hpp"
+#include "routine.hpp"
+#include "routines/common.hpp"
 #include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
 #include "utilities/utilities.hpp"
 
 namespace clblast {
@@ -21,7 +26,12 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xsymv<T>::Xsymv(Queue& queue, EventPointer event, const std::string& name) : Xgemv<T>(queue, event, name) {}
+Xsymv<T>::Xsymv(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xsymv"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level2/xsymv.opencl"
+              }) {
+}
 
 // =================================================================================================
 
@@ -35,12 +45,79 @@ void Xsymv<T>::DoSymv(const Layout layout, const Triangle triangle, const size_t
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific symmetric matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_SYMV define.
-  bool fast_kernels = false;
-  MatVec(layout, Transpose::kNo, n, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer,
-         y_offset, y_inc, fast_kernels, fast_kernels, is_upper, false, 0, 0);
+  // Runs the symmetric matrix-vector multiplication. The specific symmetric matrix-accesses are implemented in the
+  // kernel guarded by the ROUTINE_SYMV define.
+  SymMatVec(layout, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc,
+            is_upper, false);
+}
+
+// =================================================================================================
+
+// The generic symmetric/hermitian implementation, also used by HEMV, SPMV and HPMV
+template <typename T>
+void Xsymv<T>::SymMatVec(const Layout layout, const size_t n, const T alpha, const Buffer<T>& a_buffer,
+                         const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset,
+                         const size_t x_inc, const T beta, const Buffer<T>& y_buffer, const size_t y_offset,
+                         const size_t y_inc, const size_t is_upper, const bool packed) {
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Row-major data is read as column-major, which only makes a difference for hermitian matrices: the kernel then
+  // conjugates the matrix (as the rotated access of the Xgemv kernel)
+  const auto a_rotated = (layout == Layout::kRowMajor);
+
+  // Tests the matrix and the vectors for validity
+  if (packed) {
+    TestMatrixAP(n, a_buffer, a_offset);
+  } else {
+    TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  }
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+
+  // Creates a workspace for the partial results, with one slot of size n for each work-group. The number of
+  // work-groups is bounded by the SLOTS parameter, such that the workspace grows only linearly with n.
+  const auto num_blocks = CeilDiv(n, db_["WGS"]);
+  const auto num_tiles = (num_blocks * (num_blocks + 1)) / 2;
+  const auto num_slots = std::min(db_["SLOTS"], num_tiles);
+  const auto w_ld = num_blocks * db_["WGS"];
+  auto w_buffer = Buffer<T>(context_, num_slots * w_ld);
+
+  // Computes the partial results, processing each tile of the stored triangle once. The work-groups loop over the
+  // tiles of the lower triangle only, such that none of them is idle.
+  auto kernel = Kernel(program_, "Xsymv");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, a_buffer());
+  kernel.SetArgument(2, static_cast<int>(a_offset));
+  kernel.SetArgument(3, static_cast<int>((packed) ? n : a_ld));
+  kernel.SetArgument(4, x_buffer());
+  kernel.SetArgument(5, static_cast<int>(x_offset));
+  kernel.SetArgument(6, static_cast<int>(x_inc));
+  kernel.SetArgument(7, w_buffer());
+  kernel.SetArgument(8, static_cast<int>(w_ld));
+  kernel.SetArgument(9, static_cast<int>(is_upper));
+  kernel.SetArgument(10, static_cast<int>(a_rotated));
+  auto global = std::vector<size_t>{num_slots * db_["WGS"]};
+  auto local = std::vector<size_t>{db_["WGS"]};
+  auto kernel_event = Event();
+  RunKernel(kernel, queue_, device_, global, local, kernel_event.pointer());
+
+  // Sums the partial results and computes the final result
+  auto reduce_kernel = Kernel(program_, "XsymvReduce");
+  reduce_kernel.SetArgument(0, static_cast<int>(n));
+  reduce_kernel.SetArgument(1, GetRealArg(alpha));
+  reduce_kernel.SetArgument(2, GetRealArg(beta));
+  reduce_kernel.SetArgument(3, w_buffer());
+  reduce_kernel.SetArgument(4, static_cast<int>(w_ld));
+  reduce_kernel.SetArgument(5, static_cast<int>(num_slots));
+  reduce_kernel.SetArgument(6, y_buffer());
+  reduce_kernel.SetArgument(7, static_cast<int>(y_offset));
+  reduce_kernel.SetArgument(8, static_cast<int>(y_inc));
+  auto eventWaitList = std::vector<Event>{kernel_event};
+  auto reduce_global = std::vector<size_t>{w_ld};
+  RunKernel(reduce_kernel, queue_, device_, reduce_global, local, event_, eventWaitList);
 }
 
 // =================================================================================================
@@ -49,6 +126,8 @@ void Xsymv<T>::DoSymv(const Layout layout, const Triangle triangle, const size_t
 template class Xsymv<half>;
 template class Xsymv<float>;
 template class Xsymv<double>;
+template class Xsymv<float2>;
+template class Xsymv<double2>;
 
 // =================================================================================================
 }  // namespace clblast
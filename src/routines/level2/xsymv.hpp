@@ -3,9 +3,9 @@
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xsymv routine. It is based on the generalized mat-vec multiplication
-// routine (Xgemv). The Xsymv class inherits from the templated class Xgemv, allowing it to call the
-// "MatVec" function directly.
+// This file implements the Xsymv routine. It uses dedicated kernels which read each element of the
+// stored triangle only once. The generic "SymMatVec" function is also used by the other symmetric
+// and hermitian matrix-vector routines (HEMV, SPMV, HPMV), which inherit from this class.
 //
 // =================================================================================================
 
@@ -15,7 +15,7 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xgemv.hpp"
+#include "routine.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -23,11 +23,8 @@ namespace clblast {
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xsymv : public Xgemv<T> {
+class Xsymv : public Routine {
  public:
-  // Uses the generic matrix-vector routine
-  using Xgemv<T>::MatVec;
-
   // Constructor
   Xsymv(Queue& queue, EventPointer event, const std::string& name = "SYMV");
 
@@ -35,6 +32,14 @@ class Xsymv : public Xgemv<T> {
   void DoSymv(const Layout layout, const Triangle triangle, const size_t n, const T alpha, const Buffer<T>& a_buffer,
               const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset,
               const size_t x_inc, const T beta, const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc);
+
+  // Generic version used also for the other symmetric and hermitian matrix-vector multiplications. It
+  // allocates a workspace of min(SLOTS, #tiles) * Ceil(n, WGS) elements for the partial results, which
+  // grows only linearly with n (e.g. 64 slots of n elements with the default parameters)
+  void SymMatVec(const Layout layout, const size_t n, const T alpha, const Buffer<T>& a_buffer, const size_t a_offset,
+                 const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, const T beta,
+                 const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc, const size_t is_upper,
+                 const bool packed);
 };
 
 // =================================================================================================
@@ -12,8 +12,10 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xgemv.hpp"
+#include "routines/common.hpp"
+#include "routines/level2/xgbmv.hpp"
 #include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
 #include "utilities/clblast_exceptions.hpp"
 #include "utilities/utilities.hpp"
 
@@ -22,7 +24,7 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xtbmv<T>::Xtbmv(Queue& queue, EventPointer event, const std::string& name) : Xgemv<T>(queue, event, name) {}
+Xtbmv<T>::Xtbmv(Queue& queue, EventPointer event, const std::string& name) : Xgbmv<T>(queue, event, name) {}
 
 // =================================================================================================
 
@@ -32,10 +34,14 @@ void Xtbmv<T>::DoTbmv(const Layout layout, const Triangle triangle, const Transp
                       const Diagonal diagonal, const size_t n, const size_t k, const Buffer<T>& a_buffer,
                       const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset,
                       const size_t x_inc) {
-  // Creates a copy of X: a temporary scratch buffer
-  const auto x_size = (1 + (n - 1) * x_inc) + x_offset;
-  auto scratch_buffer = Buffer<T>(context_, x_size);
-  x_buffer.CopyTo(queue_, x_size, scratch_buffer);
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the matrix and the vector for validity
+  TestMatrixA(k + 1, n, a_buffer, a_offset, a_ld);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
 
   // The data is either in the upper or lower triangle
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
@@ -44,26 +50,15 @@ void Xtbmv<T>::DoTbmv(const Layout layout, const Triangle triangle, const Transp
   // Adds '2' to the parameter if the diagonal is unit
   auto parameter = (diagonal == Diagonal::kUnit) ? is_upper + 2 : is_upper;
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific triangular banded matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_TBMV define.
-  auto fast_kernels = false;
-  try {
-    MatVec(layout, a_transpose, n, n, ConstantOne<T>(), a_buffer, a_offset, a_ld, scratch_buffer, x_offset, x_inc,
-           ConstantZero<T>(), x_buffer, x_offset, x_inc, fast_kernels, fast_kernels, parameter, false, k, 0);
-  } catch (BLASError& e) {
-    // Returns the proper error code (renames vector Y to X)
-    switch (e.status()) {
-      case StatusCode::kInvalidVectorY:
-        throw BLASError(StatusCode::kInvalidVectorX, e.details());
-      case StatusCode::kInvalidIncrementY:
-        throw BLASError(StatusCode::kInvalidIncrementX, e.details());
-      case StatusCode::kInsufficientMemoryY:
-        throw BLASError(StatusCode::kInsufficientMemoryX, e.details());
-      default:
-        throw;
-    }
-  }
+  // Determines whether the kernels need to perform rotated access ('^' is the XOR operator) and whether the matrix
+  // is conjugated, as in the generic matrix-vector kernel
+  const auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // Runs the in-place triangular matrix-vector multiplication. The specific matrix-accesses are implemented in the
+  // kernels guarded by the ROUTINE_TBMV define.
+  TriangularMatVec(queue_, device_, context_, program_, event_, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset,
+                   x_inc, a_rotated, a_conjugate, parameter, db_["WGS"]);
 }
 
 // =================================================================================================
@@ -3,9 +3,9 @@
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xtbmv routine. It is based on the generalized mat-vec multiplication
-// routine (Xgemv). The Xtbmv class inherits from the templated class Xgemv, allowing it to call the
-// "MatVec" function directly.
+// This file implements the Xtbmv routine. It computes the product in-place without a copy of x,
+// using the kernels of 'xtrmv.opencl'. The Xtbmv class inherits from the templated class Xgbmv, of
+// which it uses the compiled program and the tuning parameters.
 //
 // =================================================================================================
 
@@ -15,7 +15,7 @@
 #include <cstddef>
 #include <string>
 
-#include "routines/level2/xgemv.hpp"
+#include "routines/level2/xgbmv.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -23,12 +23,15 @@ namespace clblast {
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xtbmv : public Xgemv<T> {
+class Xtbmv : public Xgbmv<T> {
  public:
-  // Uses the generic matrix-vector routine
-  using Xgemv<T>::queue_;
-  using Xgemv<T>::context_;
-  using Xgemv<T>::MatVec;
+  // Uses the members of the base class
+  using Xgbmv<T>::queue_;
+  using Xgbmv<T>::device_;
+  using Xgbmv<T>::context_;
+  using Xgbmv<T>::program_;
+  using Xgbmv<T>::event_;
+  using Xgbmv<T>::db_;
 
   // Constructor
   Xtbmv(Queue& queue, EventPointer event, const std::string& name = "TBMV");
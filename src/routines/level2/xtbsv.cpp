@@ -0,0 +1,61 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtbsv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level2/xtbsv.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include "routines/level2/xtrsv.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xtbsv<T>::Xtbsv(Queue& queue, EventPointer event, const std::string& name) : Xtrsv<T>(queue, event, name) {}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xtbsv<T>::DoTbsv(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                      const Diagonal diagonal, const size_t n, const size_t k, const Buffer<T>& a_buffer,
+                      const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset,
+                      const size_t x_inc) {
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the banded matrix (k + 1 by n, in both layouts) and the vector
+  TestMatrixA(k + 1, n, a_buffer, a_offset, a_ld);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+
+  // Solves the system in-place using the triangular banded matrix-accesses of the kernel guarded by the ROUTINE_TBSV
+  // define. Only the 'k' elements within the band are used to update each block.
+  BandedPackedSubstitution(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer,
+                           x_offset, x_inc);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtbsv<half>;
+template class Xtbsv<float>;
+template class Xtbsv<double>;
+template class Xtbsv<float2>;
+template class Xtbsv<double2>;
+
+// =================================================================================================
+}  // namespace clblast
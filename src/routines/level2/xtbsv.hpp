@@ -0,0 +1,43 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtbsv routine. It solves a triangular banded system using the blocked
+// substitution of the Xtrsv routine, from which it inherits.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTBSV_H_
+#define CLBLAST_ROUTINES_XTBSV_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routines/level2/xtrsv.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xtbsv : public Xtrsv<T> {
+ public:
+  // Uses the blocked substitution of the triangular solver
+  using Xtrsv<T>::BandedPackedSubstitution;
+
+  // Constructor
+  Xtbsv(Queue& queue, EventPointer event, const std::string& name = "TBSV");
+
+  // Templated-precision implementation of the routine
+  void DoTbsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n, const size_t k, const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XTBSV_H_
+#endif
@@ -12,8 +12,10 @@
 #include <cstddef>
 #include <string>
 
+#include "routines/common.hpp"
 #include "routines/level2/xgemv.hpp"
 #include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
 #include "utilities/clblast_exceptions.hpp"
 #include "utilities/utilities.hpp"
 
@@ -31,10 +33,14 @@ template <typename T>
 void Xtpmv<T>::DoTpmv(const Layout layout, const Triangle triangle, const Transpose a_transpose,
                       const Diagonal diagonal, const size_t n, const Buffer<T>& ap_buffer, const size_t ap_offset,
                       const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc) {
-  // Creates a copy of X: a temporary scratch buffer
-  const auto x_size = (1 + (n - 1) * x_inc) + x_offset;
-  auto scratch_buffer = Buffer<T>(context_, x_size);
-  x_buffer.CopyTo(queue_, x_size, scratch_buffer);
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the matrix and the vector for validity
+  TestMatrixAP(n, ap_buffer, ap_offset);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
 
   // The data is either in the upper or lower triangle
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
@@ -43,26 +49,15 @@ void Xtpmv<T>::DoTpmv(const Layout layout, const Triangle triangle, const Transp
   // Adds '2' to the parameter if the diagonal is unit
   auto parameter = (diagonal == Diagonal::kUnit) ? is_upper + 2 : is_upper;
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific triangular packed matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_TPMV define.
-  auto fast_kernels = false;
-  try {
-    MatVec(layout, a_transpose, n, n, ConstantOne<T>(), ap_buffer, ap_offset, n, scratch_buffer, x_offset, x_inc,
-           ConstantZero<T>(), x_buffer, x_offset, x_inc, fast_kernels, fast_kernels, parameter, true, 0, 0);
-  } catch (BLASError& e) {
-    // Returns the proper error code (renames vector Y to X)
-    switch (e.status()) {
-      case StatusCode::kInvalidVectorY:
-        throw BLASError(StatusCode::kInvalidVectorX, e.details());
-      case StatusCode::kInvalidIncrementY:
-        throw BLASError(StatusCode::kInvalidIncrementX, e.details());
-      case StatusCode::kInsufficientMemoryY:
-        throw BLASError(StatusCode::kInsufficientMemoryX, e.details());
-      default:
-        throw;
-    }
-  }
+  // Determines whether the kernels need to perform rotated access ('^' is the XOR operator) and whether the matrix
+  // is conjugated, as in the generic matrix-vector kernel
+  const auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // Runs the in-place triangular matrix-vector multiplication. The specific matrix-accesses are implemented in the
+  // kernels guarded by the ROUTINE_TPMV define.
+  TriangularMatVec(queue_, device_, context_, program_, event_, n, n, ap_buffer, ap_offset, n, x_buffer, x_offset,
+                   x_inc, a_rotated, a_conjugate, parameter, db_["WGS1"]);
 }
 
 // =================================================================================================
@@ -3,9 +3,9 @@
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xtpmv routine. It is based on the generalized mat-vec multiplication
-// routine (Xgemv). The Xtpmv class inherits from the templated class Xgemv, allowing it to call the
-// "MatVec" function directly.
+// This file implements the Xtpmv routine. It computes the product in-place without a copy of x,
+// using the kernels of 'xtrmv.opencl'. The Xtpmv class inherits from the templated class Xgemv, of
+// which it uses the compiled program and the tuning parameters.
 //
 // =================================================================================================
 
@@ -25,10 +25,13 @@ namespace clblast {
 template <typename T>
 class Xtpmv : public Xgemv<T> {
  public:
-  // Uses the generic matrix-vector routine
+  // Uses the members of the base class
   using Xgemv<T>::queue_;
+  using Xgemv<T>::device_;
   using Xgemv<T>::context_;
-  using Xgemv<T>::MatVec;
+  using Xgemv<T>::program_;
+  using Xgemv<T>::event_;
+  using Xgemv<T>::db_;
 
   // Constructor
   Xtpmv(Queue& queue, EventPointer event, const std::string& name = "TPMV");
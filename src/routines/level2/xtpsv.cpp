@@ -0,0 +1,60 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtpsv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level2/xtpsv.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include "routines/level2/xtrsv.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xtpsv<T>::Xtpsv(Queue& queue, EventPointer event, const std::string& name) : Xtrsv<T>(queue, event, name) {}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xtpsv<T>::DoTpsv(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                      const Diagonal diagonal, const size_t n, const Buffer<T>& ap_buffer, const size_t ap_offset,
+                      const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc) {
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the packed matrix and the vector
+  TestMatrixAP(n, ap_buffer, ap_offset);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+
+  // Solves the system in-place using the triangular packed matrix-accesses of the kernel guarded by the ROUTINE_TPSV
+  // define. A packed matrix is treated as a banded matrix with a band of 'n - 1' elements.
+  BandedPackedSubstitution(layout, triangle, a_transpose, diagonal, n, n - 1, ap_buffer, ap_offset, n, x_buffer,
+                           x_offset, x_inc);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtpsv<half>;
+template class Xtpsv<float>;
+template class Xtpsv<double>;
+template class Xtpsv<float2>;
+template class Xtpsv<double2>;
+
+// =================================================================================================
+}  // namespace clblast
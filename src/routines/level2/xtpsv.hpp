@@ -0,0 +1,43 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtpsv routine. It solves a triangular packed system using the blocked
+// substitution of the Xtrsv routine, from which it inherits.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTPSV_H_
+#define CLBLAST_ROUTINES_XTPSV_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routines/level2/xtrsv.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xtpsv : public Xtrsv<T> {
+ public:
+  // Uses the blocked substitution of the triangular solver
+  using Xtrsv<T>::BandedPackedSubstitution;
+
+  // Constructor
+  Xtpsv(Queue& queue, EventPointer event, const std::string& name = "TPSV");
+
+  // Templated-precision implementation of the routine
+  void DoTpsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n, const Buffer<T>& ap_buffer, const size_t ap_offset, const Buffer<T>& x_buffer,
+              const size_t x_offset, const size_t x_inc);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XTPSV_H_
+#endif
@@ -34,7 +34,8 @@ template <typename T>
 void Xtrsv<T>::Substitution(const Layout layout, const Triangle triangle, const Transpose a_transpose,
                             const Diagonal diagonal, const size_t n, const Buffer<T>& a_buffer, const size_t a_offset,
                             const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_inc,
-                            const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, EventPointer event) {
+                            const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc, EventPointer event,
+                            const std::vector<Event>& wait_for_events) {
   if (n > db_["TRSV_BLOCK_SIZE"]) {
     throw BLASError(StatusCode::kUnexpectedError);
   };
@@ -73,7 +74,63 @@ void Xtrsv<T>::Substitution(const Layout layout, const Triangle triangle, const
   // Launches the kernel
   const auto local = std::vector<size_t>{db_["TRSV_BLOCK_SIZE"]};
   const auto global = std::vector<size_t>{Ceil(n, db_["TRSV_BLOCK_SIZE"])};
-  RunKernel(kernel, queue_, device_, global, local, event);
+  RunKernel(kernel, queue_, device_, global, local, event, wait_for_events);
+}
+
+// =================================================================================================
+
+template <typename T>
+void Xtrsv<T>::BandedPackedSubstitution(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                        const Diagonal diagonal, const size_t n, const size_t k,
+                                        const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                                        const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc) {
+  // A row-major matrix is treated as the transpose of a column-major matrix with the opposite triangle. The
+  // conjugate is kept as a separate flag, such that this also holds for the conjugate-transpose case.
+  const auto is_upper = ((triangle == Triangle::kUpper && layout == Layout::kColMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  const auto is_transposed = ((a_transpose != Transpose::kNo && layout == Layout::kColMajor) ||
+                              (a_transpose == Transpose::kNo && layout == Layout::kRowMajor));
+  const auto do_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto is_unit_diagonal = (diagonal == Diagonal::kUnit);
+  const auto is_forward = (is_upper == is_transposed);
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, "trsv_banded_packed");
+
+  // Loops over the blocks: each launch depends on the previous one through an event
+  const auto block_size = db_["TRSV_BLOCK_SIZE"];
+  const auto num_blocks = CeilDiv(n, block_size);
+  auto eventWaitList = std::vector<Event>();
+  for (auto block = size_t{0}; block < num_blocks; ++block) {
+    const auto block_id = (is_forward) ? block : num_blocks - 1 - block;
+    const auto block_offset = block_id * block_size;
+    const auto current_block_size = std::min(block_size, n - block_offset);
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, static_cast<int>(k));
+    kernel.SetArgument(2, static_cast<int>(block_offset));
+    kernel.SetArgument(3, static_cast<int>(current_block_size));
+    kernel.SetArgument(4, a_buffer());
+    kernel.SetArgument(5, static_cast<int>(a_offset));
+    kernel.SetArgument(6, static_cast<int>(a_ld));
+    kernel.SetArgument(7, x_buffer());
+    kernel.SetArgument(8, static_cast<int>(x_offset));
+    kernel.SetArgument(9, static_cast<int>(x_inc));
+    kernel.SetArgument(10, static_cast<int>(is_upper));
+    kernel.SetArgument(11, static_cast<int>(is_transposed));
+    kernel.SetArgument(12, static_cast<int>(is_unit_diagonal));
+    kernel.SetArgument(13, static_cast<int>(do_conjugate));
+
+    // Launches the kernel, the last one completes the routine
+    const auto is_last_block = (block + 1 == num_blocks);
+    auto kernel_event = Event();
+    const auto local = std::vector<size_t>{block_size};
+    const auto global = std::vector<size_t>{block_size};
+    RunKernel(kernel, queue_, device_, global, local, (is_last_block) ? event_ : kernel_event.pointer(),
+              eventWaitList);
+    eventWaitList = {kernel_event};
+  }
 }
 
 // =================================================================================================
@@ -97,20 +154,16 @@ void Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle, const Transp
   TestMatrixA(n, n, a_buffer, a_offset, a_ld);
   TestVectorX(n, b_buffer, b_offset, b_inc);
 
-  // Creates a copy of B to avoid overwriting input while computing output
-  // TODO: Make x with 0 offset and unit increment by creating custom copy-to and copy-from kernels
-  const auto x_offset = b_offset;
-  const auto x_inc = b_inc;
-  const auto x_size = (1 + (n - 1) * x_inc) + x_offset;
-  auto x_buffer = Buffer<T>(context_, x_size);
-  b_buffer.CopyTo(queue_, x_size, x_buffer);
+  // Temporary buffer holding per block the contributions of the already solved blocks (i.e. A * x). The solution
+  // itself is computed in-place in B, such that no copies of B are needed.
+  auto x_buffer = Buffer<T>(context_, n);
 
-  // Fills the output buffer with zeros
+  // Fills the temporary buffer with zeros, since the first block has no contributions
   auto eventWaitList = std::vector<Event>();
   auto fill_vector_event = Event();
-  FillVector(queue_, device_, program_, fill_vector_event.pointer(), eventWaitList, n, x_inc, x_offset, x_buffer,
+  FillVector(queue_, device_, program_, fill_vector_event.pointer(), eventWaitList, n, 1, 0, x_buffer,
              ConstantZero<T>(), 16);
-  fill_vector_event.WaitForCompletion();
+  eventWaitList.push_back(fill_vector_event);
 
   // Derives properties based on the arguments
   const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
@@ -118,10 +171,12 @@ void Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle, const Transp
   const auto is_transposed = ((layout == Layout::kColMajor && a_transpose == Transpose::kNo) ||
                               (layout != Layout::kColMajor && a_transpose != Transpose::kNo));
 
-  // Loops over the blocks
+  // Loops over the blocks. All kernels are enqueued at once: each depends on the previous one through an event, such
+  // that there are no host round-trips in between.
   auto col = n;  // the initial column position
   for (auto i = size_t{0}; i < n; i += db_["TRSV_BLOCK_SIZE"]) {
     const auto block_size = std::min(db_["TRSV_BLOCK_SIZE"], n - i);
+    const auto is_last_block = (i + block_size >= n);
 
     // Sets the next column position
     col = (is_upper) ? col - block_size : i;
@@ -129,30 +184,26 @@ void Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle, const Transp
     // Sets the offsets for upper or lower triangular
     const auto extra_offset_a = (is_transposed) ? (is_upper ? col + (col + block_size) * a_ld : col)
                                                 : (is_upper ? col + block_size + col * a_ld : col * a_ld);
-    const auto extra_offset_x = (is_upper) ? (col + block_size) * x_inc : 0;
-    const auto extra_offset_b = col * x_inc;
+    const auto extra_offset_b = (is_upper) ? (col + block_size) * b_inc : 0;
 
-    // Runs the GEMV routine to compute x' = A * x
+    // Runs the GEMV kernel to compute x' = A * b for the already solved part of b
     if (i > 0) {
       const auto gemv_m = (a_transpose == Transpose::kNo) ? block_size : i;
       const auto gemv_n = (a_transpose == Transpose::kNo) ? i : block_size;
       auto gemv_event = Event();
-      auto gemv = Xgemv<T>(queue_, gemv_event.pointer());
-      gemv.DoGemv(layout, a_transpose, gemv_m, gemv_n, ConstantOne<T>(), a_buffer, a_offset + extra_offset_a, a_ld,
-                  x_buffer, x_offset + extra_offset_x, x_inc, ConstantOne<T>(), x_buffer, x_offset + extra_offset_b,
-                  x_inc);
-      gemv_event.WaitForCompletion();
+      MatVec(layout, a_transpose, gemv_m, gemv_n, ConstantOne<T>(), a_buffer, a_offset + extra_offset_a, a_ld, b_buffer,
+             b_offset + extra_offset_b, b_inc, ConstantZero<T>(), x_buffer, col, 1, true, true, 0, false, 0, 0,
+             gemv_event.pointer(), eventWaitList);
+      eventWaitList = {gemv_event};
     }
 
-    // Runs the triangular substitution for the block size
+    // Runs the triangular substitution for the block size, the last one completes the routine
     auto sub_event = Event();
     Substitution(layout, triangle, a_transpose, diagonal, block_size, a_buffer, a_offset + col + col * a_ld, a_ld,
-                 b_buffer, b_offset + col * b_inc, b_inc, x_buffer, x_offset + col * x_inc, x_inc, sub_event.pointer());
-    sub_event.WaitForCompletion();
+                 b_buffer, b_offset + col * b_inc, b_inc, x_buffer, col, 1,
+                 (is_last_block) ? event_ : sub_event.pointer(), eventWaitList);
+    eventWaitList = {sub_event};
   }
-
-  // Retrieves the results
-  x_buffer.CopyToAsync(queue_, x_size, b_buffer, event_);
 }
 
 // =================================================================================================
@@ -14,6 +14,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "routines/level2/xgemv.hpp"
 #include "utilities/backend.hpp"
@@ -33,6 +34,7 @@ class Xtrsv : public Xgemv<T> {
   using Xgemv<T>::program_;
   using Xgemv<T>::event_;
   using Xgemv<T>::DoGemv;
+  using Xgemv<T>::MatVec;
 
   // Constructor
   Xtrsv(Queue& queue, EventPointer event, const std::string& name = "TRSV");
@@ -46,7 +48,14 @@ class Xtrsv : public Xgemv<T> {
   void Substitution(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
                     const size_t n, const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
                     const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_inc, const Buffer<T>& x_buffer,
-                    const size_t offset_x, const size_t x_inc, EventPointer event);
+                    const size_t offset_x, const size_t x_inc, EventPointer event,
+                    const std::vector<Event>& wait_for_events);
+
+  // Solves a banded (TBSV) or packed (TPSV) triangular system in-place, one block per kernel launch
+  void BandedPackedSubstitution(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                const Diagonal diagonal, const size_t n, const size_t k, const Buffer<T>& a_buffer,
+                                const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer,
+                                const size_t x_offset, const size_t x_inc);
 };
 
 // =================================================================================================
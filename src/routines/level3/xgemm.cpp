@@ -25,9 +25,9 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xgemm<T>::Xgemm(Queue& queue, EventPointer event, const std::string& name)
+Xgemm<T>::Xgemm(Queue& queue, EventPointer event, const std::string& name, const bool device_scalars)
     : Routine(queue, event, name, {"Copy", "Pad", "Transpose", "Padtranspose", "Xgemm", "XgemmDirect", "GemmRoutine"},
-              PrecisionValue<T>(), {},
+              PrecisionValue<T>(), {}, std::string{}, device_scalars,
               {
 #include "../../kernels/level3/level3.opencl"
 // (comment to prevent auto-re-ordering)
@@ -42,12 +42,16 @@ Xgemm<T>::Xgemm(Queue& queue, EventPointer event, const std::string& name)
 #include "../../kernels/level3/xgemm_direct_part1.opencl"
 #include "../../kernels/level3/xgemm_direct_part2.opencl"
 #include "../../kernels/level3/xgemm_direct_part3.opencl"
+#include "../../kernels/level3/xgemm_direct_symm.opencl"
+#include "../../kernels/level3/xgemm_direct_triangle.opencl"
                   ,  // separated in multiple parts to prevent C1091 in MSVC 2013
 #include "../../kernels/level3/xgemm_part1.opencl"
 #include "../../kernels/level3/xgemm_part2.opencl"
                   ,  // separated in multiple parts to prevent C1091 in MSVC 2013
 #include "../../kernels/level3/xgemm_part3.opencl"
 #include "../../kernels/level3/xgemm_part4.opencl"
+                  ,  // separated in multiple parts to prevent C1091 in MSVC 2013
+#include "../../kernels/level3/xgemm_streamk.opencl"
               }) {
 }
 
@@ -56,10 +60,13 @@ Xgemm<T>::Xgemm(Queue& queue, EventPointer event, const std::string& name)
 // The main routine
 template <typename T>
 void Xgemm<T>::DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose, const size_t m,
-                      const size_t n, const size_t k, const T alpha, const Buffer<T>& a_buffer, const size_t a_offset,
-                      const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld,
-                      const T beta, const Buffer<T>& c_buffer, const size_t c_offset, const size_t c_ld,
-                      const Buffer<T>& temp_buffer, const bool temp_buffer_provided) {  // optional arguments
+                      const size_t n, const size_t k, const ScalarArgument<T>& alpha, const Buffer<T>& a_buffer,
+                      const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset,
+                      const size_t b_ld, const ScalarArgument<T>& beta, const Buffer<T>& c_buffer,
+                      const size_t c_offset, const size_t c_ld,
+                      const Buffer<T>& temp_buffer, const bool temp_buffer_provided,  // optional arguments
+                      const size_t a_symmetry, const size_t b_symmetry, EventPointer event,
+                      const std::vector<Event>& wait_for_events) {
 
   // Two methods to choose from, select which one to run
   const auto do_gemm_direct = UseDirectKernel(m, n, k, db_["XGEMM_MIN_INDIRECT_SIZE"]);
@@ -82,14 +89,19 @@ void Xgemm<T>::DoGemm(const Layout layout, const Transpose a_transpose, const Tr
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
   TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
 
+  // Signals the routine's event when done, unless a separate event is given
+  const auto final_event = (event != nullptr) ? event : event_;
+
   // Selects which version of GEMM to run
   if (do_gemm_direct) {  // for small sizes (single kernel)
     GemmDirect(m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld,
-               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
+               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate, a_symmetry, b_symmetry,
+               final_event, wait_for_events);
   } else {  // for larger sizes (pre/post-processing plus a very fast kernel)
     GemmIndirect(m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld,
                  a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate, a_one, a_two, b_one, b_two,
-                 c_one, c_two, temp_buffer, temp_buffer_provided);
+                 c_one, c_two, temp_buffer, temp_buffer_provided, a_symmetry, b_symmetry, final_event,
+                 wait_for_events);
   }
 }
 
@@ -99,14 +111,16 @@ void Xgemm<T>::DoGemm(const Layout layout, const Transpose a_transpose, const Tr
 // requirements, but several pre and post-processing kernels take care of those. However, the
 // overhead of these extra kernels might not be ideal for certain devices/arguments.
 template <typename T>
-void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k, const T alpha, const Buffer<T>& a_buffer,
-                            const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset,
-                            const size_t b_ld, const T beta, const Buffer<T>& c_buffer, const size_t c_offset,
+void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k, const ScalarArgument<T>& alpha,
+                            const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld,
+                            const ScalarArgument<T>& beta, const Buffer<T>& c_buffer, const size_t c_offset,
                             const size_t c_ld, const bool a_do_transpose, const bool b_do_transpose,
                             const bool c_do_transpose, const bool a_conjugate, const bool b_conjugate,
                             const size_t a_one, const size_t a_two, const size_t b_one, const size_t b_two,
                             const size_t c_one, const size_t c_two, const Buffer<T>& temp_buffer,
-                            const bool temp_buffer_provided) {
+                            const bool temp_buffer_provided, const size_t a_symmetry, const size_t b_symmetry,
+                            EventPointer event, const std::vector<Event>& wait_for_events) {
   // Calculates the ceiled versions of m, n, and k
   const auto global_divider_one = c_want_rotated_(db_["GEMMK"]) ? db_["NWG"] : db_["MWG"];
   const auto global_divider_two = c_want_rotated_(db_["GEMMK"]) ? db_["MWG"] : db_["NWG"];
@@ -120,9 +134,12 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k, cons
   CalculateInternalDimensions(m, n, k, db_["MWG"], db_["NWG"], db_["KWG"] * db_["KREG"], a_one_i, a_two_i, b_one_i,
                               b_two_i, c_one_i, c_two_i, db_["GEMMK"]);
 
-  // Determines whether or not temporary matrices are needed
-  auto a_no_temp = NoTempBuffer(a_one, a_one_i, a_two, a_two_i, a_ld, a_offset, a_do_transpose, a_conjugate);
-  auto b_no_temp = NoTempBuffer(b_one, b_one_i, b_two, b_two_i, b_ld, b_offset, b_do_transpose, b_conjugate);
+  // Determines whether or not temporary matrices are needed. Symmetric or hermitian matrices stored
+  // as a triangle are always expanded into a temporary matrix.
+  auto a_no_temp = NoTempBuffer(a_one, a_one_i, a_two, a_two_i, a_ld, a_offset, a_do_transpose, a_conjugate) &&
+                   a_symmetry == 0;
+  auto b_no_temp = NoTempBuffer(b_one, b_one_i, b_two, b_two_i, b_ld, b_offset, b_do_transpose, b_conjugate) &&
+                   b_symmetry == 0;
   auto c_no_temp = NoTempBuffer(c_one, c_one_i, c_two, c_two_i, c_ld, c_offset, c_do_transpose, false);
 
   // Computes the sizes and offsets for (optional) temporary buffers for the 3 matrices
@@ -155,92 +172,214 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k, cons
   const auto b_temp = (b_no_temp) ? b_buffer : temp_buffer_all;
   const auto c_temp = (c_no_temp) ? c_buffer : temp_buffer_all;
 
-  // Events of all kernels (including pre/post processing kernels)
-  auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
+  // Events of all kernels (including pre/post processing kernels), starting with the events to wait for
+  auto eventWaitList = wait_for_events;
 
   // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
-  // case nothing has to be done, these kernels can be skipped.
+  // case nothing has to be done, these kernels can be skipped. A symmetric or hermitian matrix is
+  // expanded from its triangle straight into the padded temporary matrix.
   if (!a_no_temp) {
     auto eventProcessA = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), emptyEventList, a_one, a_two, a_ld, a_offset,
-                           a_buffer, a_one_i, a_two_i, a_one_i, 0, a_temp, ConstantOne<T>(), program_, true,
-                           a_do_transpose, a_conjugate);
+    if (a_symmetry != 0) {
+      SymmetricToSquared(eventProcessA.pointer(), a_one, a_ld, a_offset, a_buffer, a_one_i, a_two_i, 0, a_temp,
+                         a_symmetry, a_do_transpose, wait_for_events);
+    } else {
+      PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), wait_for_events, a_one, a_two, a_ld,
+                             a_offset, a_buffer, a_one_i, a_two_i, a_one_i, 0, a_temp, ConstantOne<T>(), program_,
+                             true, a_do_transpose, a_conjugate);
+    }
     eventWaitList.push_back(eventProcessA);
   }
 
   // As above, but now for matrix B
   if (!b_no_temp) {
     auto eventProcessB = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), emptyEventList, b_one, b_two, b_ld, b_offset,
-                           b_buffer, b_one_i, b_two_i, b_one_i, b_temp_offset, b_temp, ConstantOne<T>(), program_, true,
-                           b_do_transpose, b_conjugate);
+    if (b_symmetry != 0) {
+      SymmetricToSquared(eventProcessB.pointer(), b_one, b_ld, b_offset, b_buffer, b_one_i, b_two_i, b_temp_offset,
+                         b_temp, b_symmetry, b_do_transpose, wait_for_events);
+    } else {
+      PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), wait_for_events, b_one, b_two, b_ld,
+                             b_offset, b_buffer, b_one_i, b_two_i, b_one_i, b_temp_offset, b_temp, ConstantOne<T>(),
+                             program_, true, b_do_transpose, b_conjugate);
+    }
     eventWaitList.push_back(eventProcessB);
   }
 
-  // As above, but now for matrix C. This is only necessary if C is used both as input and output.
-  if (!c_no_temp && beta != static_cast<T>(0)) {
+  // As above, but now for matrix C. This is only necessary if C is used both as input and output,
+  // which is always assumed in case beta is in device memory.
+  if (!c_no_temp && (beta.on_device || beta.value != static_cast<T>(0))) {
     auto eventProcessC = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList, c_one, c_two, c_ld, c_offset,
-                           c_buffer, c_one_i, c_two_i, c_one_i, c_temp_offset, c_temp, ConstantOne<T>(), program_, true,
-                           c_do_transpose, false);
+    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), wait_for_events, c_one, c_two, c_ld,
+                           c_offset, c_buffer, c_one_i, c_two_i, c_one_i, c_temp_offset, c_temp, ConstantOne<T>(),
+                           program_, true, c_do_transpose, false);
     eventWaitList.push_back(eventProcessC);
   }
 
-  // Retrieves the Xgemm kernel from the compiled binary
-  auto kernel = Kernel(program_, "Xgemm");
+  // The event of the main kernel, which is the final event in case no post-processing is needed
+  auto eventKernel = Event();
+  auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event;
+
+  // Runs the persistent Stream-K version of the kernel in case the number of tiles doesn't divide
+  // evenly over the device, otherwise runs the regular version with one work-group per tile
+  const auto num_tiles = (c_one_i / db_["MWG"]) * (c_two_i / db_["NWG"]);
+  const auto num_iters = k_ceiled / (db_["KWG"] * db_["KREG"]);
+  const auto streamk_groups = device_.ComputeUnits() * db_["XGEMM_STREAMK_GROUPS"];
+  if (UseStreamKKernel(num_tiles, num_iters, streamk_groups)) {
+    GemmStreamK(m_ceiled, n_ceiled, k_ceiled, alpha, beta, a_temp, b_temp, c_temp, b_temp_offset, c_temp_offset,
+                streamk_groups, eventPointer, eventWaitList);
+  } else {
+    // Retrieves the Xgemm kernel from the compiled binary
+    auto kernel = Kernel(program_, "Xgemm");
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(m_ceiled));
+    kernel.SetArgument(1, static_cast<int>(n_ceiled));
+    kernel.SetArgument(2, static_cast<int>(k_ceiled));
+    SetScalarArgument(kernel, 3, alpha);
+    SetScalarArgument(kernel, 4, beta);
+    kernel.SetArgument(5, a_temp());
+    kernel.SetArgument(6, b_temp());
+    kernel.SetArgument(7, c_temp());
+    kernel.SetArgument(8, static_cast<int>(b_temp_offset / db_["VWN"]));
+    kernel.SetArgument(9, static_cast<int>(c_temp_offset / db_["VWM"]));
+
+    // Computes the global and local thread sizes
+    const auto global =
+        std::vector<size_t>{(c_one_i * db_["MDIMC"]) / db_["MWG"], (c_two_i * db_["NDIMC"]) / db_["NWG"]};
+    const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+
+    // Launches the kernel
+    RunKernel(kernel, queue_, device_, global, local, eventPointer, eventWaitList);
+  }
 
-  // Sets the kernel arguments
+  // Runs the post-processing kernel if needed
+  if (!c_no_temp) {
+    eventWaitList.push_back(eventKernel);
+    PadCopyTransposeMatrix(queue_, device_, db_, event, eventWaitList, c_one_i, c_two_i, c_one_i, c_temp_offset,
+                           c_temp, c_one, c_two, c_ld, c_offset, c_buffer, ConstantOne<T>(), program_, false,
+                           c_do_transpose, false);
+  }
+}
+
+// =================================================================================================
+
+// The Stream-K version of the main GEMM kernel. This launches a fixed number of persistent
+// work-groups which each process an equal share of all the iterations (tiles times iterations along
+// the K-dimension), followed by a fix-up kernel to combine the tiles which are split over
+// work-groups. It operates on the same (pre-processed) matrices as the regular indirect kernel.
+template <typename T>
+void Xgemm<T>::GemmStreamK(const size_t m_ceiled, const size_t n_ceiled, const size_t k_ceiled,
+                           const ScalarArgument<T>& alpha, const ScalarArgument<T>& beta, const Buffer<T>& a_temp,
+                           const Buffer<T>& b_temp, const Buffer<T>& c_temp, const size_t b_temp_offset,
+                           const size_t c_temp_offset, const size_t num_groups, EventPointer event,
+                           const std::vector<Event>& waitForEvents) {
+  // Creates the workspace for the partial results: two tiles per work-group
+  const auto workspace_size = 2 * num_groups * db_["MWG"] * db_["NWG"];
+  auto workspace = Buffer<T>(context_, workspace_size);
+
+  // Computes the global and local thread sizes, the same for both kernels
+  const auto global = std::vector<size_t>{num_groups * db_["MDIMC"], db_["NDIMC"]};
+  const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+
+  // Retrieves the Stream-K kernel from the compiled binary and sets its arguments
+  auto kernel = Kernel(program_, "XgemmStreamK");
   kernel.SetArgument(0, static_cast<int>(m_ceiled));
   kernel.SetArgument(1, static_cast<int>(n_ceiled));
   kernel.SetArgument(2, static_cast<int>(k_ceiled));
-  kernel.SetArgument(3, GetRealArg(alpha));
-  kernel.SetArgument(4, GetRealArg(beta));
+  SetScalarArgument(kernel, 3, alpha);
+  SetScalarArgument(kernel, 4, beta);
   kernel.SetArgument(5, a_temp());
   kernel.SetArgument(6, b_temp());
   kernel.SetArgument(7, c_temp());
   kernel.SetArgument(8, static_cast<int>(b_temp_offset / db_["VWN"]));
   kernel.SetArgument(9, static_cast<int>(c_temp_offset / db_["VWM"]));
+  kernel.SetArgument(10, workspace());
+
+  // Launches the Stream-K kernel
+  auto eventStreamK = Event();
+  RunKernel(kernel, queue_, device_, global, local, eventStreamK.pointer(), waitForEvents);
+
+  // Retrieves the fix-up kernel from the compiled binary and sets its arguments
+  auto fixup_kernel = Kernel(program_, "XgemmStreamKFixup");
+  fixup_kernel.SetArgument(0, static_cast<int>(m_ceiled));
+  fixup_kernel.SetArgument(1, static_cast<int>(n_ceiled));
+  fixup_kernel.SetArgument(2, static_cast<int>(k_ceiled));
+  SetScalarArgument(fixup_kernel, 3, alpha);
+  SetScalarArgument(fixup_kernel, 4, beta);
+  fixup_kernel.SetArgument(5, c_temp());
+  fixup_kernel.SetArgument(6, static_cast<int>(c_temp_offset));
+  fixup_kernel.SetArgument(7, workspace());
+
+  // Launches the fix-up kernel
+  auto eventWaitList = std::vector<Event>{eventStreamK};
+  RunKernel(fixup_kernel, queue_, device_, global, local, event, eventWaitList);
+}
 
-  // Computes the global and local thread sizes
-  const auto global = std::vector<size_t>{(c_one_i * db_["MDIMC"]) / db_["MWG"], (c_two_i * db_["NDIMC"]) / db_["NWG"]};
-  const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
-
-  // Launches the kernel
-  auto eventKernel = Event();
-  auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event_;
-  RunKernel(kernel, queue_, device_, global, local, eventPointer, eventWaitList);
+// =================================================================================================
 
-  // Runs the post-processing kernel if needed
-  if (!c_no_temp) {
-    eventWaitList.push_back(eventKernel);
-    PadCopyTransposeMatrix(queue_, device_, db_, event_, eventWaitList, c_one_i, c_two_i, c_one_i, c_temp_offset,
-                           c_temp, c_one, c_two, c_ld, c_offset, c_buffer, ConstantOne<T>(), program_, false,
-                           c_do_transpose, false);
+// Expands a symmetric or hermitian matrix of which only one triangle is stored (see 'SymmetryCode')
+// into the full and padded 'dest' matrix as expected by the indirect GEMM kernel. Transposing a
+// symmetric matrix doesn't change it, whereas the transpose of a hermitian matrix is its conjugate.
+template <typename T>
+void Xgemm<T>::SymmetricToSquared(EventPointer event, const size_t src_dim, const size_t src_ld,
+                                  const size_t src_offset, const Buffer<T>& src, const size_t dest_one,
+                                  const size_t dest_two, const size_t dest_offset, const Buffer<T>& dest,
+                                  const size_t symmetry, const bool do_transpose,
+                                  const std::vector<Event>& wait_for_events) {
+  const auto is_upper = (symmetry == 1 || symmetry == 3);
+  const auto is_hermitian = (symmetry == 3 || symmetry == 4);
+  const auto kernel_name = (is_hermitian) ? ((is_upper) ? "HermUpperToSquared" : "HermLowerToSquared")
+                                          : ((is_upper) ? "SymmUpperToSquared" : "SymmLowerToSquared");
+  auto kernel = Kernel(program_, kernel_name);
+
+  // Sets the arguments for the symmetric-to-squared kernel
+  kernel.SetArgument(0, static_cast<int>(src_dim));
+  kernel.SetArgument(1, static_cast<int>(src_ld));
+  kernel.SetArgument(2, static_cast<int>(src_offset));
+  kernel.SetArgument(3, src());
+  kernel.SetArgument(4, static_cast<int>(dest_one));
+  kernel.SetArgument(5, static_cast<int>(dest_two));
+  kernel.SetArgument(6, static_cast<int>(dest_one));
+  kernel.SetArgument(7, static_cast<int>(dest_offset));
+  kernel.SetArgument(8, dest());
+  if (is_hermitian) {
+    kernel.SetArgument(9, static_cast<int>(do_transpose));
   }
+
+  // Uses the common padding kernel's thread configuration. This is allowed, since the
+  // symmetric-to-squared kernel uses the same parameters.
+  const auto global = std::vector<size_t>{Ceil(CeilDiv(dest_one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                          Ceil(CeilDiv(dest_two, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event, wait_for_events);
 }
 
 // =================================================================================================
 
-// The direct version of GEMM, requiring just one kernel, no pre or post-processing kernels.
+// The direct version of GEMM, requiring just one kernel, no pre or post-processing kernels. In case
+// one of the inputs is a symmetric or hermitian matrix, it is read directly from its triangle.
 template <typename T>
-void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k, const T alpha, const Buffer<T>& a_buffer,
-                          const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset,
-                          const size_t b_ld, const T beta, const Buffer<T>& c_buffer, const size_t c_offset,
+void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k, const ScalarArgument<T>& alpha,
+                          const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld,
+                          const ScalarArgument<T>& beta, const Buffer<T>& c_buffer, const size_t c_offset,
                           const size_t c_ld, const bool a_do_transpose, const bool b_do_transpose,
-                          const bool c_do_transpose, const bool a_conjugate, const bool b_conjugate) {
+                          const bool c_do_transpose, const bool a_conjugate, const bool b_conjugate,
+                          const size_t a_symmetry, const size_t b_symmetry, EventPointer event,
+                          const std::vector<Event>& wait_for_events) {
   // Retrieves the proper XgemmDirect kernel from the compiled binary
-  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectTT" : "XgemmDirectTN")
-                                     : (b_do_transpose ? "XgemmDirectNT" : "XgemmDirectNN");
+  const auto is_symmetric = (a_symmetry != 0 || b_symmetry != 0);
+  const auto name = std::string{(is_symmetric) ? "XgemmDirectSymm" : "XgemmDirect"} +
+                    ((a_do_transpose) ? (b_do_transpose ? "TT" : "TN") : (b_do_transpose ? "NT" : "NN"));
   auto kernel = Kernel(program_, name);
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(m));
   kernel.SetArgument(1, static_cast<int>(n));
   kernel.SetArgument(2, static_cast<int>(k));
-  kernel.SetArgument(3, GetRealArg(alpha));
-  kernel.SetArgument(4, GetRealArg(beta));
+  SetScalarArgument(kernel, 3, alpha);
+  SetScalarArgument(kernel, 4, beta);
   kernel.SetArgument(5, a_buffer());
   kernel.SetArgument(6, static_cast<int>(a_offset));
   kernel.SetArgument(7, static_cast<int>(a_ld));
@@ -253,6 +392,10 @@ void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k, const
   kernel.SetArgument(14, static_cast<int>(c_do_transpose));
   kernel.SetArgument(15, static_cast<int>(a_conjugate));
   kernel.SetArgument(16, static_cast<int>(b_conjugate));
+  if (is_symmetric) {
+    kernel.SetArgument(17, static_cast<int>(a_symmetry));
+    kernel.SetArgument(18, static_cast<int>(b_symmetry));
+  }
 
   // Computes the global and local thread sizes
   const auto m_ceiled = Ceil(m, db_["WGD"]);
@@ -264,7 +407,7 @@ void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k, const
   const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
 
   // Launches the kernel
-  RunKernel(kernel, queue_, device_, global, local, event_);
+  RunKernel(kernel, queue_, device_, global, local, event, wait_for_events);
 }
 
 // =================================================================================================
@@ -12,8 +12,10 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "routine.hpp"
+#include "routines/common.hpp"
 #include "utilities/backend.hpp"
 #include "utilities/clblast_exceptions.hpp"
 #include "utilities/utilities.hpp"
@@ -68,6 +70,25 @@ class Xgemm : public Routine {
     return (m_n_k < min_indirect_size_e3);
   }
 
+  // Selects whether to use the Stream-K version of the indirect GEMM kernel. This is only worth it
+  // when the tiles don't divide evenly over the persistent work-groups, and requires that each of
+  // the work-groups gets at least one iteration. A value of zero for 'num_groups' disables it.
+  static bool UseStreamKKernel(const size_t num_tiles, const size_t num_iters_per_tile, const size_t num_groups) {
+    if (num_groups == 0) {
+      return false;
+    }
+    return (num_tiles % num_groups != 0) && (num_tiles * num_iters_per_tile >= num_groups);
+  }
+
+  // Computes the code for a symmetric or hermitian input matrix of which only one triangle is stored
+  // (see 'LoadMatrixElement' in the direct GEMM kernel): 1 or 2 for the upper or lower triangle of a
+  // symmetric matrix, or 3 or 4 for a hermitian matrix. The triangle is relative to column-major.
+  static size_t SymmetryCode(const Layout layout, const Triangle triangle, const bool hermitian) {
+    const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                           (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+    return ((is_upper) ? 1 : 2) + ((hermitian) ? 2 : 0);
+  }
+
   // Process the user-arguments, computes secondary parameters
   static void ProcessArguments(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                                const size_t m, const size_t n, const size_t k, size_t& a_one, size_t& a_two,
@@ -151,31 +172,50 @@ class Xgemm : public Routine {
     c_two_i = (c_want_rotated_(gemm_kernel_id)) ? m_ceiled : n_ceiled;
   }
 
-  // Constructor
-  Xgemm(Queue& queue, EventPointer event, const std::string& name = "GEMM");
+  // Constructor, optionally for a version of the routine with the scalars in device memory
+  Xgemm(Queue& queue, EventPointer event, const std::string& name = "GEMM", const bool device_scalars = false);
 
   // Templated-precision implementation of the routine
   void DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose, const size_t m,
-              const size_t n, const size_t k, const T alpha, const Buffer<T>& a_buffer, const size_t a_offset,
-              const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld, const T beta,
-              const Buffer<T>& c_buffer, const size_t c_offset, const size_t c_ld,
-              const Buffer<T>& temp_buffer = Buffer<T>(0), const bool temp_buffer_provided = false);
+              const size_t n, const size_t k, const ScalarArgument<T>& alpha, const Buffer<T>& a_buffer,
+              const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset,
+              const size_t b_ld, const ScalarArgument<T>& beta, const Buffer<T>& c_buffer, const size_t c_offset,
+              const size_t c_ld,
+              const Buffer<T>& temp_buffer = Buffer<T>(0), const bool temp_buffer_provided = false,
+              const size_t a_symmetry = 0, const size_t b_symmetry = 0, EventPointer event = nullptr,
+              const std::vector<Event>& wait_for_events = {});
 
   // Indirect version of GEMM (with pre and post-processing kernels)
-  void GemmIndirect(const size_t m, const size_t n, const size_t k, const T alpha, const Buffer<T>& a_buffer,
-                    const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset,
-                    const size_t b_ld, const T beta, const Buffer<T>& c_buffer, const size_t c_offset,
-                    const size_t c_ld, const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
-                    const bool a_conjugate, const bool b_conjugate, const size_t a_one, const size_t a_two,
-                    const size_t b_one, const size_t b_two, const size_t c_one, const size_t c_two,
-                    const Buffer<T>& temp_buffer, const bool temp_buffer_provided);
+  void GemmIndirect(const size_t m, const size_t n, const size_t k, const ScalarArgument<T>& alpha,
+                    const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer,
+                    const size_t b_offset, const size_t b_ld, const ScalarArgument<T>& beta,
+                    const Buffer<T>& c_buffer, const size_t c_offset, const size_t c_ld, const bool a_do_transpose,
+                    const bool b_do_transpose, const bool c_do_transpose, const bool a_conjugate,
+                    const bool b_conjugate, const size_t a_one, const size_t a_two, const size_t b_one,
+                    const size_t b_two, const size_t c_one, const size_t c_two, const Buffer<T>& temp_buffer,
+                    const bool temp_buffer_provided, const size_t a_symmetry, const size_t b_symmetry,
+                    EventPointer event, const std::vector<Event>& wait_for_events);
+
+  // Expands a symmetric or hermitian matrix stored as a triangle into a full (padded) matrix
+  void SymmetricToSquared(EventPointer event, const size_t src_dim, const size_t src_ld, const size_t src_offset,
+                          const Buffer<T>& src, const size_t dest_one, const size_t dest_two,
+                          const size_t dest_offset, const Buffer<T>& dest, const size_t symmetry,
+                          const bool do_transpose, const std::vector<Event>& wait_for_events);
+
+  // Stream-K version of the main kernel of the indirect GEMM (with a fix-up kernel)
+  void GemmStreamK(const size_t m_ceiled, const size_t n_ceiled, const size_t k_ceiled, const ScalarArgument<T>& alpha,
+                   const ScalarArgument<T>& beta, const Buffer<T>& a_temp, const Buffer<T>& b_temp,
+                   const Buffer<T>& c_temp, const size_t b_temp_offset, const size_t c_temp_offset,
+                   const size_t num_groups, EventPointer event, const std::vector<Event>& waitForEvents);
 
   // Direct version of GEMM (no pre and post-processing kernels)
-  void GemmDirect(const size_t m, const size_t n, const size_t k, const T alpha, const Buffer<T>& a_buffer,
-                  const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset,
-                  const size_t b_ld, const T beta, const Buffer<T>& c_buffer, const size_t c_offset, const size_t c_ld,
+  void GemmDirect(const size_t m, const size_t n, const size_t k, const ScalarArgument<T>& alpha,
+                  const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer,
+                  const size_t b_offset, const size_t b_ld, const ScalarArgument<T>& beta, const Buffer<T>& c_buffer,
+                  const size_t c_offset, const size_t c_ld,
                   const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
-                  const bool a_conjugate, const bool b_conjugate);
+                  const bool a_conjugate, const bool b_conjugate, const size_t a_symmetry,
+                  const size_t b_symmetry, EventPointer event, const std::vector<Event>& wait_for_events);
 };
 
 // =================================================================================================
@@ -11,7 +11,6 @@
 
 #include <cstddef>
 #include <string>
-#include <vector>
 
 #include "routines/common.hpp"
 #include "routines/level3/xgemm.hpp"
@@ -47,51 +46,22 @@ void Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle trian
   // Checks for validity of the squared A matrix
   TestMatrixA(k, k, a_buffer, a_offset, a_ld);
 
-  // Determines which kernel to run based on the layout (the Xgemm kernel assumes column-major as
-  // default) and on whether we are dealing with an upper or lower triangle of the hermitian matrix
-  bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
-                   (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-  auto kernel_name = (is_upper) ? "HermUpperToSquared" : "HermLowerToSquared";
-
-  // Temporary buffer for a copy of the hermitian matrix
-  auto temp_herm = Buffer<T>(context_, k * k);
-
-  // Creates a general matrix from the hermitian matrix to be able to run the regular Xgemm
-  // routine afterwards
-  auto kernel = Kernel(program_, kernel_name);
-
-  // Sets the arguments for the hermitian-to-squared kernel
-  kernel.SetArgument(0, static_cast<int>(k));
-  kernel.SetArgument(1, static_cast<int>(a_ld));
-  kernel.SetArgument(2, static_cast<int>(a_offset));
-  kernel.SetArgument(3, a_buffer());
-  kernel.SetArgument(4, static_cast<int>(k));
-  kernel.SetArgument(5, static_cast<int>(k));
-  kernel.SetArgument(6, static_cast<int>(0));
-  kernel.SetArgument(7, temp_herm());
-
-  // Uses the common padding kernel's thread configuration. This is allowed, since the
-  // hermitian-to-squared kernel uses the same parameters.
-  auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                    Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-  auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
-  auto kernelEvent = Event();
-  RunKernel(kernel, queue_, device_, global, local, kernelEvent.pointer());
-
-  // Synchronize now: 'DoGemm' does not accept a list of events to wait for
-  kernelEvent.WaitForCompletion();
+  // The hermitian matrix is read directly from its stored triangle by the GEMM kernels, so no full
+  // copy of it is made. Its triangle depends on the layout (the Xgemm kernel assumes column-major as
+  // default) and on whether we are dealing with an upper or lower triangle of the hermitian matrix.
+  const auto symmetry = SymmetryCode(layout, triangle, true);
 
   // Runs the regular Xgemm code with either "C := AB+C" or ...
   if (side == Side::kLeft) {
-    DoGemm(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha, temp_herm, 0, k, b_buffer, b_offset, b_ld, beta,
-           c_buffer, c_offset, c_ld);
+    DoGemm(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+           beta, c_buffer, c_offset, c_ld, Buffer<T>(0), false, symmetry, 0);
   }
 
   // ... with "C := BA+C". Note that A and B are now reversed.
   else {
     try {
-      DoGemm(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha, b_buffer, b_offset, b_ld, temp_herm, 0, k, beta,
-             c_buffer, c_offset, c_ld);
+      DoGemm(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha, b_buffer, b_offset, b_ld, a_buffer, a_offset,
+             a_ld, beta, c_buffer, c_offset, c_ld, Buffer<T>(0), false, 0, symmetry);
     } catch (BLASError& e) {
       // A and B are now reversed, so also reverse the error codes returned from the Xgemm routine
       switch (e.status()) {
@@ -32,6 +32,7 @@ class Xhemm : public Xgemm<T> {
   using Xgemm<T>::program_;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::SymmetryCode;
 
   // Constructor
   Xhemm(Queue& queue, EventPointer event, const std::string& name = "HEMM");
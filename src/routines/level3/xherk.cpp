@@ -13,7 +13,6 @@
 #include <string>
 #include <vector>
 
-#include "routine.hpp"
 #include "routines/common.hpp"
 #include "routines/level3/xgemm.hpp"
 #include "utilities/backend.hpp"
@@ -25,23 +24,7 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T, typename U>
-Xherk<T, U>::Xherk(Queue& queue, EventPointer event, const std::string& name)
-    : Routine(queue, event, name, {"Copy", "Pad", "Transpose", "Padtranspose", "Xgemm"}, PrecisionValue<T>(), {},
-              {
-#include "../../kernels/level3/level3.opencl"
-// (comment to prevent auto-re-ordering)
-#include "../../kernels/level3/copy_fast.opencl"
-#include "../../kernels/level3/copy_pad.opencl"
-#include "../../kernels/level3/transpose_fast.opencl"
-#include "../../kernels/level3/transpose_pad.opencl"
-                  ,  // separated in multiple parts to prevent C1091 in MSVC 2013
-#include "../../kernels/level3/xgemm_part1.opencl"
-#include "../../kernels/level3/xgemm_part2.opencl"
-                  ,  // separated in multiple parts to prevent C1091 in MSVC 2013
-#include "../../kernels/level3/xgemm_part3.opencl"
-#include "../../kernels/level3/xgemm_part4.opencl"
-              }) {
-}
+Xherk<T, U>::Xherk(Queue& queue, EventPointer event, const std::string& name) : Xgemm<T>(queue, event, name) {}
 
 // =================================================================================================
 
@@ -68,16 +51,12 @@ void Xherk<T, U>::HerkAB(const Layout layout, const Triangle triangle, const Tra
                          const size_t b_offset, const size_t b_ld, const T complex_beta, const Buffer<T>& c_buffer,
                          const size_t c_offset, const size_t c_ld, EventPointer final_event,
                          const bool diagonal_to_zero) {
-  // Computes the transpose/conjugate options and sets the a/b/c sizes based on that
+  // Computes the transpose/conjugate options and sets the a/b/c sizes based on that. These are only
+  // used for the direct kernel, the off-diagonal blocks are computed by regular GEMMs.
   bool a_do_transpose, b_do_transpose, c_do_transpose, dummy1, dummy2;
   size_t a_one, a_two, b_one, b_two, c_one, c_two;
   Xgemm<T>::ProcessArguments(layout, a_transpose, b_transpose, n, n, k, a_one, a_two, b_one, b_two, c_one, c_two,
-                             a_do_transpose, b_do_transpose, c_do_transpose, dummy1, dummy2, db_["GEMMK"]);
-
-  // Determines whether to apply the conjugate transpose to matrix B (argument: no transpose) or
-  // to matrix A (argument: conjugate transpose)
-  auto a_conjugate = (a_transpose != Transpose::kNo);
-  auto b_conjugate = (b_transpose != Transpose::kNo);
+                             a_do_transpose, b_do_transpose, c_do_transpose, dummy1, dummy2, 0);
 
   // Tests the two matrices (A, C) for validity, first from a perspective of the OpenCL buffers and
   // their sizes, and then from a perspective of parameter values (e.g. n, k). Tests whether the
@@ -89,89 +68,125 @@ void Xherk<T, U>::HerkAB(const Layout layout, const Triangle triangle, const Tra
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
   TestMatrixC(n, n, c_buffer, c_offset, c_ld);
 
-  // Calculates the ceiled versions of n and k
-  auto n_ceiled = Ceil(Ceil(n, db_["MWG"]), db_["NWG"]);
-  auto k_ceiled = Ceil(k, db_["KWG"] * db_["KREG"]);
-
-  // Computes the first and second "internal" (ceiled) dimensions of the 3 matrices taking into account
-  // whether the matrices need to be rotated or not for the kernel.
-  const auto a_one_i = (Xgemm<T>::a_want_rotated_(db_["GEMMK"])) ? k_ceiled : n_ceiled;
-  const auto a_two_i = (Xgemm<T>::a_want_rotated_(db_["GEMMK"])) ? n_ceiled : k_ceiled;
-  const auto b_one_i = (!Xgemm<T>::b_want_rotated_(db_["GEMMK"])) ? k_ceiled : n_ceiled;
-  const auto b_two_i = (!Xgemm<T>::b_want_rotated_(db_["GEMMK"])) ? n_ceiled : k_ceiled;
-
-  // Decides which kernel to run: the upper-triangular or lower-triangular version
-  auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
-
-  // Determines whether or not temporary matrices are needed
-  const auto a_no_temp =
-      Xgemm<T>::NoTempBuffer(a_one, a_one_i, a_two, a_two_i, a_ld, a_offset, a_do_transpose, a_conjugate);
-  const auto b_no_temp =
-      Xgemm<T>::NoTempBuffer(b_one, b_one_i, b_two, b_two_i, b_ld, b_offset, b_do_transpose, b_conjugate);
-
-  // Creates the temporary matrices
-  auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, a_one_i * a_two_i);
-  auto b_temp = (b_no_temp) ? b_buffer : Buffer<T>(context_, b_one_i * b_two_i);
-  auto c_temp = Buffer<T>(context_, n_ceiled * n_ceiled);
-
-  // Events of all kernels (including pre/post processing kernels)
-  auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
-
-  // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
-  // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
-  // case nothing has to be done, these kernels can be skipped. Two copies are created.
-  if (!a_no_temp) {
-    auto eventProcessA = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), emptyEventList, a_one, a_two, a_ld, a_offset,
-                           a_buffer, a_one_i, a_two_i, a_one_i, 0, a_temp, ConstantOne<T>(), program_, true,
-                           a_do_transpose, a_conjugate);
-    eventWaitList.push_back(eventProcessA);
+  // Computes the triangle in-place, starting with the full matrix C
+  HerkRecursive(layout, triangle, a_transpose, b_transpose, n, k, complex_alpha, a_buffer, a_offset, a_ld, b_buffer,
+                b_offset, b_ld, complex_beta, c_buffer, c_offset, c_ld, a_do_transpose, b_do_transpose,
+                c_do_transpose, final_event, {}, diagonal_to_zero);
+}
+
+// =================================================================================================
+
+// Computes the triangle of an n by n diagonal block of C in-place, see Xsyrk::SyrkRecursive for the
+// details. A transposed matrix A or B is also conjugated, both in the direct kernel and in the
+// regular GEMMs of the off-diagonal blocks.
+template <typename T, typename U>
+void Xherk<T, U>::HerkRecursive(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                const Transpose b_transpose, const size_t n, const size_t k, const T complex_alpha,
+                                const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                                const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld,
+                                const T complex_beta, const Buffer<T>& c_buffer, const size_t c_offset,
+                                const size_t c_ld, const bool a_do_transpose, const bool b_do_transpose,
+                                const bool c_do_transpose, EventPointer final_event,
+                                const std::vector<Event>& wait_for_events, const bool diagonal_to_zero) {
+  // Determines whether to apply the conjugate transpose to matrix B (argument: no transpose) or
+  // to matrix A (argument: conjugate transpose)
+  const auto a_conjugate = (a_transpose != Transpose::kNo);
+  const auto b_conjugate = (b_transpose != Transpose::kNo);
+
+  // Selects the direct kernel for small sizes or for blocks that can't be split any further
+  if ((n <= db_["WGD"]) || Xgemm<T>::UseDirectKernel(n, n, k, db_["XGEMM_MIN_INDIRECT_SIZE"])) {
+    HerkDirect(triangle, n, k, complex_alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, complex_beta,
+               c_buffer, c_offset, c_ld, a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+               final_event, wait_for_events, diagonal_to_zero);
+    return;
   }
-  if (!b_no_temp) {
-    auto eventProcessB = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), emptyEventList, b_one, b_two, b_ld, b_offset,
-                           b_buffer, b_one_i, b_two_i, b_one_i, 0, b_temp, ConstantOne<T>(), program_, true,
-                           b_do_transpose, b_conjugate);
-    eventWaitList.push_back(eventProcessB);
+
+  // Computes the sizes of the blocks and the offsets of the second rows of op(A) and columns of op(B)
+  const auto n1 = Ceil(CeilDiv(n, 2), db_["WGD"]);
+  const auto n2 = n - n1;
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto a_offset2 = a_offset + n1 * ((a_rotated) ? a_ld : 1);
+  const auto b_offset2 = b_offset + n1 * ((b_rotated) ? 1 : b_ld);
+  const auto c_offset_right = c_offset + n1 * ((layout == Layout::kColMajor) ? c_ld : 1);
+  const auto c_offset_below = c_offset + n1 * ((layout == Layout::kColMajor) ? 1 : c_ld);
+  const auto c_offset2 = c_offset + n1 * (c_ld + 1);
+
+  // The first diagonal block
+  auto first_event = Event();
+  HerkRecursive(layout, triangle, a_transpose, b_transpose, n1, k, complex_alpha, a_buffer, a_offset, a_ld, b_buffer,
+                b_offset, b_ld, complex_beta, c_buffer, c_offset, c_ld, a_do_transpose, b_do_transpose,
+                c_do_transpose, first_event.pointer(), wait_for_events, diagonal_to_zero);
+
+  // The off-diagonal block
+  const auto a_gemm_transpose = (a_conjugate) ? Transpose::kConjugate : Transpose::kNo;
+  const auto b_gemm_transpose = (b_conjugate) ? Transpose::kConjugate : Transpose::kNo;
+  auto gemm_event = Event();
+  auto gemm_wait_list = std::vector<Event>{first_event};
+  if (triangle == Triangle::kLower) {
+    DoGemm(layout, a_gemm_transpose, b_gemm_transpose, n2, n1, k, complex_alpha, a_buffer, a_offset2, a_ld, b_buffer,
+           b_offset, b_ld, complex_beta, c_buffer, c_offset_below, c_ld, Buffer<T>(0), false, 0, 0,
+           gemm_event.pointer(), gemm_wait_list);
+  } else {
+    DoGemm(layout, a_gemm_transpose, b_gemm_transpose, n1, n2, k, complex_alpha, a_buffer, a_offset, a_ld, b_buffer,
+           b_offset2, b_ld, complex_beta, c_buffer, c_offset_right, c_ld, Buffer<T>(0), false, 0, 0,
+           gemm_event.pointer(), gemm_wait_list);
   }
 
-  // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
-  // modify the other triangle.
-  auto eventProcessC = Event();
-  PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList, n, n, c_ld, c_offset, c_buffer,
-                         n_ceiled, n_ceiled, n_ceiled, 0, c_temp, ConstantOne<T>(), program_, true, c_do_transpose,
-                         false);
-  eventWaitList.push_back(eventProcessC);
+  // The second diagonal block, which signals the final event
+  auto second_wait_list = std::vector<Event>{gemm_event};
+  HerkRecursive(layout, triangle, a_transpose, b_transpose, n2, k, complex_alpha, a_buffer, a_offset2, a_ld, b_buffer,
+                b_offset2, b_ld, complex_beta, c_buffer, c_offset2, c_ld, a_do_transpose, b_do_transpose,
+                c_do_transpose, final_event, second_wait_list, diagonal_to_zero);
+}
+
+// =================================================================================================
 
-  // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
-  auto kernel = Kernel(program_, kernel_name);
+// The direct version of HERK, requiring just one kernel, no pre or post-processing kernels. This
+// computes only the tiles of the requested triangle and stores the results directly in matrix C.
+template <typename T, typename U>
+void Xherk<T, U>::HerkDirect(const Triangle triangle, const size_t n, const size_t k, const T complex_alpha,
+                             const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                             const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld,
+                             const T complex_beta, const Buffer<T>& c_buffer, const size_t c_offset, const size_t c_ld,
+                             const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                             const bool a_conjugate, const bool b_conjugate, EventPointer final_event,
+                             const std::vector<Event>& wait_for_events, const bool diagonal_to_zero) {
+  // Retrieves the proper XgemmDirectTriangle kernel from the compiled binary
+  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectTriangleTT" : "XgemmDirectTriangleTN")
+                                     : (b_do_transpose ? "XgemmDirectTriangleNT" : "XgemmDirectTriangleNN");
+  auto kernel = Kernel(program_, name);
 
   // Sets the kernel arguments
-  kernel.SetArgument(0, static_cast<int>(n_ceiled));
-  kernel.SetArgument(1, static_cast<int>(k_ceiled));
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(k));
   kernel.SetArgument(2, GetRealArg(complex_alpha));
   kernel.SetArgument(3, GetRealArg(complex_beta));
-  kernel.SetArgument(4, a_temp());
-  kernel.SetArgument(5, b_temp());
-  kernel.SetArgument(6, c_temp());
-
-  // Computes the global and local thread sizes
-  auto global = std::vector<size_t>{(n_ceiled * db_["MDIMC"]) / db_["MWG"], (n_ceiled * db_["NDIMC"]) / db_["NWG"]};
-  auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+  kernel.SetArgument(4, a_buffer());
+  kernel.SetArgument(5, static_cast<int>(a_offset));
+  kernel.SetArgument(6, static_cast<int>(a_ld));
+  kernel.SetArgument(7, b_buffer());
+  kernel.SetArgument(8, static_cast<int>(b_offset));
+  kernel.SetArgument(9, static_cast<int>(b_ld));
+  kernel.SetArgument(10, c_buffer());
+  kernel.SetArgument(11, static_cast<int>(c_offset));
+  kernel.SetArgument(12, static_cast<int>(c_ld));
+  kernel.SetArgument(13, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(14, static_cast<int>(a_conjugate));
+  kernel.SetArgument(15, static_cast<int>(b_conjugate));
+  kernel.SetArgument(16, (triangle == Triangle::kUpper) ? 1 : 2);
+  kernel.SetArgument(17, static_cast<int>(diagonal_to_zero));
+
+  // Computes the global and local thread sizes: one work-group per tile of the triangle
+  const auto n_tiles = CeilDiv(n, db_["WGD"]);
+  const auto num_tiles = (n_tiles * (n_tiles + 1)) / 2;
+  const auto global = std::vector<size_t>{num_tiles * db_["MDIMCD"], db_["NDIMCD"]};
+  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
 
   // Launches the kernel
-  auto eventKernel = Event();
-  RunKernel(kernel, queue_, device_, global, local, eventKernel.pointer(), eventWaitList);
-  eventWaitList.push_back(eventKernel);
-
-  // Runs the post-processing kernel
-  const auto upper =
-      Xgemm<T>::c_want_rotated_(db_["GEMMK"]) ? (triangle == Triangle::kLower) : (triangle == Triangle::kUpper);
-  const auto lower = !upper;
-  PadCopyTransposeMatrix(queue_, device_, db_, final_event, eventWaitList, n_ceiled, n_ceiled, n_ceiled, 0, c_temp, n,
-                         n, c_ld, c_offset, c_buffer, ConstantOne<T>(), program_, false, c_do_transpose, false, upper,
-                         lower, diagonal_to_zero);
+  RunKernel(kernel, queue_, device_, global, local, final_event, wait_for_events);
 }
 
 // =================================================================================================
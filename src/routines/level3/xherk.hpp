@@ -5,7 +5,8 @@
 //
 // This file implements the Xherk routine. The precision is implemented using the template argument
 // 'T', whereas the alpha/beta arguments are of type 'U'. The implementation is very similar to the
-// Xsyrk routine.
+// Xsyrk routine: the triangle of C is computed in-place, recursively split in blocks for larger
+// sizes. Therefore, this class also inherits from the Xgemm class.
 //
 // =================================================================================================
 
@@ -14,8 +15,9 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
-#include "routine.hpp"
+#include "routines/level3/xgemm.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -23,8 +25,17 @@ namespace clblast {
 
 // See comment at top of file for a description of the class
 template <typename T, typename U>
-class Xherk : public Routine {
+class Xherk : public Xgemm<T> {
  public:
+  // Uses methods and variables the regular Xgemm routine
+  using Xgemm<T>::queue_;
+  using Xgemm<T>::context_;
+  using Xgemm<T>::device_;
+  using Xgemm<T>::program_;
+  using Xgemm<T>::db_;
+  using Xgemm<T>::event_;
+  using Xgemm<T>::DoGemm;
+
   // Constructor
   Xherk(Queue& queue, EventPointer event, const std::string& name = "HERK");
 
@@ -39,6 +50,23 @@ class Xherk : public Routine {
               const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld,
               const T complex_beta, const Buffer<T>& c_buffer, const size_t c_offset, const size_t c_ld,
               EventPointer final_event, const bool diagonal_to_zero);
+
+  // Computes the triangle in-place: directly for small sizes, recursively split in blocks otherwise
+  void HerkRecursive(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                     const Transpose b_transpose, const size_t n, const size_t k, const T complex_alpha,
+                     const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer,
+                     const size_t b_offset, const size_t b_ld, const T complex_beta, const Buffer<T>& c_buffer,
+                     const size_t c_offset, const size_t c_ld, const bool a_do_transpose, const bool b_do_transpose,
+                     const bool c_do_transpose, EventPointer final_event, const std::vector<Event>& wait_for_events,
+                     const bool diagonal_to_zero);
+
+  // Computes the triangle in-place with the direct kernel (no pre and post-processing kernels)
+  void HerkDirect(const Triangle triangle, const size_t n, const size_t k, const T complex_alpha,
+                  const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer,
+                  const size_t b_offset, const size_t b_ld, const T complex_beta, const Buffer<T>& c_buffer,
+                  const size_t c_offset, const size_t c_ld, const bool a_do_transpose, const bool b_do_transpose,
+                  const bool c_do_transpose, const bool a_conjugate, const bool b_conjugate, EventPointer final_event,
+                  const std::vector<Event>& wait_for_events, const bool diagonal_to_zero);
 };
 
 // =================================================================================================
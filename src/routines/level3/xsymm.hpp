@@ -5,8 +5,8 @@
 //
 // This file implements the Xsymm routine. It is based on the generalized matrix multiplication
 // routine (Xgemm). The Xsymm class inherits from the templated class Xgemm, allowing it to call the
-// "DoGemm" function directly. The "DoSymm" function first preprocesses the symmetric matrix by
-// transforming it into a general matrix, and then calls the regular GEMM code.
+// "DoGemm" function directly. The "DoSymm" function calls the regular GEMM code, which reads the
+// symmetric matrix directly from its stored triangle (or expands it as part of its pre-processing).
 //
 // =================================================================================================
 
@@ -34,6 +34,7 @@ class Xsymm : public Xgemm<T> {
   using Xgemm<T>::program_;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::SymmetryCode;
 
   // Constructor
   Xsymm(Queue& queue, EventPointer event, const std::string& name = "SYMM");
@@ -5,7 +5,7 @@
 //
 // This file implements the Xsyr2k routine. The precision is implemented using a template argument.
 // The implementation is very similar to Xsyrk (see header for details), except for the fact that
-// the main XgemmUpper/XgemmLower kernel is called twice: C = AB^T + C and C = BA^T + C.
+// the triangle is computed twice: C = AB^T + C and C = BA^T + C.
 //
 // =================================================================================================
 
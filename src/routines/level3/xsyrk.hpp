@@ -4,10 +4,10 @@
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
 // This file implements the Xsyrk routine. The precision is implemented using a template argument.
-// The implementation is based on the regular Xgemm routine and kernel, but with two main changes:
-// 1) The final unpad(transpose) kernel updates only the upper/lower triangular part.
-// 2) The main Xgemm kernel masks workgroups not contributing to usefull data. This is only for
-//    performance reasons, as the actual masking is done later (see the first point).
+// Only the upper/lower triangle of C is computed, in-place. Small matrices are computed by a single
+// triangular version of the direct GEMM kernel. Larger matrices are split recursively into two
+// diagonal blocks and an off-diagonal block: the latter is a regular GEMM, such that it can use the
+// tuned in-direct GEMM kernel. Therefore, this class inherits from the Xgemm class.
 //
 // =================================================================================================
 
@@ -16,8 +16,9 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
-#include "routine.hpp"
+#include "routines/level3/xgemm.hpp"
 #include "utilities/backend.hpp"
 
 namespace clblast {
@@ -25,8 +26,17 @@ namespace clblast {
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xsyrk : public Routine {
+class Xsyrk : public Xgemm<T> {
  public:
+  // Uses methods and variables the regular Xgemm routine
+  using Xgemm<T>::queue_;
+  using Xgemm<T>::context_;
+  using Xgemm<T>::device_;
+  using Xgemm<T>::program_;
+  using Xgemm<T>::db_;
+  using Xgemm<T>::event_;
+  using Xgemm<T>::DoGemm;
+
   // Constructor
   Xsyrk(Queue& queue, EventPointer event, const std::string& name = "SYRK");
 
@@ -40,6 +50,22 @@ class Xsyrk : public Routine {
               const size_t n, const size_t k, const T alpha, const Buffer<T>& a_buffer, const size_t a_offset,
               const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld, const T beta,
               const Buffer<T>& c_buffer, const size_t c_offset, const size_t c_ld, EventPointer final_event);
+
+  // Computes the triangle in-place: directly for small sizes, recursively split in blocks otherwise
+  void SyrkRecursive(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                     const Transpose b_transpose, const size_t n, const size_t k, const T alpha,
+                     const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer,
+                     const size_t b_offset, const size_t b_ld, const T beta, const Buffer<T>& c_buffer,
+                     const size_t c_offset, const size_t c_ld, const bool a_do_transpose, const bool b_do_transpose,
+                     const bool c_do_transpose, EventPointer final_event,
+                     const std::vector<Event>& wait_for_events);
+
+  // Computes the triangle in-place with the direct kernel (no pre and post-processing kernels)
+  void SyrkDirect(const Triangle triangle, const size_t n, const size_t k, const T alpha, const Buffer<T>& a_buffer,
+                  const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset,
+                  const size_t b_ld, const T beta, const Buffer<T>& c_buffer, const size_t c_offset,
+                  const size_t c_ld, const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                  EventPointer final_event, const std::vector<Event>& wait_for_events);
 };
 
 // =================================================================================================
@@ -9,8 +9,10 @@
 
 #include "routines/level3/xtrmm.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "routines/common.hpp"
@@ -23,18 +25,49 @@
 namespace clblast {
 // =================================================================================================
 
-// Constructor: forwards to base class constructor
+// Constructor: forwards to base class constructor and retrieves the TRMM-specific parameters
 template <typename T>
-Xtrmm<T>::Xtrmm(Queue& queue, EventPointer event, const std::string& name) : Xgemm<T>(queue, event, name) {}
+Xtrmm<T>::Xtrmm(Queue& queue, EventPointer event, const std::string& name)
+    : Xgemm<T>(queue, event, name), trmm_db_({"TrmmRoutine"}) {
+  Routine::InitDatabase(device_, {"TrmmRoutine"}, PrecisionValue<T>(), {}, trmm_db_);
+}
 
 // =================================================================================================
 
-// The main routine
+// The entry point: transforming into col-major (if needed) and then running the col-major version
 template <typename T>
-void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose,
-                      const Diagonal diagonal, const size_t m, const size_t n, const T alpha, const Buffer<T>& a_buffer,
+void Xtrmm<T>::DoTrmm(const Layout layout, Side side, Triangle triangle, const Transpose a_transpose,
+                      const Diagonal diagonal, size_t m, size_t n, const T alpha, const Buffer<T>& a_buffer,
                       const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset,
                       const size_t b_ld) {
+  // Converts row-major to a col-major problem in the same way as is done for TRSM: only the side
+  // (left/right) and the triangle (upper/lower) are changed and M/N are swapped
+  if (layout == Layout::kRowMajor) {
+    std::swap(m, n);
+    side = (side == Side::kLeft) ? Side::kRight : Side::kLeft;
+    triangle = (triangle == Triangle::kLower) ? Triangle::kUpper : Triangle::kLower;
+  }
+
+  // Runs the col-major version of TRMM
+  TrmmColMajor(side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld);
+}
+
+// =================================================================================================
+
+// The main routine. This is a blocked in-place version: B is processed in blocks of rows (left) or
+// columns (right), each computed as the product with the diagonal block of A followed by a GEMM
+// with the off-diagonal panel of A. The blocks are processed in such an order that the parts of B
+// used by the off-diagonal GEMM are not yet overwritten. The zero half of A is thus skipped, and only
+// a single block of B is copied at a time. All kernels are enqueued at once: each depends on the
+// previous one through an event, and the GEMMs are computed by this routine itself.
+template <typename T>
+void Xtrmm<T>::TrmmColMajor(const Side side, const Triangle triangle, const Transpose a_transpose,
+                            const Diagonal diagonal, const size_t m, const size_t n, const T alpha,
+                            const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld) {
+  // Settings: the size of the blocks of B and thus of the diagonal blocks of A
+  const auto block_size = static_cast<size_t>(trmm_db_["TRMM_BLOCK_SIZE"]);
+
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0)) {
     throw BLASError(StatusCode::kInvalidDimension);
@@ -42,88 +75,101 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
 
   // Computes the k dimension. This is based on whether or not matrix is A (on the left)
   // or B (on the right) in the Xgemm routine.
-  auto k = (side == Side::kLeft) ? m : n;
+  const auto k = (side == Side::kLeft) ? m : n;
 
   // Checks for validity of the triangular A matrix
   TestMatrixA(k, k, a_buffer, a_offset, a_ld);
 
   // Checks for validity of the input/output B matrix
-  const auto b_one = (layout == Layout::kRowMajor) ? n : m;
-  const auto b_two = (layout == Layout::kRowMajor) ? m : n;
-  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
-
-  // Creates a copy of B to avoid overwriting input in GEMM while computing output
-  const auto b_size = (b_ld * (b_two - 1) + b_one + b_offset);
-  auto b_buffer_copy = Buffer<T>(context_, b_size);
-  b_buffer.CopyTo(queue_, b_size, b_buffer_copy);
-
-  // Determines which kernel to run based on the layout (the Xgemm kernel assumes column-major as
-  // default) and on whether we are dealing with an upper or lower triangle of the triangular matrix
-  bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
-                   (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-  auto kernel_name = (is_upper) ? "TriaUpperToSquared" : "TriaLowerToSquared";
-
-  // Determines whether or not the triangular matrix is unit-diagonal
-  auto unit_diagonal = (diagonal == Diagonal::kUnit) ? true : false;
-
-  // Temporary buffer for a copy of the triangular matrix
-  auto temp_triangular = Buffer<T>(context_, k * k);
-
-  // Creates a general matrix from the triangular matrix to be able to run the regular Xgemm
-  // routine afterwards
-  auto kernel = Kernel(program_, kernel_name);
-
-  // Sets the arguments for the triangular-to-squared kernel
-  kernel.SetArgument(0, static_cast<int>(k));
-  kernel.SetArgument(1, static_cast<int>(a_ld));
-  kernel.SetArgument(2, static_cast<int>(a_offset));
-  kernel.SetArgument(3, a_buffer());
-  kernel.SetArgument(4, static_cast<int>(k));
-  kernel.SetArgument(5, static_cast<int>(k));
-  kernel.SetArgument(6, static_cast<int>(0));
-  kernel.SetArgument(7, temp_triangular());
-  kernel.SetArgument(8, static_cast<int>(unit_diagonal));
-
-  // Uses the common padding kernel's thread configuration. This is allowed, since the
-  // triangular-to-squared kernel uses the same parameters.
-  auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                    Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-  auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
-  auto kernelEvent = Event();
-  RunKernel(kernel, queue_, device_, global, local, kernelEvent.pointer());
-
-  // Synchronize now: 'DoGemm' does not accept a list of events to wait for
-  kernelEvent.WaitForCompletion();
-
-  // Runs the regular Xgemm code with either "B := alpha*A*B" or ...
-  if (side == Side::kLeft) {
-    DoGemm(layout, a_transpose, Transpose::kNo, m, n, k, alpha, temp_triangular, 0, k, b_buffer_copy, b_offset, b_ld,
-           ConstantZero<T>(), b_buffer, b_offset, b_ld);
-  }
-
-  // ... with "B := alpha*B*A". Note that A and B are now reversed.
-  else {
-    try {
-      DoGemm(layout, Transpose::kNo, a_transpose, m, n, k, alpha, b_buffer_copy, b_offset, b_ld, temp_triangular, 0, k,
-             ConstantZero<T>(), b_buffer, b_offset, b_ld);
-    } catch (BLASError& e) {
-      // A and B are now reversed, so also reverse the error codes returned from the Xgemm routine
-      switch (e.status()) {
-        case StatusCode::kInvalidMatrixA:
-          throw BLASError(StatusCode::kInvalidMatrixB, e.details());
-        case StatusCode::kInvalidMatrixB:
-          throw BLASError(StatusCode::kInvalidMatrixA, e.details());
-        case StatusCode::kInvalidLeadDimA:
-          throw BLASError(StatusCode::kInvalidLeadDimB, e.details());
-        case StatusCode::kInvalidLeadDimB:
-          throw BLASError(StatusCode::kInvalidLeadDimA, e.details());
-        case StatusCode::kInsufficientMemoryA:
-          throw BLASError(StatusCode::kInsufficientMemoryB, e.details());
-        case StatusCode::kInsufficientMemoryB:
-          throw BLASError(StatusCode::kInsufficientMemoryA, e.details());
-        default:
-          throw;
+  TestMatrixB(m, n, b_buffer, b_offset, b_ld);
+
+  // Derives properties based on the arguments. The blocks are processed from first to last when the
+  // off-diagonal panels of A are on the right (left side) or at the top (right side) of the diagonal.
+  const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
+                         (triangle == Triangle::kLower && a_transpose != Transpose::kNo));
+  const auto rest_after_block = (is_upper == (side == Side::kLeft));
+  const auto kernel_name = (triangle == Triangle::kUpper) ? "TriaUpperToSquared" : "TriaLowerToSquared";
+  const auto unit_diagonal = (diagonal == Diagonal::kUnit) ? true : false;
+
+  // Temporary buffers for a single diagonal block of A and for a single block of B
+  const auto num_blocks = CeilDiv(k, block_size);
+  const auto max_block_size = std::min(k, block_size);
+  const auto b_block_ld = (side == Side::kLeft) ? max_block_size : m;
+  auto temp_triangular = Buffer<T>(context_, max_block_size * max_block_size);
+  auto temp_b = Buffer<T>(context_, max_block_size * ((side == Side::kLeft) ? n : m));
+
+  // Loops over the blocks in the order as described above
+  auto event_wait_list = std::vector<Event>();
+  for (auto block_id = size_t{0}; block_id < num_blocks; ++block_id) {
+    const auto block = (rest_after_block) ? block_id : num_blocks - 1 - block_id;
+    const auto i = block * block_size;
+    const auto current_block_size = std::min(k - i, block_size);
+    const auto rest_start = (rest_after_block) ? i + current_block_size : 0;
+    const auto rest_size = (rest_after_block) ? k - i - current_block_size : i;
+
+    // Creates a general matrix from the diagonal block of the triangular matrix
+    auto kernel = Kernel(program_, kernel_name);
+    kernel.SetArgument(0, static_cast<int>(current_block_size));
+    kernel.SetArgument(1, static_cast<int>(a_ld));
+    kernel.SetArgument(2, static_cast<int>(a_offset + i * a_ld + i));
+    kernel.SetArgument(3, a_buffer());
+    kernel.SetArgument(4, static_cast<int>(current_block_size));
+    kernel.SetArgument(5, static_cast<int>(current_block_size));
+    kernel.SetArgument(6, static_cast<int>(0));
+    kernel.SetArgument(7, temp_triangular());
+    kernel.SetArgument(8, static_cast<int>(unit_diagonal));
+    const auto global = std::vector<size_t>{Ceil(CeilDiv(current_block_size, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                            Ceil(CeilDiv(current_block_size, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+    const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+    auto kernel_event = Event();
+    RunKernel(kernel, queue_, device_, global, local, kernel_event.pointer(), event_wait_list);
+    event_wait_list = {kernel_event};
+
+    // Copies the block of B, since it is both input and output of the multiplication with the
+    // diagonal block of A
+    const auto b_block_one = (side == Side::kLeft) ? current_block_size : m;
+    const auto b_block_two = (side == Side::kLeft) ? n : current_block_size;
+    const auto b_block_offset = (side == Side::kLeft) ? b_offset + i : b_offset + i * b_ld;
+    auto copy_event = Event();
+    PadCopyTransposeMatrix(queue_, device_, db_, copy_event.pointer(), event_wait_list, b_block_one, b_block_two,
+                           b_ld, b_block_offset, b_buffer, b_block_one, b_block_two, b_block_ld, 0, temp_b,
+                           ConstantOne<T>(), program_, true, false, false);
+    event_wait_list = {copy_event};
+
+    // Computes the block of B as the product with the diagonal block of A: either "B := alpha*A*B" or
+    // "B := alpha*B*A". The final block signals the routine's event, it has no off-diagonal panel.
+    const auto is_last_block = (block_id == num_blocks - 1);
+    auto gemm1_event = Event();
+    const auto gemm1_event_pointer = (is_last_block) ? event_ : gemm1_event.pointer();
+    if (side == Side::kLeft) {
+      DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo, current_block_size, n, current_block_size, alpha,
+             temp_triangular, 0, current_block_size, temp_b, 0, b_block_ld, ConstantZero<T>(), b_buffer,
+             b_block_offset, b_ld, Buffer<T>(0), false, 0, 0, gemm1_event_pointer, event_wait_list);
+    } else {
+      DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose, m, current_block_size, current_block_size, alpha, temp_b,
+             0, b_block_ld, temp_triangular, 0, current_block_size, ConstantZero<T>(), b_buffer, b_block_offset, b_ld,
+             Buffer<T>(0), false, 0, 0, gemm1_event_pointer, event_wait_list);
+    }
+    if (is_last_block) {
+      break;
+    }
+    event_wait_list = {gemm1_event};
+
+    // Adds the product with the off-diagonal panel of A and the not yet updated part of B
+    if (rest_size > 0) {
+      auto gemm2_event = Event();
+      if (side == Side::kLeft) {
+        const auto this_a_offset = (a_transpose == Transpose::kNo) ? rest_start * a_ld + i : i * a_ld + rest_start;
+        DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo, current_block_size, n, rest_size, alpha, a_buffer,
+               this_a_offset + a_offset, a_ld, b_buffer, b_offset + rest_start, b_ld, ConstantOne<T>(), b_buffer,
+               b_block_offset, b_ld, Buffer<T>(0), false, 0, 0, gemm2_event.pointer(), event_wait_list);
+      } else {
+        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i * a_ld + rest_start : rest_start * a_ld + i;
+        DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose, m, current_block_size, rest_size, alpha, b_buffer,
+               b_offset + rest_start * b_ld, b_ld, a_buffer, this_a_offset + a_offset, a_ld, ConstantOne<T>(),
+               b_buffer, b_block_offset, b_ld, Buffer<T>(0), false, 0, 0, gemm2_event.pointer(), event_wait_list);
       }
+      event_wait_list = {gemm2_event};
     }
   }
 }
@@ -3,9 +3,10 @@
 // This file is part of the CLBlast project. Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xtrmm routine. The implementation is based on first transforming the
-// upper/lower unit/non-unit triangular matrix into a regular matrix and then calling the GEMM
-// routine. Therefore, this class inherits from the Xgemm class.
+// This file implements the Xtrmm routine. The implementation is a blocked in-place version based on
+// the GEMM routine: the diagonal blocks of the upper/lower unit/non-unit triangular matrix are
+// transformed into regular matrices, the off-diagonal blocks are used directly. Therefore, this class
+// inherits from the Xgemm class.
 //
 // =================================================================================================
 
@@ -14,7 +15,9 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
+#include "database/database.hpp"
 #include "routines/level3/xgemm.hpp"
 #include "utilities/backend.hpp"
 
@@ -32,16 +35,25 @@ class Xtrmm : public Xgemm<T> {
   using Xgemm<T>::device_;
   using Xgemm<T>::program_;
   using Xgemm<T>::db_;
+  using Xgemm<T>::event_;
   using Xgemm<T>::DoGemm;
 
   // Constructor
   Xtrmm(Queue& queue, EventPointer event, const std::string& name = "TRMM");
 
   // Templated-precision implementation of the routine
-  void DoTrmm(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose,
-              const Diagonal diagonal, const size_t m, const size_t n, const T alpha, const Buffer<T>& a_buffer,
-              const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset,
-              const size_t b_ld);
+  void DoTrmm(const Layout layout, Side side, Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+              size_t m, size_t n, const T alpha, const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld);
+
+  // Implementation of the column-major version
+  void TrmmColMajor(const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                    const size_t m, const size_t n, const T alpha, const Buffer<T>& a_buffer, const size_t a_offset,
+                    const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+  // Separate database for the TRMM-specific parameters, the GEMM parameters are in 'db_'
+  Databases trmm_db_;
 };
 
 // =================================================================================================
@@ -29,9 +29,12 @@
 namespace clblast {
 // =================================================================================================
 
-// Constructor: forwards to base class constructor
+// Constructor: forwards to base class constructor and retrieves the TRSM-specific parameters
 template <typename T>
-Xtrsm<T>::Xtrsm(Queue& queue, EventPointer event, const std::string& name) : Xgemm<T>(queue, event, name) {}
+Xtrsm<T>::Xtrsm(Queue& queue, EventPointer event, const std::string& name)
+    : Xgemm<T>(queue, event, name), trsm_db_({"TrsmRoutine"}) {
+  Routine::InitDatabase(device_, {"TrsmRoutine"}, PrecisionValue<T>(), {}, trsm_db_);
+}
 
 // =================================================================================================
 
@@ -67,8 +70,8 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle, const Tran
                             const Diagonal diagonal, const size_t m, const size_t n, const T alpha,
                             const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
                             const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld) {
-  // Settings
-  constexpr auto block_size = size_t{16};  // tuneable
+  // Settings: the size of the inverted diagonal blocks, which is also the size of the leaves of the recursion
+  const auto block_size = static_cast<size_t>(trsm_db_["TRSM_BLOCK_SIZE"]);
 
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0)) {
@@ -80,6 +83,11 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle, const Tran
     throw RuntimeErrorCode(StatusCode::kNotImplemented);
   }
 
+  // The diagonal-block inversion only supports block sizes of 16, 32, 64 and 128
+  if ((block_size < 16) || (block_size > 128) || ((block_size & (block_size - 1)) != 0)) {
+    throw RuntimeErrorCode(StatusCode::kNotImplemented);
+  }
+
   // Computes the k dimension. This is based on whether or not matrix is A (on the left)
   // or B (on the right) in the Xgemm routine.
   const auto k = (side == Side::kLeft) ? m : n;
@@ -90,10 +98,9 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle, const Tran
   // Checks for validity of the input B matrix
   TestMatrixB(m, n, b_buffer, b_offset, b_ld);
 
-  // Creates a copy of B to avoid overwriting input in GEMM while computing output
+  // Creates a copy of B to avoid overwriting input in GEMM while computing output. All m-by-n values of X are
+  // written by the recursion below, the copy makes sure the values in between the columns are preserved.
   const auto b_size = b_ld * (n - 1) + m + b_offset;
-  const auto x_one = m;
-  const auto x_two = n;
   const auto x_size = b_size;
   const auto x_ld = b_ld;
   const auto x_offset = b_offset;
@@ -104,138 +111,90 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle, const Tran
   const auto a_inv_size = Ceil(k, block_size) * block_size;
   auto a_inv_buffer = Buffer<T>(context_, a_inv_size);
 
-  // Fills the output buffer with zeros
-  auto eventWaitList = std::vector<Event>();
-  auto fill_matrix_event = Event();
-  FillMatrix(queue_, device_, program_, fill_matrix_event.pointer(), eventWaitList, x_one, x_two, x_ld, x_offset,
-             x_buffer, ConstantZero<T>(), 16);
-  fill_matrix_event.WaitForCompletion();
-
-  // Inverts the diagonal blocks
+  // Inverts the diagonal blocks, the first GEMM of the solve waits for this to finish
   auto diagonal_invert_event = Event();
   auto inverter = Xinvert<T>(queue_, diagonal_invert_event.pointer());
   inverter.InvertMatrixDiagonalBlocks(Layout::kColMajor, triangle, diagonal, k, block_size, a_buffer, a_offset, a_ld,
                                       a_inv_buffer);
-  diagonal_invert_event.WaitForCompletion();
+  auto event_wait_list = std::vector<Event>{diagonal_invert_event};
 
-  // Derives properties based on the arguments
+  // Derives properties based on the arguments: true when (lower triangular) or (upper triangular and transposed)
   const auto condition = ((triangle == Triangle::kUpper && a_transpose != Transpose::kNo) ||
                           (triangle == Triangle::kLower && a_transpose == Transpose::kNo));
 
-  // Left side
-  if (side == Side::kLeft) {
-    // True when (lower triangular) or (upper triangular and transposed)
-    if (condition) {
-      for (auto i = size_t{0}; i < m; i += block_size) {
-        const auto gemm_alpha = (i == 0) ? alpha : ConstantOne<T>();
-        const auto current_block_size = std::min(m - i, block_size);
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo, current_block_size, n, current_block_size,
-                     gemm_alpha, a_inv_buffer, i * block_size, block_size, b_buffer, b_offset + i, b_ld,
-                     ConstantZero<T>(), x_buffer, x_offset + i, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i + block_size >= m) {
-          break;
-        }
-
-        const auto this_a_offset =
-            (a_transpose == Transpose::kNo) ? (i + block_size) + i * a_ld : i + (block_size + i) * a_ld;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo, m - i - block_size, n, block_size,
-                     ConstantNegOne<T>(), a_buffer, this_a_offset + a_offset, a_ld, x_buffer, x_offset + i, x_ld,
-                     gemm_alpha, b_buffer, b_offset + i + block_size, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
-    }
+  // The solve runs from the first to the last block for a lower triangular matrix on the left side or an upper
+  // triangular matrix on the right side, and from the last to the first block otherwise. All GEMMs are enqueued at
+  // once as a chain of events, such that there are no host round-trips in between.
+  const auto forward = (side == Side::kLeft) ? condition : !condition;
+  TrsmRecursive(side, a_transpose, forward, m, n, alpha, true, 0, k, block_size, a_buffer, a_offset, a_ld, a_inv_buffer,
+                b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld, event_wait_list);
+
+  // Retrieves the results, enqueued in-order after the last GEMM
+  x_buffer.CopyToAsync(queue_, b_size, b_buffer, event_);
+}
 
-    // True when (upper triangular) or (lower triangular and transposed)
-    else {
-      const auto special_block_size = (m % block_size == 0) ? block_size : (m % block_size);
-      const auto i_start = static_cast<int>(m) - static_cast<int>(special_block_size);
-      for (auto i = i_start; i >= 0; i -= static_cast<int>(block_size)) {
-        const auto current_block_size = (i == i_start) ? special_block_size : block_size;
-        const auto gemm_alpha = (i == i_start) ? alpha : ConstantOne<T>();
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo, current_block_size, n, current_block_size,
-                     gemm_alpha, a_inv_buffer, i * block_size, block_size, b_buffer, b_offset + i, b_ld,
-                     ConstantZero<T>(), x_buffer, x_offset + i, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i - static_cast<int>(block_size) < 0) {
-          break;
-        }
-
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i * a_ld : i;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo, i, n, current_block_size, ConstantNegOne<T>(),
-                     a_buffer, this_a_offset + a_offset, a_ld, x_buffer, x_offset + i, x_ld, gemm_alpha, b_buffer,
-                     b_offset, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
+// Solves the part [start, start + size) of the k-dimension recursively: the first half is solved, followed by a single
+// large GEMM which updates the right-hand side of the second half, followed by solving the second half. The recursion
+// stops at the size of the inverted diagonal blocks, which are then applied with a GEMM as well. The right-hand side
+// is only scaled by alpha when it is touched for the first time, indicated by 'first_touch'. The GEMMs are computed
+// by this routine itself (it is derived from Xgemm), each depending on the previous one through an event.
+template <typename T>
+void Xtrsm<T>::TrsmRecursive(const Side side, const Transpose a_transpose, const bool forward, const size_t m,
+                             const size_t n, const T alpha, const bool first_touch, const size_t start,
+                             const size_t size, const size_t block_size, const Buffer<T>& a_buffer,
+                             const size_t a_offset, const size_t a_ld, const Buffer<T>& a_inv_buffer,
+                             const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld,
+                             const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_ld,
+                             std::vector<Event>& event_wait_list) {
+  const auto gemm_alpha = (first_touch) ? alpha : ConstantOne<T>();
+
+  // Leaf of the recursion: multiplies with the inverse of a diagonal block
+  if (size <= block_size) {
+    auto gemm_event = Event();
+    if (side == Side::kLeft) {
+      DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo, size, n, size, gemm_alpha, a_inv_buffer,
+             start * block_size, block_size, b_buffer, b_offset + start, b_ld, ConstantZero<T>(), x_buffer,
+             x_offset + start, x_ld, Buffer<T>(0), false, 0, 0, gemm_event.pointer(), event_wait_list);
+    } else {
+      DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose, m, size, size, gemm_alpha, b_buffer,
+             b_offset + start * b_ld, b_ld, a_inv_buffer, start * block_size, block_size, ConstantZero<T>(), x_buffer,
+             x_offset + start * x_ld, x_ld, Buffer<T>(0), false, 0, 0, gemm_event.pointer(), event_wait_list);
     }
+    event_wait_list = {gemm_event};
+    return;
   }
 
-  // Right side
-  else {
-    // True when (lower triangular) or (upper triangular and transposed)
-    if (condition) {
-      const auto special_block_size = (n % block_size == 0) ? block_size : (n % block_size);
-      const auto i_start = static_cast<int>(n) - static_cast<int>(special_block_size);
-      for (auto i = i_start; i >= 0; i -= static_cast<int>(block_size)) {
-        const auto current_block_size = (i == i_start) ? special_block_size : block_size;
-        const auto gemm_alpha = (i == i_start) ? alpha : ConstantOne<T>();
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose, m, current_block_size, current_block_size,
-                     gemm_alpha, b_buffer, b_offset + i * b_ld, b_ld, a_inv_buffer, i * block_size, block_size,
-                     ConstantZero<T>(), x_buffer, x_offset + i * x_ld, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i - static_cast<int>(block_size) < 0) {
-          break;
-        }
-
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i : i * a_ld;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose, m, i, current_block_size, ConstantNegOne<T>(),
-                     x_buffer, x_offset + i * x_ld, x_ld, a_buffer, this_a_offset + a_offset, a_ld, gemm_alpha,
-                     b_buffer, b_offset, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
-    }
+  // Splits in two parts at a multiple of the block size, such that the leaves align with the inverted blocks
+  const auto split = start + CeilDiv(CeilDiv(size, block_size), size_t{2}) * block_size;
+  const auto first_start = (forward) ? start : split;
+  const auto first_size = (forward) ? split - start : start + size - split;
+  const auto second_start = (forward) ? split : start;
+  const auto second_size = size - first_size;
 
-    // True when (upper triangular) or (lower triangular and transposed)
-    else {
-      for (auto i = size_t{0}; i < n; i += block_size) {
-        const auto gemm_alpha = (i == 0) ? alpha : ConstantOne<T>();
-        const auto current_block_size = std::min(n - i, block_size);
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose, m, current_block_size, current_block_size,
-                     gemm_alpha, b_buffer, b_offset + i * b_ld, b_ld, a_inv_buffer, i * block_size, block_size,
-                     ConstantZero<T>(), x_buffer, x_offset + i * x_ld, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i + block_size >= n) {
-          break;
-        }
-
-        const auto this_a_offset =
-            (a_transpose == Transpose::kNo) ? i + (block_size + i) * a_ld : (i + block_size) + i * a_ld;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose, m, n - i - block_size, block_size,
-                     ConstantNegOne<T>(), x_buffer, x_offset + i * x_ld, x_ld, a_buffer, this_a_offset + a_offset, a_ld,
-                     gemm_alpha, b_buffer, b_offset + (i + block_size) * b_ld, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
-    }
+  // Solves the first part
+  TrsmRecursive(side, a_transpose, forward, m, n, alpha, first_touch, first_start, first_size, block_size, a_buffer,
+                a_offset, a_ld, a_inv_buffer, b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld, event_wait_list);
+
+  // Updates the right-hand side of the second part with the solution of the first part
+  auto gemm_event = Event();
+  if (side == Side::kLeft) {
+    const auto this_a_offset = (a_transpose == Transpose::kNo) ? second_start + first_start * a_ld
+                                                                 : first_start + second_start * a_ld;
+    DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo, second_size, n, first_size, ConstantNegOne<T>(), a_buffer,
+           a_offset + this_a_offset, a_ld, x_buffer, x_offset + first_start, x_ld, gemm_alpha, b_buffer,
+           b_offset + second_start, b_ld, Buffer<T>(0), false, 0, 0, gemm_event.pointer(), event_wait_list);
+  } else {
+    const auto this_a_offset = (a_transpose == Transpose::kNo) ? first_start + second_start * a_ld
+                                                                 : second_start + first_start * a_ld;
+    DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose, m, second_size, first_size, ConstantNegOne<T>(), x_buffer,
+           x_offset + first_start * x_ld, x_ld, a_buffer, a_offset + this_a_offset, a_ld, gemm_alpha, b_buffer,
+           b_offset + second_start * b_ld, b_ld, Buffer<T>(0), false, 0, 0, gemm_event.pointer(), event_wait_list);
   }
+  event_wait_list = {gemm_event};
 
-  // Retrieves the results
-  x_buffer.CopyToAsync(queue_, b_size, b_buffer, event_);
+  // Solves the second part, of which the right-hand side is now scaled by alpha
+  TrsmRecursive(side, a_transpose, forward, m, n, alpha, false, second_start, second_size, block_size, a_buffer,
+                a_offset, a_ld, a_inv_buffer, b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld, event_wait_list);
 }
 
 // =================================================================================================
@@ -13,7 +13,9 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
+#include "database/database.hpp"
 #include "routines/level3/xgemm.hpp"
 #include "utilities/backend.hpp"
 
@@ -45,6 +47,19 @@ class Xtrsm : public Xgemm<T> {
   void TrsmColMajor(const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
                     const size_t m, const size_t n, const T alpha, const Buffer<T>& a_buffer, const size_t a_offset,
                     const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+  // Recursive solver for a part of the column-major problem, using the inverted diagonal blocks at the leaves. Each
+  // GEMM waits for the events in 'event_wait_list', which is replaced by the event of the last enqueued GEMM.
+  void TrsmRecursive(const Side side, const Transpose a_transpose, const bool forward, const size_t m, const size_t n,
+                     const T alpha, const bool first_touch, const size_t start, const size_t size,
+                     const size_t block_size, const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                     const Buffer<T>& a_inv_buffer, const Buffer<T>& b_buffer, const size_t b_offset,
+                     const size_t b_ld, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_ld,
+                     std::vector<Event>& event_wait_list);
+
+  // Separate database for the TRSM-specific parameters, the GEMM parameters are in 'db_'
+  Databases trsm_db_;
 };
 
 // =================================================================================================
@@ -0,0 +1,114 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XamaxBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xamaxbatched.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XamaxBatched<T>::XamaxBatched(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level1/xamax.opencl"
+              }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XamaxBatched<T>::DoAmaxBatched(const size_t n, const Buffer<unsigned int>& imax_buffer,
+                                    const std::vector<size_t>& imax_offsets, const Buffer<T>& x_buffer,
+                                    const std::vector<size_t>& x_offsets, const size_t x_inc,
+                                    const size_t batch_count) {
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (x_offsets.size() != batch_count) || (imax_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestVectorX(n, x_buffer, x_offsets[batch], x_inc);
+    TestVectorIndex(1, imax_buffer, imax_offsets[batch]);
+  }
+
+  // Upload the offsets to the device
+  auto x_offsets_int = std::vector<int>(batch_count);
+  auto imax_offsets_int = std::vector<int>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    x_offsets_int[batch] = static_cast<int>(x_offsets[batch]);
+    imax_offsets_int[batch] = static_cast<int>(imax_offsets[batch]);
+  }
+  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto imax_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  x_offsets_device.Write(queue_, batch_count, x_offsets_int);
+  imax_offsets_device.Write(queue_, batch_count, imax_offsets_int);
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, "XamaxBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, x_buffer());
+  kernel.SetArgument(2, x_offsets_device());
+  kernel.SetArgument(3, static_cast<int>(x_inc));
+  kernel.SetArgument(4, imax_buffer());
+  kernel.SetArgument(5, imax_offsets_device());
+
+  // Launches the kernel: one work-group per batch, such that no epilogue kernel is needed
+  auto global = std::vector<size_t>{db_["WGS1"] * batch_count};
+  auto local = std::vector<size_t>{db_["WGS1"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The strided-batched version: computes the offsets and forwards to the main routine
+template <typename T>
+void XamaxBatched<T>::DoAmaxStridedBatched(const size_t n, const Buffer<unsigned int>& imax_buffer,
+                                           const size_t imax_offset, const size_t imax_stride,
+                                           const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const size_t x_stride, const size_t batch_count) {
+  auto x_offsets = std::vector<size_t>(batch_count);
+  auto imax_offsets = std::vector<size_t>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    x_offsets[batch] = x_offset + batch * x_stride;
+    imax_offsets[batch] = imax_offset + batch * imax_stride;
+  }
+  DoAmaxBatched(n, imax_buffer, imax_offsets, x_buffer, x_offsets, x_inc, batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XamaxBatched<half>;
+template class XamaxBatched<float>;
+template class XamaxBatched<double>;
+template class XamaxBatched<float2>;
+template class XamaxBatched<double2>;
+
+// =================================================================================================
+}  // namespace clblast
@@ -0,0 +1,102 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XamaxMatrix class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xamaxmatrix.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XamaxMatrix<T>::XamaxMatrix(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level1/xamax_matrix.opencl"
+              }) {
+}
+
+// =================================================================================================
+
+// The main routine: computes the indices of the absolute maxima of the n columns of the m by n matrix op(A)
+template <typename T>
+void XamaxMatrix<T>::DoAmaxMatrix(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                                  const Buffer<unsigned int>& imax_buffer, const size_t imax_offset,
+                                  const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld) {
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Determines whether the columns of op(A) are rotated in memory ('^' is the XOR operator). A conjugate
+  // transpose is the same as a regular transpose here, since the absolute values are not affected.
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto a_rotated = a_transposed ^ (layout == Layout::kRowMajor);
+  const auto a_one = (a_rotated) ? n : m;
+  const auto a_two = (a_rotated) ? m : n;
+
+  // Tests the matrix and the result vector for validity
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestVectorIndex(n, imax_buffer, imax_offset);
+
+  // Retrieves the kernel from the compiled binary and sets the kernel arguments. Contiguous columns are
+  // processed by one work-group each. Rotated columns are processed in tiles of neighbouring columns by 2D
+  // work-groups, such that memory accesses are coalesced while each column is still split over multiple threads.
+  auto kernel = Kernel(program_, (a_rotated) ? "XamaxMatrixRot" : "XamaxMatrix");
+  auto global = std::vector<size_t>{};
+  auto local = std::vector<size_t>{};
+  if (a_rotated) {
+    const auto columns_per_group = std::min(db_["WGS1"], size_t{16});  // equal to COLSR in the kernel
+    const auto threads_per_column = db_["WGS1"] / columns_per_group;  // equal to ROWSR in the kernel
+    kernel.SetArgument(0, static_cast<int>(m));
+    kernel.SetArgument(1, static_cast<int>(n));
+    kernel.SetArgument(2, a_buffer());
+    kernel.SetArgument(3, static_cast<int>(a_offset));
+    kernel.SetArgument(4, static_cast<int>(a_ld));
+    kernel.SetArgument(5, imax_buffer());
+    kernel.SetArgument(6, static_cast<int>(imax_offset));
+    global = {Ceil(n, columns_per_group), threads_per_column};
+    local = {columns_per_group, threads_per_column};
+  } else {
+    kernel.SetArgument(0, static_cast<int>(m));
+    kernel.SetArgument(1, a_buffer());
+    kernel.SetArgument(2, static_cast<int>(a_offset));
+    kernel.SetArgument(3, static_cast<int>(a_ld));
+    kernel.SetArgument(4, imax_buffer());
+    kernel.SetArgument(5, static_cast<int>(imax_offset));
+    global = {db_["WGS1"] * n};
+    local = {db_["WGS1"]};
+  }
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XamaxMatrix<half>;
+template class XamaxMatrix<float>;
+template class XamaxMatrix<double>;
+template class XamaxMatrix<float2>;
+template class XamaxMatrix<double2>;
+
+// =================================================================================================
+}  // namespace clblast
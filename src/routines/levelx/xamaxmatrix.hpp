@@ -0,0 +1,39 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XamaxMatrix routine. This is a non-blas matrix version of AMAX, computing
+// the index of the absolute maximum of each column (or row) of a matrix in a single kernel launch.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XAMAXMATRIX_H_
+#define CLBLAST_ROUTINES_XAMAXMATRIX_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XamaxMatrix : public Routine {
+ public:
+  // Constructor
+  XamaxMatrix(Queue& queue, EventPointer event, const std::string& name = "AMAXMATRIX");
+
+  // Templated-precision implementation of the routine
+  void DoAmaxMatrix(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                    const Buffer<unsigned int>& imax_buffer, const size_t imax_offset, const Buffer<T>& a_buffer,
+                    const size_t a_offset, const size_t a_ld);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XAMAXMATRIX_H_
+#endif
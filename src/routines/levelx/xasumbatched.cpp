@@ -0,0 +1,120 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XasumBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xasumbatched.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XasumBatched<T>::XasumBatched(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level1/reproducible.opencl"
+// (comment to prevent auto-re-ordering)
+#include "../../kernels/level1/xasum.opencl"
+              }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XasumBatched<T>::DoAsumBatched(const size_t n, const Buffer<T>& asum_buffer,
+                                    const std::vector<size_t>& asum_offsets, const Buffer<T>& x_buffer,
+                                    const std::vector<size_t>& x_offsets, const size_t x_inc,
+                                    const size_t batch_count) {
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (x_offsets.size() != batch_count) || (asum_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestVectorX(n, x_buffer, x_offsets[batch], x_inc);
+    TestVectorScalar(1, asum_buffer, asum_offsets[batch]);
+  }
+
+  // Upload the offsets to the device
+  auto x_offsets_int = std::vector<int>(batch_count);
+  auto asum_offsets_int = std::vector<int>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    x_offsets_int[batch] = static_cast<int>(x_offsets[batch]);
+    asum_offsets_int[batch] = static_cast<int>(asum_offsets[batch]);
+  }
+  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto asum_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  x_offsets_device.Write(queue_, batch_count, x_offsets_int);
+  asum_offsets_device.Write(queue_, batch_count, asum_offsets_int);
+
+  // Retrieves the kernel from the compiled binary: the reproducible mode has its own kernel, such that
+  // only that kernel is compiled without fused multiply-adds
+  const auto reproducible = (GetCurrentReductionMode() == ReductionMode::kReproducible);
+  auto kernel = Kernel(program_, (reproducible) ? "XasumBatchedReproducible" : "XasumBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, x_buffer());
+  kernel.SetArgument(2, x_offsets_device());
+  kernel.SetArgument(3, static_cast<int>(x_inc));
+  kernel.SetArgument(4, asum_buffer());
+  kernel.SetArgument(5, asum_offsets_device());
+  if (!reproducible) {
+    kernel.SetArgument(6, static_cast<int>(GetCurrentReductionMode() == ReductionMode::kCompensated));
+  }
+
+  // Launches the kernel: one work-group per batch, such that no epilogue kernel is needed
+  auto global = std::vector<size_t>{db_["WGS1"] * batch_count};
+  auto local = std::vector<size_t>{db_["WGS1"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The strided-batched version: computes the offsets and forwards to the main routine
+template <typename T>
+void XasumBatched<T>::DoAsumStridedBatched(const size_t n, const Buffer<T>& asum_buffer, const size_t asum_offset,
+                                           const size_t asum_stride, const Buffer<T>& x_buffer, const size_t x_offset,
+                                           const size_t x_inc, const size_t x_stride, const size_t batch_count) {
+  auto x_offsets = std::vector<size_t>(batch_count);
+  auto asum_offsets = std::vector<size_t>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    x_offsets[batch] = x_offset + batch * x_stride;
+    asum_offsets[batch] = asum_offset + batch * asum_stride;
+  }
+  DoAsumBatched(n, asum_buffer, asum_offsets, x_buffer, x_offsets, x_inc, batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XasumBatched<half>;
+template class XasumBatched<float>;
+template class XasumBatched<double>;
+template class XasumBatched<float2>;
+template class XasumBatched<double2>;
+
+// =================================================================================================
+}  // namespace clblast
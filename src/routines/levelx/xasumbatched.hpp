@@ -0,0 +1,45 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XasumBatched routine. This is a non-blas batched version of ASUM, computing
+// the absolute sums of many vectors in a single kernel launch.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XASUMBATCHED_H_
+#define CLBLAST_ROUTINES_XASUMBATCHED_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XasumBatched : public Routine {
+ public:
+  // Constructor
+  XasumBatched(Queue& queue, EventPointer event, const std::string& name = "ASUMBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoAsumBatched(const size_t n, const Buffer<T>& asum_buffer, const std::vector<size_t>& asum_offsets,
+                     const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets, const size_t x_inc,
+                     const size_t batch_count);
+
+  // As above, but with the vectors (and results) of the batches at a fixed distance from each other
+  void DoAsumStridedBatched(const size_t n, const Buffer<T>& asum_buffer, const size_t asum_offset,
+                            const size_t asum_stride, const Buffer<T>& x_buffer, const size_t x_offset,
+                            const size_t x_inc, const size_t x_stride, const size_t batch_count);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XASUMBATCHED_H_
+#endif
@@ -0,0 +1,46 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xaxpby class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xaxpby.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include "routines/levelx/xwaxpby.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xaxpby<T>::Xaxpby(Queue& queue, EventPointer event, const std::string& name) : Xwaxpby<T>(queue, event, name) {}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xaxpby<T>::DoAxpby(const size_t n, const T alpha, const Buffer<T>& x_buffer, const size_t x_offset,
+                        const size_t x_inc, const T beta, const Buffer<T>& y_buffer, const size_t y_offset,
+                        const size_t y_inc) {
+  // The result is written in-place to y, the kernel reads each element of y before overwriting it
+  DoWaxpby(n, alpha, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, y_buffer, y_offset, y_inc);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xaxpby<half>;
+template class Xaxpby<float>;
+template class Xaxpby<double>;
+template class Xaxpby<float2>;
+template class Xaxpby<double2>;
+
+// =================================================================================================
+}  // namespace clblast
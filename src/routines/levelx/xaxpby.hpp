@@ -0,0 +1,41 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xaxpby routine, computing y = alpha*x + beta*y. The Xaxpby class
+// inherits from the templated class Xwaxpby, allowing it to call the "DoWaxpby" function directly.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XAXPBY_H_
+#define CLBLAST_ROUTINES_XAXPBY_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routines/levelx/xwaxpby.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xaxpby : public Xwaxpby<T> {
+ public:
+  // Uses the regular Xwaxpby routine
+  using Xwaxpby<T>::DoWaxpby;
+
+  // Constructor
+  Xaxpby(Queue& queue, EventPointer event, const std::string& name = "AXPBY");
+
+  // Templated-precision implementation of the routine
+  void DoAxpby(const size_t n, const T alpha, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+               const T beta, const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XAXPBY_H_
+#endif
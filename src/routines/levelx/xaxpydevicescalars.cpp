@@ -0,0 +1,55 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xaxpydevicescalars class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xaxpydevicescalars.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include "routines/common.hpp"
+#include "routines/level1/xaxpy.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor, which compiles the kernels for device-side scalars
+template <typename T>
+Xaxpydevicescalars<T>::Xaxpydevicescalars(Queue& queue, EventPointer event, const std::string& name)
+    : Xaxpy<T>(queue, event, name, true) {}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xaxpydevicescalars<T>::DoAxpyDeviceScalars(const size_t n, const Buffer<T>& alpha_buffer,
+                                                 const size_t alpha_offset, const Buffer<T>& x_buffer,
+                                                 const size_t x_offset, const size_t x_inc,
+                                                 const Buffer<T>& y_buffer, const size_t y_offset,
+                                                 const size_t y_inc) {
+  // Tests the scalar for validity
+  TestVectorScalar(1, alpha_buffer, alpha_offset);
+
+  // Runs the regular routine, of which the kernels read the scalar from device memory
+  DoAxpy(n, ScalarArgument<T>(context_, queue_, alpha_buffer, alpha_offset), x_buffer, x_offset, x_inc, y_buffer,
+         y_offset, y_inc);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xaxpydevicescalars<half>;
+template class Xaxpydevicescalars<float>;
+template class Xaxpydevicescalars<double>;
+template class Xaxpydevicescalars<float2>;
+template class Xaxpydevicescalars<double2>;
+
+// =================================================================================================
+}  // namespace clblast
@@ -0,0 +1,46 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xaxpydevicescalars routine: the AXPY routine with alpha stored in device
+// memory instead of passed by value. This allows alpha to be the result of a preceding routine,
+// without the host having to wait for it. The class inherits from the regular Xaxpy class, of
+// which the kernels are compiled with DEVICE_SCALARS set (see 'scalar_arg' in common.opencl).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XAXPYDEVICESCALARS_H_
+#define CLBLAST_ROUTINES_XAXPYDEVICESCALARS_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routines/level1/xaxpy.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xaxpydevicescalars : public Xaxpy<T> {
+ public:
+  // Uses methods and variables the regular Xaxpy routine
+  using Xaxpy<T>::context_;
+  using Xaxpy<T>::queue_;
+  using Xaxpy<T>::DoAxpy;
+
+  // Constructor
+  Xaxpydevicescalars(Queue& queue, EventPointer event, const std::string& name = "AXPY");
+
+  // Templated-precision implementation of the routine
+  void DoAxpyDeviceScalars(const size_t n, const Buffer<T>& alpha_buffer, const size_t alpha_offset,
+                           const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                           const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XAXPYDEVICESCALARS_H_
+#endif
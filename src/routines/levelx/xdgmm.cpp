@@ -0,0 +1,143 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xdgmm class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xdgmm.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xdgmm<T>::Xdgmm(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xdgmm"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/levelx/xdgmm.opencl"
+              }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xdgmm<T>::DoDgmm(const Layout layout, const Side side, const size_t m, const size_t n,
+                      const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                      const Buffer<T>& c_buffer, const size_t c_offset, const size_t c_ld) {
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the matrices and the vector for validity: x holds the diagonal of an m by m (left) or n by n (right) matrix
+  const auto rotated = (layout == Layout::kRowMajor);
+  const auto one = (rotated) ? n : m;
+  const auto two = (rotated) ? m : n;
+  TestMatrixA(one, two, a_buffer, a_offset, a_ld);
+  TestMatrixC(one, two, c_buffer, c_offset, c_ld);
+  TestVectorX((side == Side::kLeft) ? m : n, x_buffer, x_offset, x_inc);
+
+  DgmmKernel(layout, side, m, n, a_buffer, a_offset, a_ld, 0, x_buffer, x_offset, x_inc, 0, c_buffer, c_offset, c_ld,
+             0, 1);
+}
+
+// The strided-batched version of the above
+template <typename T>
+void Xdgmm<T>::DoDgmmStridedBatched(const Layout layout, const Side side, const size_t m, const size_t n,
+                                    const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                                    const size_t a_stride, const Buffer<T>& x_buffer, const size_t x_offset,
+                                    const size_t x_inc, const size_t x_stride, const Buffer<T>& c_buffer,
+                                    const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                    const size_t batch_count) {
+  // Tests for a valid batch count
+  if (batch_count < 1) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero and that the batches of the output do not overlap
+  if ((m == 0) || (n == 0) || (batch_count > 1 && c_stride == 0)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the matrices and the vectors for validity
+  const auto rotated = (layout == Layout::kRowMajor);
+  const auto one = (rotated) ? n : m;
+  const auto two = (rotated) ? m : n;
+  TestStridedBatchedMatrixA(one, two, a_buffer, a_offset, a_stride, batch_count, a_ld);
+  TestStridedBatchedMatrixC(one, two, c_buffer, c_offset, c_stride, batch_count, c_ld);
+  TestVectorX((side == Side::kLeft) ? m : n, x_buffer, x_offset + x_stride * (batch_count - 1), x_inc);
+
+  DgmmKernel(layout, side, m, n, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, c_buffer,
+             c_offset, c_ld, c_stride, batch_count);
+}
+
+// =================================================================================================
+
+// Launches the kernel on all batches, processing the matrices in terms of their memory layout
+template <typename T>
+void Xdgmm<T>::DgmmKernel(const Layout layout, const Side side, const size_t m, const size_t n,
+                          const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                          const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                          const size_t x_stride, const Buffer<T>& c_buffer, const size_t c_offset,
+                          const size_t c_ld, const size_t c_stride, const size_t batch_count) {
+  // The rows of a column-major matrix are along its contiguous dimension, as are the columns of a row-major matrix
+  const auto rotated = (layout == Layout::kRowMajor);
+  const auto one = (rotated) ? n : m;
+  const auto two = (rotated) ? m : n;
+  const auto scale_one = (side == Side::kLeft) ^ rotated;
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, "Xdgmm");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(one));
+  kernel.SetArgument(1, static_cast<int>(two));
+  kernel.SetArgument(2, static_cast<int>(scale_one));
+  kernel.SetArgument(3, a_buffer());
+  kernel.SetArgument(4, static_cast<int>(a_offset));
+  kernel.SetArgument(5, static_cast<int>(a_ld));
+  kernel.SetArgument(6, static_cast<int>(a_stride));
+  kernel.SetArgument(7, x_buffer());
+  kernel.SetArgument(8, static_cast<int>(x_offset));
+  kernel.SetArgument(9, static_cast<int>(x_inc));
+  kernel.SetArgument(10, static_cast<int>(x_stride));
+  kernel.SetArgument(11, c_buffer());
+  kernel.SetArgument(12, static_cast<int>(c_offset));
+  kernel.SetArgument(13, static_cast<int>(c_ld));
+  kernel.SetArgument(14, static_cast<int>(c_stride));
+
+  // Launches the kernel
+  const auto global_one = Ceil(CeilDiv(one, db_["DGMM_WPTX"]), db_["DGMM_DIMX"]);
+  const auto global_two = Ceil(CeilDiv(two, db_["DGMM_WPTY"]), db_["DGMM_DIMY"]);
+  auto global = std::vector<size_t>{global_one, global_two, batch_count};
+  auto local = std::vector<size_t>{db_["DGMM_DIMX"], db_["DGMM_DIMY"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xdgmm<half>;
+template class Xdgmm<float>;
+template class Xdgmm<double>;
+template class Xdgmm<float2>;
+template class Xdgmm<double2>;
+
+// =================================================================================================
+}  // namespace clblast
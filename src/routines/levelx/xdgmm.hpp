@@ -0,0 +1,54 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xdgmm routine. This is a non-blas routine scaling the rows or the columns
+// of a matrix by a vector, i.e. C = diag(x) * A or C = A * diag(x), also in a strided-batched form.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XDGMM_H_
+#define CLBLAST_ROUTINES_XDGMM_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xdgmm : public Routine {
+ public:
+  // Constructor
+  Xdgmm(Queue& queue, EventPointer event, const std::string& name = "DGMM");
+
+  // Templated-precision implementation of the routine
+  void DoDgmm(const Layout layout, const Side side, const size_t m, const size_t n, const Buffer<T>& a_buffer,
+              const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer, const size_t x_offset,
+              const size_t x_inc, const Buffer<T>& c_buffer, const size_t c_offset, const size_t c_ld);
+
+  // As above, but for many matrices and vectors at a fixed distance from each other
+  void DoDgmmStridedBatched(const Layout layout, const Side side, const size_t m, const size_t n,
+                            const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                            const size_t a_stride, const Buffer<T>& x_buffer, const size_t x_offset,
+                            const size_t x_inc, const size_t x_stride, const Buffer<T>& c_buffer,
+                            const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                            const size_t batch_count);
+
+ private:
+  // Launches the kernel on all batches
+  void DgmmKernel(const Layout layout, const Side side, const size_t m, const size_t n, const Buffer<T>& a_buffer,
+                  const size_t a_offset, const size_t a_ld, const size_t a_stride, const Buffer<T>& x_buffer,
+                  const size_t x_offset, const size_t x_inc, const size_t x_stride, const Buffer<T>& c_buffer,
+                  const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XDGMM_H_
+#endif
@@ -0,0 +1,131 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XdotBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xdotbatched.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XdotBatched<T>::XdotBatched(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level1/reproducible.opencl"
+// (comment to prevent auto-re-ordering)
+#include "../../kernels/level1/xdot.opencl"
+              }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XdotBatched<T>::DoDotBatched(const size_t n, const Buffer<T>& dot_buffer, const std::vector<size_t>& dot_offsets,
+                                  const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets, const size_t x_inc,
+                                  const Buffer<T>& y_buffer, const std::vector<size_t>& y_offsets, const size_t y_inc,
+                                  const size_t batch_count) {
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (x_offsets.size() != batch_count) || (y_offsets.size() != batch_count) ||
+      (dot_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestVectorX(n, x_buffer, x_offsets[batch], x_inc);
+    TestVectorY(n, y_buffer, y_offsets[batch], y_inc);
+    TestVectorScalar(1, dot_buffer, dot_offsets[batch]);
+  }
+
+  // Upload the offsets to the device
+  auto x_offsets_int = std::vector<int>(batch_count);
+  auto y_offsets_int = std::vector<int>(batch_count);
+  auto dot_offsets_int = std::vector<int>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    x_offsets_int[batch] = static_cast<int>(x_offsets[batch]);
+    y_offsets_int[batch] = static_cast<int>(y_offsets[batch]);
+    dot_offsets_int[batch] = static_cast<int>(dot_offsets[batch]);
+  }
+  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto y_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto dot_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  x_offsets_device.Write(queue_, batch_count, x_offsets_int);
+  y_offsets_device.Write(queue_, batch_count, y_offsets_int);
+  dot_offsets_device.Write(queue_, batch_count, dot_offsets_int);
+
+  // Retrieves the kernel from the compiled binary: the reproducible mode has its own kernel, such that
+  // only that kernel is compiled without fused multiply-adds
+  const auto reproducible = (GetCurrentReductionMode() == ReductionMode::kReproducible);
+  auto kernel = Kernel(program_, (reproducible) ? "XdotBatchedReproducible" : "XdotBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, x_buffer());
+  kernel.SetArgument(2, x_offsets_device());
+  kernel.SetArgument(3, static_cast<int>(x_inc));
+  kernel.SetArgument(4, y_buffer());
+  kernel.SetArgument(5, y_offsets_device());
+  kernel.SetArgument(6, static_cast<int>(y_inc));
+  kernel.SetArgument(7, dot_buffer());
+  kernel.SetArgument(8, dot_offsets_device());
+  if (!reproducible) {
+    kernel.SetArgument(9, static_cast<int>(GetCurrentReductionMode() == ReductionMode::kCompensated));
+  }
+
+  // Launches the kernel: one work-group per batch, such that no epilogue kernel is needed
+  auto global = std::vector<size_t>{db_["WGS1"] * batch_count};
+  auto local = std::vector<size_t>{db_["WGS1"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The strided-batched version: computes the offsets and forwards to the main routine
+template <typename T>
+void XdotBatched<T>::DoDotStridedBatched(const size_t n, const Buffer<T>& dot_buffer, const size_t dot_offset,
+                                         const size_t dot_stride, const Buffer<T>& x_buffer, const size_t x_offset,
+                                         const size_t x_inc, const size_t x_stride, const Buffer<T>& y_buffer,
+                                         const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                         const size_t batch_count) {
+  auto x_offsets = std::vector<size_t>(batch_count);
+  auto y_offsets = std::vector<size_t>(batch_count);
+  auto dot_offsets = std::vector<size_t>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    x_offsets[batch] = x_offset + batch * x_stride;
+    y_offsets[batch] = y_offset + batch * y_stride;
+    dot_offsets[batch] = dot_offset + batch * dot_stride;
+  }
+  DoDotBatched(n, dot_buffer, dot_offsets, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XdotBatched<half>;
+template class XdotBatched<float>;
+template class XdotBatched<double>;
+
+// =================================================================================================
+}  // namespace clblast
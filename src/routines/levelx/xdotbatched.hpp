@@ -0,0 +1,47 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XdotBatched routine. This is a non-blas batched version of DOT, computing
+// the dot-products of many pairs of vectors in a single kernel launch.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XDOTBATCHED_H_
+#define CLBLAST_ROUTINES_XDOTBATCHED_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XdotBatched : public Routine {
+ public:
+  // Constructor
+  XdotBatched(Queue& queue, EventPointer event, const std::string& name = "DOTBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoDotBatched(const size_t n, const Buffer<T>& dot_buffer, const std::vector<size_t>& dot_offsets,
+                    const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets, const size_t x_inc,
+                    const Buffer<T>& y_buffer, const std::vector<size_t>& y_offsets, const size_t y_inc,
+                    const size_t batch_count);
+
+  // As above, but with the vectors (and results) of the batches at a fixed distance from each other
+  void DoDotStridedBatched(const size_t n, const Buffer<T>& dot_buffer, const size_t dot_offset,
+                           const size_t dot_stride, const Buffer<T>& x_buffer, const size_t x_offset,
+                           const size_t x_inc, const size_t x_stride, const Buffer<T>& y_buffer, const size_t y_offset,
+                           const size_t y_inc, const size_t y_stride, const size_t batch_count);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XDOTBATCHED_H_
+#endif
@@ -0,0 +1,79 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xelementwise class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xelementwise.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "routines/expression.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: parses the expression and forwards to the private constructor below
+template <typename T>
+Xelementwise<T>::Xelementwise(Queue& queue, EventPointer event, const std::string& expression,
+                              const std::string& name)
+    : Xelementwise(queue, event, ParseExpression(expression, false), name) {}
+
+// Constructor: forwards to base class constructor, with the generated code in front of the kernel
+template <typename T>
+Xelementwise<T>::Xelementwise(Queue& queue, EventPointer event, const Expression& expression,
+                              const std::string& name)
+    : Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, expression.key, false,
+              {expression.source.c_str(),
+#include "../../kernels/levelx/xelementwise.opencl"
+              }),
+      expression_(expression) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xelementwise<T>::DoElementwise(const size_t n, const std::vector<T>& scalars,
+                                    const std::vector<Buffer<T>>& buffers, const std::vector<size_t>& offsets,
+                                    const std::vector<size_t>& incs) {
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Retrieves the Xelementwise kernel from the compiled binary
+  auto kernel = Kernel(program_, "Xelementwise");
+
+  // Sets the kernel arguments, testing the vectors for validity
+  kernel.SetArgument(0, static_cast<int>(n));
+  SetExpressionArguments(kernel, 1, expression_, n, scalars, buffers, offsets, incs);
+
+  // Launches the kernel
+  const auto n_ceiled = Ceil(n, db_["WGS"] * db_["WPT"]);
+  auto global = std::vector<size_t>{n_ceiled / db_["WPT"]};
+  auto local = std::vector<size_t>{db_["WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xelementwise<half>;
+template class Xelementwise<float>;
+template class Xelementwise<double>;
+template class Xelementwise<float2>;
+template class Xelementwise<double2>;
+
+// =================================================================================================
+}  // namespace clblast
@@ -0,0 +1,50 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xelementwise routine. This is a non-blas routine which evaluates a
+// run-time expression such as "z = a*x*y + b*z" for all elements of a set of vectors. The kernel is
+// generated from the expression (see routines/expression.hpp) and the compiled program is cached
+// per expression, such that further calls with other vectors or scalars do not re-compile. All
+// assignments of the expression are fused into a single pass over memory.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XELEMENTWISE_H_
+#define CLBLAST_ROUTINES_XELEMENTWISE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/expression.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xelementwise : public Routine {
+ public:
+  // Constructor
+  Xelementwise(Queue& queue, EventPointer event, const std::string& expression,
+               const std::string& name = "ELEMENTWISE");
+
+  // Templated-precision implementation of the routine
+  void DoElementwise(const size_t n, const std::vector<T>& scalars, const std::vector<Buffer<T>>& buffers,
+                     const std::vector<size_t>& offsets, const std::vector<size_t>& incs);
+
+ private:
+  // Constructor from an already parsed expression
+  Xelementwise(Queue& queue, EventPointer event, const Expression& expression, const std::string& name);
+
+  const Expression expression_;
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XELEMENTWISE_H_
+#endif
@@ -0,0 +1,61 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgemmdevicescalars class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmdevicescalars.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include "routines/common.hpp"
+#include "routines/level3/xgemm.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor, which compiles the kernels for device-side scalars
+template <typename T>
+Xgemmdevicescalars<T>::Xgemmdevicescalars(Queue& queue, EventPointer event, const std::string& name)
+    : Xgemm<T>(queue, event, name, true) {}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xgemmdevicescalars<T>::DoGemmDeviceScalars(const Layout layout, const Transpose a_transpose,
+                                                 const Transpose b_transpose, const size_t m, const size_t n,
+                                                 const size_t k, const Buffer<T>& alpha_buffer,
+                                                 const size_t alpha_offset, const Buffer<T>& a_buffer,
+                                                 const size_t a_offset, const size_t a_ld, const Buffer<T>& b_buffer,
+                                                 const size_t b_offset, const size_t b_ld,
+                                                 const Buffer<T>& beta_buffer, const size_t beta_offset,
+                                                 const Buffer<T>& c_buffer, const size_t c_offset,
+                                                 const size_t c_ld) {
+  // Tests the scalars for validity
+  TestVectorScalar(1, alpha_buffer, alpha_offset);
+  TestVectorScalar(1, beta_buffer, beta_offset);
+
+  // Runs the regular routine, of which the kernels read the scalars from device memory
+  DoGemm(layout, a_transpose, b_transpose, m, n, k, ScalarArgument<T>(context_, queue_, alpha_buffer, alpha_offset),
+         a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+         ScalarArgument<T>(context_, queue_, beta_buffer, beta_offset), c_buffer, c_offset, c_ld);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgemmdevicescalars<half>;
+template class Xgemmdevicescalars<float>;
+template class Xgemmdevicescalars<double>;
+template class Xgemmdevicescalars<float2>;
+template class Xgemmdevicescalars<double2>;
+
+// =================================================================================================
+}  // namespace clblast
@@ -0,0 +1,49 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgemmdevicescalars routine: the GEMM routine with alpha and beta stored in device
+// memory instead of passed by value. This allows alpha and beta to be the result of a preceding routine,
+// without the host having to wait for it. The class inherits from the regular Xgemm class, of
+// which the kernels are compiled with DEVICE_SCALARS set (see 'scalar_arg' in common.opencl).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMDEVICESCALARS_H_
+#define CLBLAST_ROUTINES_XGEMMDEVICESCALARS_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routines/level3/xgemm.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgemmdevicescalars : public Xgemm<T> {
+ public:
+  // Uses methods and variables the regular Xgemm routine
+  using Xgemm<T>::context_;
+  using Xgemm<T>::queue_;
+  using Xgemm<T>::DoGemm;
+
+  // Constructor
+  Xgemmdevicescalars(Queue& queue, EventPointer event, const std::string& name = "GEMM");
+
+  // Templated-precision implementation of the routine
+  void DoGemmDeviceScalars(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k, const Buffer<T>& alpha_buffer,
+                           const size_t alpha_offset, const Buffer<T>& a_buffer, const size_t a_offset,
+                           const size_t a_ld, const Buffer<T>& b_buffer, const size_t b_offset, const size_t b_ld,
+                           const Buffer<T>& beta_buffer, const size_t beta_offset, const Buffer<T>& c_buffer,
+                           const size_t c_offset, const size_t c_ld);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMDEVICESCALARS_H_
+#endif
@@ -0,0 +1,155 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmGrouped class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmgrouped.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "routines/level3/xgemm.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmGrouped<T>::XgemmGrouped(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"XgemmDirect", "GemmRoutine"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level3/level3.opencl"
+                  ,  // separated in multiple parts to prevent C1091 in MSVC 2013
+#include "../../kernels/level3/xgemm_direct_part1.opencl"
+#include "../../kernels/level3/xgemm_direct_part2.opencl"
+#include "../../kernels/level3/xgemm_direct_part3.opencl"
+                  ,  // separated in multiple parts to prevent C1091 in MSVC 2013
+#include "../../kernels/level3/xgemm_direct_batched.opencl"
+              }) {
+}
+
+// =================================================================================================
+
+// The main routine. All entries are computed by a single launch of the direct kernel: each
+// persistent work-group loops over the tiles of all entries.
+template <typename T>
+void XgemmGrouped<T>::DoGemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                    const std::vector<size_t>& ms, const std::vector<size_t>& ns,
+                                    const std::vector<size_t>& ks, const std::vector<T>& alphas,
+                                    const Buffer<T>& a_buffer, const std::vector<size_t>& a_offsets,
+                                    const std::vector<size_t>& a_lds, const Buffer<T>& b_buffer,
+                                    const std::vector<size_t>& b_offsets, const std::vector<size_t>& b_lds,
+                                    const std::vector<T>& betas, const Buffer<T>& c_buffer,
+                                    const std::vector<size_t>& c_offsets, const std::vector<size_t>& c_lds,
+                                    const size_t group_count) {
+  // Tests for a valid group count
+  if ((group_count < 1) || (ms.size() != group_count) || (ns.size() != group_count) ||
+      (ks.size() != group_count) || (alphas.size() != group_count) || (betas.size() != group_count) ||
+      (a_offsets.size() != group_count) || (b_offsets.size() != group_count) || (c_offsets.size() != group_count) ||
+      (a_lds.size() != group_count) || (b_lds.size() != group_count) || (c_lds.size() != group_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Processes and tests the arguments of each entry, and collects them as integers for the kernel:
+  // m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, and c_ld (see the kernel for details). Entries
+  // with m or n equal to zero have no tiles and are thus skipped by the kernel. Entries with k equal to
+  // zero don't read A and B, such that the kernel computes "C := beta * C" for them.
+  const auto entry_size = size_t{9};
+  const auto wgd = db_["WGD"];
+  auto entries = std::vector<int>(group_count * entry_size);
+  auto tile_offsets = std::vector<int>(group_count + 1);
+  auto num_tiles = size_t{0};
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  for (auto entry = size_t{0}; entry < group_count; ++entry) {
+    const auto m = ms[entry];
+    const auto n = ns[entry];
+    const auto k = ks[entry];
+
+    // The matrix sizes and transpose settings, computed for dimensions of at least one since empty
+    // matrices are rejected by GEMM itself. The matrices of an entry are only tested if they are used.
+    size_t a_one, a_two, b_one, b_two, c_one, c_two;
+    Xgemm<T>::ProcessArguments(layout, a_transpose, b_transpose, std::max(m, size_t{1}), std::max(n, size_t{1}),
+                               std::max(k, size_t{1}), a_one, a_two, b_one, b_two, c_one, c_two, a_do_transpose,
+                               b_do_transpose, c_do_transpose, a_conjugate, b_conjugate, 0);
+
+    // Stores the arguments of this entry: an entry with m or n equal to zero gets no tiles at all
+    const auto values = std::vector<size_t>{m, n, k, a_offsets[entry], a_lds[entry], b_offsets[entry],
+                                            b_lds[entry], c_offsets[entry], c_lds[entry]};
+    for (auto i = size_t{0}; i < entry_size; ++i) {
+      entries[entry * entry_size + i] = static_cast<int>(values[i]);
+    }
+    tile_offsets[entry] = static_cast<int>(num_tiles);
+    if ((m != 0) && (n != 0)) {
+      if (k != 0) {
+        TestMatrixA(a_one, a_two, a_buffer, a_offsets[entry], a_lds[entry], false);  // don't test for invalid LD
+        TestMatrixB(b_one, b_two, b_buffer, b_offsets[entry], b_lds[entry], false);  // don't test for invalid LD
+      }
+      TestMatrixC(c_one, c_two, c_buffer, c_offsets[entry], c_lds[entry]);
+      num_tiles += CeilDiv(m, wgd) * CeilDiv(n, wgd);
+    }
+  }
+  tile_offsets[group_count] = static_cast<int>(num_tiles);
+
+  // Uploads the arguments to the device
+  auto alphas_device = Buffer<T>(context_, BufferAccess::kReadWrite, group_count);
+  auto betas_device = Buffer<T>(context_, BufferAccess::kReadWrite, group_count);
+  auto entries_device = Buffer<int>(context_, BufferAccess::kReadWrite, entries.size());
+  auto tile_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, tile_offsets.size());
+  alphas_device.Write(queue_, group_count, alphas);
+  betas_device.Write(queue_, group_count, betas);
+  entries_device.Write(queue_, entries.size(), entries);
+  tile_offsets_device.Write(queue_, tile_offsets.size(), tile_offsets);
+
+  // Retrieves the proper XgemmDirect kernel from the compiled binary
+  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectGroupedTT" : "XgemmDirectGroupedTN")
+                                     : (b_do_transpose ? "XgemmDirectGroupedNT" : "XgemmDirectGroupedNN");
+  auto kernel = Kernel(program_, name);
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(group_count));
+  kernel.SetArgument(1, tile_offsets_device());
+  kernel.SetArgument(2, entries_device());
+  kernel.SetArgument(3, alphas_device());
+  kernel.SetArgument(4, betas_device());
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, b_buffer());
+  kernel.SetArgument(7, c_buffer());
+  kernel.SetArgument(8, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(9, static_cast<int>(a_conjugate));
+  kernel.SetArgument(10, static_cast<int>(b_conjugate));
+
+  // Computes the global and local thread sizes: a tuned number of persistent work-groups per compute
+  // unit, but no more than the total number of tiles. At least one work-group is launched even if all
+  // entries are empty, such that the event of the routine is always set.
+  const auto max_groups = device_.ComputeUnits() * db_["XGEMM_GROUPED_GROUPS"];
+  const auto num_groups = std::max(std::min(num_tiles, max_groups), size_t{1});
+  const auto global = std::vector<size_t>{num_groups * db_["MDIMCD"], db_["NDIMCD"]};
+  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmGrouped<half>;
+template class XgemmGrouped<float>;
+template class XgemmGrouped<double>;
+template class XgemmGrouped<float2>;
+template class XgemmGrouped<double2>;
+
+// =================================================================================================
+}  // namespace clblast
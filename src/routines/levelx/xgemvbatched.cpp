@@ -0,0 +1,301 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemvbatched.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemvBatched<T>::XgemvBatched(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xgemv", "XgemvFast", "XgemvFastRot"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level2/xgemv.opencl"
+#include "../../kernels/level2/xgemv_fast.opencl"
+#include "../../kernels/level2/xgemv_batched.opencl"
+              }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemvBatched<T>::DoGemvBatched(const Layout layout, const Transpose a_transpose, const size_t m,
+                                    const size_t n, const std::vector<T>& alphas, const Buffer<T>& a_buffer,
+                                    const std::vector<size_t>& a_offsets, const size_t a_ld,
+                                    const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets,
+                                    const size_t x_inc, const std::vector<T>& betas, const Buffer<T>& y_buffer,
+                                    const std::vector<size_t>& y_offsets, const size_t y_inc,
+                                    const size_t batch_count) {
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (alphas.size() != batch_count) || (betas.size() != batch_count) ||
+      (a_offsets.size() != batch_count) || (x_offsets.size() != batch_count) || (y_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major).
+  const auto a_altlayout = (layout == Layout::kRowMajor);
+  const auto a_one = (a_altlayout) ? n : m;
+  const auto a_two = (a_altlayout) ? m : n;
+
+  // Swap m and n if the matrix is transposed
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto m_real = (a_transposed) ? n : m;
+  const auto n_real = (a_transposed) ? m : n;
+
+  // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
+  const auto a_rotated = a_transposed ^ a_altlayout;
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // Tests the matrices and the vectors for validity
+  auto a_offsets_aligned_vw2 = true;
+  auto a_offsets_aligned_vw3 = true;
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(a_one, a_two, a_buffer, a_offsets[batch], a_ld);
+    TestVectorX(n_real, x_buffer, x_offsets[batch], x_inc);
+    TestVectorY(m_real, y_buffer, y_offsets[batch], y_inc);
+    a_offsets_aligned_vw2 = a_offsets_aligned_vw2 && IsMultiple(a_offsets[batch], db_["VW2"]);
+    a_offsets_aligned_vw3 = a_offsets_aligned_vw3 && IsMultiple(a_offsets[batch], db_["VW3"]);
+  }
+
+  // Upload the scalar arguments and the offsets to the device once, all kernels below share them
+  auto a_offsets_int = std::vector<int>(batch_count);
+  auto x_offsets_int = std::vector<int>(batch_count);
+  auto y_offsets_int = std::vector<int>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    a_offsets_int[batch] = static_cast<int>(a_offsets[batch]);
+    x_offsets_int[batch] = static_cast<int>(x_offsets[batch]);
+    y_offsets_int[batch] = static_cast<int>(y_offsets[batch]);
+  }
+  auto alphas_device = Buffer<T>(context_, BufferAccess::kReadWrite, batch_count);
+  auto betas_device = Buffer<T>(context_, BufferAccess::kReadWrite, batch_count);
+  auto a_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto y_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  alphas_device.Write(queue_, batch_count, alphas);
+  betas_device.Write(queue_, batch_count, betas);
+  a_offsets_device.Write(queue_, batch_count, a_offsets_int);
+  x_offsets_device.Write(queue_, batch_count, x_offsets_int);
+  y_offsets_device.Write(queue_, batch_count, y_offsets_int);
+
+  // The betas of one for the tail of the columns, only created when such a tail exists
+  auto ones_device = Buffer<T>(0);
+
+  // Launches a kernel with the per-batch arguments from the device buffers and the shifts as scalars
+  const auto launch = [&](const std::string& kernel_name, const size_t m_part, const size_t n_part,
+                          const bool beta_is_one, const size_t a_shift, const size_t x_shift, const size_t y_shift,
+                          const size_t global_size, const size_t local_size, EventPointer event,
+                          const std::vector<Event>& wait_for_events) {
+    if (beta_is_one) {
+      ones_device = Buffer<T>(context_, BufferAccess::kReadWrite, batch_count);
+      ones_device.Write(queue_, batch_count, std::vector<T>(batch_count, ConstantOne<T>()));
+    }
+    auto kernel = Kernel(program_, kernel_name + "Batched");
+    kernel.SetArgument(0, static_cast<int>(m_part));
+    kernel.SetArgument(1, static_cast<int>(n_part));
+    kernel.SetArgument(2, alphas_device());
+    kernel.SetArgument(3, (beta_is_one) ? ones_device() : betas_device());
+    kernel.SetArgument(4, static_cast<int>(a_rotated));
+    kernel.SetArgument(5, a_buffer());
+    kernel.SetArgument(6, a_offsets_device());
+    kernel.SetArgument(7, static_cast<int>(a_shift));
+    kernel.SetArgument(8, static_cast<int>(a_ld));
+    kernel.SetArgument(9, x_buffer());
+    kernel.SetArgument(10, x_offsets_device());
+    kernel.SetArgument(11, static_cast<int>(x_shift));
+    kernel.SetArgument(12, static_cast<int>(x_inc));
+    kernel.SetArgument(13, y_buffer());
+    kernel.SetArgument(14, y_offsets_device());
+    kernel.SetArgument(15, static_cast<int>(y_shift));
+    kernel.SetArgument(16, static_cast<int>(y_inc));
+    kernel.SetArgument(17, static_cast<int>(a_conjugate));
+    auto global = std::vector<size_t>{global_size, batch_count};
+    auto local = std::vector<size_t>{local_size, 1};
+    RunKernel(kernel, queue_, device_, global, local, event, wait_for_events);
+  };
+  BatchedMatVec(m_real, n_real, a_rotated, a_conjugate, a_ld, x_inc, y_inc, a_offsets_aligned_vw2,
+                a_offsets_aligned_vw3, launch);
+}
+
+// =================================================================================================
+
+// The strided-batched version: shares alpha and beta between the batches and computes the offsets in the kernels
+template <typename T>
+void XgemvBatched<T>::DoGemvStridedBatched(const Layout layout, const Transpose a_transpose, const size_t m,
+                                           const size_t n, const T alpha, const Buffer<T>& a_buffer,
+                                           const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                           const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const size_t x_stride, const T beta, const Buffer<T>& y_buffer,
+                                           const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                           const size_t batch_count) {
+  // Tests for a valid batch count
+  if (batch_count < 1) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major).
+  const auto a_altlayout = (layout == Layout::kRowMajor);
+  const auto a_one = (a_altlayout) ? n : m;
+  const auto a_two = (a_altlayout) ? m : n;
+
+  // Swap m and n if the matrix is transposed
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto m_real = (a_transposed) ? n : m;
+  const auto n_real = (a_transposed) ? m : n;
+
+  // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
+  const auto a_rotated = a_transposed ^ a_altlayout;
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // Tests the matrices and the vectors for validity: the last batch is the furthest into the buffers
+  const auto last_batch = batch_count - 1;
+  TestMatrixA(a_one, a_two, a_buffer, a_offset + last_batch * a_stride, a_ld);
+  TestVectorX(n_real, x_buffer, x_offset + last_batch * x_stride, x_inc);
+  TestVectorY(m_real, y_buffer, y_offset + last_batch * y_stride, y_inc);
+  const auto a_offsets_aligned_vw2 = IsMultiple(a_offset, db_["VW2"]) && IsMultiple(a_stride, db_["VW2"]);
+  const auto a_offsets_aligned_vw3 = IsMultiple(a_offset, db_["VW3"]) && IsMultiple(a_stride, db_["VW3"]);
+
+  // Launches a kernel with the shared scalars, the shifted offsets and the strides as scalar arguments
+  const auto launch = [&](const std::string& kernel_name, const size_t m_part, const size_t n_part,
+                          const bool beta_is_one, const size_t a_shift, const size_t x_shift, const size_t y_shift,
+                          const size_t global_size, const size_t local_size, EventPointer event,
+                          const std::vector<Event>& wait_for_events) {
+    auto kernel = Kernel(program_, kernel_name + "StridedBatched");
+    kernel.SetArgument(0, static_cast<int>(m_part));
+    kernel.SetArgument(1, static_cast<int>(n_part));
+    kernel.SetArgument(2, GetRealArg(alpha));
+    kernel.SetArgument(3, GetRealArg((beta_is_one) ? ConstantOne<T>() : beta));
+    kernel.SetArgument(4, static_cast<int>(a_rotated));
+    kernel.SetArgument(5, a_buffer());
+    kernel.SetArgument(6, static_cast<int>(a_offset + a_shift));
+    kernel.SetArgument(7, static_cast<int>(a_stride));
+    kernel.SetArgument(8, static_cast<int>(a_ld));
+    kernel.SetArgument(9, x_buffer());
+    kernel.SetArgument(10, static_cast<int>(x_offset + x_shift));
+    kernel.SetArgument(11, static_cast<int>(x_stride));
+    kernel.SetArgument(12, static_cast<int>(x_inc));
+    kernel.SetArgument(13, y_buffer());
+    kernel.SetArgument(14, static_cast<int>(y_offset + y_shift));
+    kernel.SetArgument(15, static_cast<int>(y_stride));
+    kernel.SetArgument(16, static_cast<int>(y_inc));
+    kernel.SetArgument(17, static_cast<int>(a_conjugate));
+    auto global = std::vector<size_t>{global_size, batch_count};
+    auto local = std::vector<size_t>{local_size, 1};
+    RunKernel(kernel, queue_, device_, global, local, event, wait_for_events);
+  };
+  BatchedMatVec(m_real, n_real, a_rotated, a_conjugate, a_ld, x_inc, y_inc, a_offsets_aligned_vw2,
+                a_offsets_aligned_vw3, launch);
+}
+
+// =================================================================================================
+
+// Selects the kernels and runs them on the bulk and the tails of the matrices
+template <typename T>
+void XgemvBatched<T>::BatchedMatVec(const size_t m_real, const size_t n_real, const bool a_rotated,
+                                    const bool a_conjugate, const size_t a_ld, const size_t x_inc,
+                                    const size_t y_inc, const bool a_offsets_aligned_vw2,
+                                    const bool a_offsets_aligned_vw3, const BatchedLaunchFunction& launch) {
+  // Determines whether or not the fast-version can be used, see the non-batched Xgemv routine for details
+  const auto fast_kernel = (a_rotated == 0) && (a_conjugate == 0) && a_offsets_aligned_vw2 &&
+                           IsMultiple(a_ld, db_["VW2"]) && (m_real >= db_["WGS2"] * db_["WPT2"]) &&
+                           (n_real >= db_["WGS2"]);
+  const auto fast_kernel_rot = (a_rotated == 1) && (a_conjugate == 0) && a_offsets_aligned_vw3 &&
+                               IsMultiple(a_ld, db_["VW3"]) && (m_real >= db_["WGS3"] * db_["WPT3"]) &&
+                               (n_real >= db_["WGS3"]);
+
+  // If not possible, runs the generic version of the kernel on the whole matrices
+  if (!fast_kernel && !fast_kernel_rot) {
+    const auto m_ceiled = Ceil(m_real, db_["WGS1"] * db_["WPT1"]);
+    launch("Xgemv", m_real, n_real, false, 0, 0, 0, m_ceiled / db_["WPT1"], db_["WGS1"], event_, {});
+    return;
+  }
+
+  // Splits the matrices into a bulk part for the fast (rotated or non-rotated) kernel and tails for the generic kernel
+  const auto m_tile = (fast_kernel) ? db_["WGS2"] * db_["WPT2"] : db_["WGS3"] * db_["WPT3"];
+  const auto n_tile = (fast_kernel) ? db_["WGS2"] : db_["WGS3"];
+  const auto m_bulk = (m_real / m_tile) * m_tile;
+  const auto n_bulk = (n_real / n_tile) * n_tile;
+  const auto m_tail = m_real - m_bulk;
+  const auto n_tail = n_real - n_bulk;
+
+  // The distances in the matrices between two consecutive rows and columns of the (rotated) matrices
+  const auto a_row_stride = (a_rotated) ? a_ld : size_t{1};
+  const auto a_col_stride = (a_rotated) ? size_t{1} : a_ld;
+
+  // Runs the fast kernel on the bulk parts: the top-left m_bulk by n_bulk parts of the matrices
+  auto event_wait_list = std::vector<Event>();
+  auto bulk_event = Event();
+  const auto bulk_is_last = (m_tail == 0) && (n_tail == 0);
+  if (fast_kernel) {
+    launch("XgemvFast", m_bulk, n_bulk, false, 0, 0, 0, m_bulk / db_["WPT2"], db_["WGS2"],
+           (bulk_is_last) ? event_ : bulk_event.pointer(), event_wait_list);
+  } else {
+    launch("XgemvFastRot", m_bulk, n_bulk, false, 0, 0, 0, m_bulk, db_["WGS3"],
+           (bulk_is_last) ? event_ : bulk_event.pointer(), event_wait_list);
+  }
+  if (bulk_is_last) {
+    return;
+  }
+  event_wait_list = {bulk_event};
+
+  // Adds the contribution of the remaining columns to the bulk rows of y (hence beta is one)
+  if (n_tail > 0) {
+    auto tail_event = Event();
+    const auto n_tail_is_last = (m_tail == 0);
+    const auto m_ceiled = Ceil(m_bulk, db_["WGS1"] * db_["WPT1"]);
+    launch("Xgemv", m_bulk, n_tail, true, n_bulk * a_col_stride, n_bulk * x_inc, 0, m_ceiled / db_["WPT1"],
+           db_["WGS1"], (n_tail_is_last) ? event_ : tail_event.pointer(), event_wait_list);
+    if (n_tail_is_last) {
+      return;
+    }
+    event_wait_list = {tail_event};
+  }
+
+  // Computes the remaining rows of y, using all columns of the matrices
+  const auto m_ceiled = Ceil(m_tail, db_["WGS1"] * db_["WPT1"]);
+  launch("Xgemv", m_tail, n_real, false, m_bulk * a_row_stride, 0, m_bulk * y_inc, m_ceiled / db_["WPT1"],
+         db_["WGS1"], event_, event_wait_list);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemvBatched<half>;
+template class XgemvBatched<float>;
+template class XgemvBatched<double>;
+template class XgemvBatched<float2>;
+template class XgemvBatched<double2>;
+
+// =================================================================================================
+}  // namespace clblast
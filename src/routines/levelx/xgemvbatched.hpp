@@ -0,0 +1,64 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvBatched routine. This is a non-blas batched version of GEMV.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMVBATCHED_H_
+#define CLBLAST_ROUTINES_XGEMVBATCHED_H_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemvBatched : public Routine {
+ public:
+  // Constructor
+  XgemvBatched(Queue& queue, EventPointer event, const std::string& name = "GEMVBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoGemvBatched(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                     const std::vector<T>& alphas, const Buffer<T>& a_buffer, const std::vector<size_t>& a_offsets,
+                     const size_t a_ld, const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets,
+                     const size_t x_inc, const std::vector<T>& betas, const Buffer<T>& y_buffer,
+                     const std::vector<size_t>& y_offsets, const size_t y_inc, const size_t batch_count);
+
+  // As above, but with the matrices and vectors of the batches at a fixed distance from each other
+  void DoGemvStridedBatched(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                            const T alpha, const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                            const size_t a_stride, const Buffer<T>& x_buffer, const size_t x_offset,
+                            const size_t x_inc, const size_t x_stride, const T beta, const Buffer<T>& y_buffer,
+                            const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                            const size_t batch_count);
+
+ private:
+  // Sets the arguments of one of the batched kernels ("Xgemv", "XgemvFast" or "XgemvFastRot") and launches it on
+  // (a part of) the matrices. The offsets of A, x and y are shifted by the given amounts for all batches.
+  using BatchedLaunchFunction =
+      std::function<void(const std::string& kernel_name, const size_t m, const size_t n, const bool beta_is_one,
+                         const size_t a_shift, const size_t x_shift, const size_t y_shift, const size_t global_size,
+                         const size_t local_size, EventPointer event, const std::vector<Event>& wait_for_events)>;
+
+  // Selects the kernels, splits the matrices into a bulk part for the fast kernels and tails for the generic kernel
+  // and launches them through the given function. Shared by the batched and the strided-batched versions.
+  void BatchedMatVec(const size_t m_real, const size_t n_real, const bool a_rotated, const bool a_conjugate,
+                     const size_t a_ld, const size_t x_inc, const size_t y_inc, const bool a_offsets_aligned_vw2,
+                     const bool a_offsets_aligned_vw3, const BatchedLaunchFunction& launch);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMVBATCHED_H_
+#endif
@@ -0,0 +1,60 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgemvdevicescalars class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemvdevicescalars.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include "routines/common.hpp"
+#include "routines/level2/xgemv.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor, which compiles the kernels for device-side scalars
+template <typename T>
+Xgemvdevicescalars<T>::Xgemvdevicescalars(Queue& queue, EventPointer event, const std::string& name)
+    : Xgemv<T>(queue, event, name, true) {}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xgemvdevicescalars<T>::DoGemvDeviceScalars(const Layout layout, const Transpose a_transpose, const size_t m,
+                                                 const size_t n, const Buffer<T>& alpha_buffer,
+                                                 const size_t alpha_offset, const Buffer<T>& a_buffer,
+                                                 const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer,
+                                                 const size_t x_offset, const size_t x_inc,
+                                                 const Buffer<T>& beta_buffer, const size_t beta_offset,
+                                                 const Buffer<T>& y_buffer, const size_t y_offset,
+                                                 const size_t y_inc) {
+  // Tests the scalars for validity
+  TestVectorScalar(1, alpha_buffer, alpha_offset);
+  TestVectorScalar(1, beta_buffer, beta_offset);
+
+  // Runs the regular routine, of which the kernels read the scalars from device memory
+  DoGemv(layout, a_transpose, m, n, ScalarArgument<T>(context_, queue_, alpha_buffer, alpha_offset), a_buffer, a_offset,
+         a_ld, x_buffer, x_offset, x_inc, ScalarArgument<T>(context_, queue_, beta_buffer, beta_offset), y_buffer,
+         y_offset, y_inc);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgemvdevicescalars<half>;
+template class Xgemvdevicescalars<float>;
+template class Xgemvdevicescalars<double>;
+template class Xgemvdevicescalars<float2>;
+template class Xgemvdevicescalars<double2>;
+
+// =================================================================================================
+}  // namespace clblast
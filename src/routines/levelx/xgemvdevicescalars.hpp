@@ -0,0 +1,49 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgemvdevicescalars routine: the GEMV routine with alpha and beta stored in device
+// memory instead of passed by value. This allows alpha and beta to be the result of a preceding routine,
+// without the host having to wait for it. The class inherits from the regular Xgemv class, of
+// which the kernels are compiled with DEVICE_SCALARS set (see 'scalar_arg' in common.opencl).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMVDEVICESCALARS_H_
+#define CLBLAST_ROUTINES_XGEMVDEVICESCALARS_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routines/level2/xgemv.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgemvdevicescalars : public Xgemv<T> {
+ public:
+  // Uses methods and variables the regular Xgemv routine
+  using Xgemv<T>::context_;
+  using Xgemv<T>::queue_;
+  using Xgemv<T>::DoGemv;
+
+  // Constructor
+  Xgemvdevicescalars(Queue& queue, EventPointer event, const std::string& name = "GEMV");
+
+  // Templated-precision implementation of the routine
+  void DoGemvDeviceScalars(const Layout layout, const Transpose a_transpose, const size_t m, const size_t n,
+                           const Buffer<T>& alpha_buffer, const size_t alpha_offset, const Buffer<T>& a_buffer,
+                           const size_t a_offset, const size_t a_ld, const Buffer<T>& x_buffer,
+                           const size_t x_offset, const size_t x_inc, const Buffer<T>& beta_buffer,
+                           const size_t beta_offset, const Buffer<T>& y_buffer, const size_t y_offset,
+                           const size_t y_inc);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMVDEVICESCALARS_H_
+#endif
@@ -0,0 +1,254 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgerDeferred class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgerdeferred.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgerDeferred<T>::XgerDeferred(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Copy", "XgemmDirect"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level3/level3.opencl"
+// (comment to prevent auto-re-ordering)
+#include "../../kernels/levelx/xgerdeferred.opencl"
+                  ,  // separated in multiple parts to prevent C1091 in MSVC 2013
+#include "../../kernels/level3/xgemm_direct_part1.opencl"
+#include "../../kernels/level3/xgemm_direct_part2.opencl"
+#include "../../kernels/level3/xgemm_direct_part3.opencl"
+#include "../../kernels/level3/xgemm_direct_triangle.opencl"
+              }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgerDeferred<T>::DoGerDeferred(const Layout layout, const size_t m, const size_t n, const std::vector<T>& alphas,
+                                    const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets, const size_t x_inc,
+                                    const Buffer<T>& y_buffer, const std::vector<size_t>& y_offsets, const size_t y_inc,
+                                    const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                                    const size_t k) {
+  // Tests for a valid number of updates
+  if ((k < 1) || (alphas.size() != k) || (x_offsets.size() != k) || (y_offsets.size() != k)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major).
+  const auto a_is_rowmajor = (layout == Layout::kRowMajor);
+  const auto a_one = (a_is_rowmajor) ? n : m;
+  const auto a_two = (a_is_rowmajor) ? m : n;
+
+  // Tests the matrix and the vectors for validity
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  for (auto l = size_t{0}; l < k; ++l) {
+    TestVectorX(m, x_buffer, x_offsets[l], x_inc);
+    TestVectorY(n, y_buffer, y_offsets[l], y_inc);
+  }
+
+  // Gathers the scaled x-vectors into panel P (m-by-k) and the y-vectors into panel Q (n-by-k). The
+  // leading dimensions are a multiple of the tile size, such that the vector loads are aligned.
+  const auto p_ld = Ceil(m, db_["WGD"]);
+  const auto q_ld = Ceil(n, db_["WGD"]);
+  auto alphas_device = Buffer<T>(context_, BufferAccess::kReadWrite, k);
+  alphas_device.Write(queue_, k, alphas);
+  auto panel_buffer = Buffer<T>(context_, (p_ld + q_ld) * k);
+  auto eventWaitList = std::vector<Event>();
+  auto eventGatherX = Event();
+  GatherVectors(m, k, alphas_device, true, x_buffer, x_offsets, x_inc, panel_buffer, 0, p_ld, eventGatherX.pointer());
+  eventWaitList.push_back(eventGatherX);
+  auto eventGatherY = Event();
+  GatherVectors(n, k, alphas_device, false, y_buffer, y_offsets, y_inc, panel_buffer, p_ld * k, q_ld,
+                eventGatherY.pointer());
+  eventWaitList.push_back(eventGatherY);
+
+  // Applies all k updates in a single pass over A
+  ApplyPanels(m, n, k, panel_buffer, 0, p_ld, p_ld * k, q_ld, a_buffer, a_offset, a_ld, a_is_rowmajor, false, 0,
+              eventWaitList);
+}
+
+// =================================================================================================
+
+// The rank-2 version: A += alpha_l * x_l * y_l^T + alpha_l * y_l * x_l^T for SYR2, or with the
+// conjugate transposes and conjugated alpha_l in the second term for HER2. The panel holds the
+// vectors as [alpha*X | Y | alpha*X], such that P = [alpha*X | Y] and Q = [Y | alpha*X] overlap
+// and all 2k vectors are applied with a single triangular direct GEMM kernel: A += P * Q^T.
+template <typename T>
+void XgerDeferred<T>::RankTwoDeferred(const Layout layout, const Triangle triangle, const size_t n,
+                                      const std::vector<T>& alphas, const Buffer<T>& x_buffer,
+                                      const std::vector<size_t>& x_offsets, const size_t x_inc,
+                                      const Buffer<T>& y_buffer, const std::vector<size_t>& y_offsets,
+                                      const size_t y_inc, const Buffer<T>& a_buffer, const size_t a_offset,
+                                      const size_t a_ld, const size_t k, const bool hermitian) {
+  // Tests for a valid number of updates
+  if ((k < 1) || (alphas.size() != k) || (x_offsets.size() != k) || (y_offsets.size() != k)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure the dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the matrix and the vectors for validity
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  for (auto l = size_t{0}; l < k; ++l) {
+    TestVectorX(n, x_buffer, x_offsets[l], x_inc);
+    TestVectorY(n, y_buffer, y_offsets[l], y_inc);
+  }
+
+  // Gathers the vectors into the panel [alpha*X | Y | alpha*X]
+  const auto panel_ld = Ceil(n, db_["WGD"]);
+  const auto panel_part = panel_ld * k;
+  auto alphas_device = Buffer<T>(context_, BufferAccess::kReadWrite, k);
+  alphas_device.Write(queue_, k, alphas);
+  auto panel_buffer = Buffer<T>(context_, 3 * panel_part);
+  auto eventWaitList = std::vector<Event>();
+  auto eventGatherX1 = Event();
+  GatherVectors(n, k, alphas_device, true, x_buffer, x_offsets, x_inc, panel_buffer, 0, panel_ld,
+                eventGatherX1.pointer());
+  eventWaitList.push_back(eventGatherX1);
+  auto eventGatherY = Event();
+  GatherVectors(n, k, alphas_device, false, y_buffer, y_offsets, y_inc, panel_buffer, panel_part, panel_ld,
+                eventGatherY.pointer());
+  eventWaitList.push_back(eventGatherY);
+  auto eventGatherX2 = Event();
+  GatherVectors(n, k, alphas_device, true, x_buffer, x_offsets, x_inc, panel_buffer, 2 * panel_part, panel_ld,
+                eventGatherX2.pointer());
+  eventWaitList.push_back(eventGatherX2);
+
+  // Applies all 2k vectors in a single pass over the triangle of A
+  const auto a_triangle = (triangle == Triangle::kUpper) ? size_t{1} : size_t{2};
+  ApplyPanels(n, n, 2 * k, panel_buffer, 0, panel_ld, panel_part, panel_ld, a_buffer, a_offset, a_ld,
+              layout == Layout::kRowMajor, hermitian, a_triangle, eventWaitList);
+}
+
+// =================================================================================================
+
+// Copies the vectors into the columns of a panel
+template <typename T>
+void XgerDeferred<T>::GatherVectors(const size_t n, const size_t k, const Buffer<T>& alphas_device,
+                                    const bool use_alphas, const Buffer<T>& src_buffer,
+                                    const std::vector<size_t>& src_offsets, const size_t src_inc,
+                                    const Buffer<T>& panel_buffer, const size_t panel_offset, const size_t panel_ld,
+                                    EventPointer event) {
+  // Uploads the offsets of the vectors to the device
+  auto src_offsets_int = std::vector<int>(k);
+  for (auto l = size_t{0}; l < k; ++l) {
+    src_offsets_int[l] = static_cast<int>(src_offsets[l]);
+  }
+  auto src_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, k);
+  src_offsets_device.Write(queue_, k, src_offsets_int);
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, "GatherVectors");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(k));
+  kernel.SetArgument(2, alphas_device());
+  kernel.SetArgument(3, static_cast<int>(use_alphas));
+  kernel.SetArgument(4, src_buffer());
+  kernel.SetArgument(5, src_offsets_device());
+  kernel.SetArgument(6, static_cast<int>(src_inc));
+  kernel.SetArgument(7, panel_buffer());
+  kernel.SetArgument(8, static_cast<int>(panel_offset));
+  kernel.SetArgument(9, static_cast<int>(panel_ld));
+
+  // Launches the kernel
+  const auto global = std::vector<size_t>{Ceil(n, db_["COPY_DIMX"]), Ceil(k, db_["COPY_DIMY"])};
+  const auto local = std::vector<size_t>{db_["COPY_DIMX"], db_["COPY_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event);
+}
+
+// =================================================================================================
+
+// Multiplies the two panels into A using the (triangular) direct GEMM kernel
+template <typename T>
+void XgerDeferred<T>::ApplyPanels(const size_t m, const size_t n, const size_t k, const Buffer<T>& panel_buffer,
+                                  const size_t p_offset, const size_t p_ld, const size_t q_offset, const size_t q_ld,
+                                  const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const bool a_rowmajor, const bool q_conjugate, const size_t a_triangle,
+                                  const std::vector<Event>& wait_for_events) {
+  // Retrieves the proper kernel from the compiled binary. Both panels are in the layout which the
+  // kernels expect for non-transposed matrices.
+  const auto is_triangle = (a_triangle != 0);
+  auto kernel = Kernel(program_, (is_triangle) ? "XgemmDirectTriangleNN" : "XgemmDirectNN");
+
+  // Sets the kernel arguments: the triangular kernel has a single size and two extra arguments
+  const auto one = ConstantOne<T>();
+  auto arg = 0;
+  if (!is_triangle) {
+    kernel.SetArgument(arg++, static_cast<int>(m));
+  }
+  kernel.SetArgument(arg++, static_cast<int>(n));
+  kernel.SetArgument(arg++, static_cast<int>(k));
+  kernel.SetArgument(arg++, GetRealArg(one));
+  kernel.SetArgument(arg++, GetRealArg(one));
+  kernel.SetArgument(arg++, panel_buffer());
+  kernel.SetArgument(arg++, static_cast<int>(p_offset));
+  kernel.SetArgument(arg++, static_cast<int>(p_ld));
+  kernel.SetArgument(arg++, panel_buffer());
+  kernel.SetArgument(arg++, static_cast<int>(q_offset));
+  kernel.SetArgument(arg++, static_cast<int>(q_ld));
+  kernel.SetArgument(arg++, a_buffer());
+  kernel.SetArgument(arg++, static_cast<int>(a_offset));
+  kernel.SetArgument(arg++, static_cast<int>(a_ld));
+  kernel.SetArgument(arg++, static_cast<int>(a_rowmajor));
+  kernel.SetArgument(arg++, 0);
+  kernel.SetArgument(arg++, static_cast<int>(q_conjugate));
+  if (is_triangle) {
+    kernel.SetArgument(arg++, static_cast<int>(a_triangle));
+    kernel.SetArgument(arg++, static_cast<int>(q_conjugate));
+  }
+
+  // Computes the global and local thread sizes: for the triangular kernel one work-group per tile
+  // of the triangle
+  auto global = std::vector<size_t>();
+  if (is_triangle) {
+    const auto n_tiles = CeilDiv(n, db_["WGD"]);
+    const auto num_tiles = (n_tiles * (n_tiles + 1)) / 2;
+    global = {num_tiles * db_["MDIMCD"], db_["NDIMCD"]};
+  } else {
+    global = {(Ceil(m, db_["WGD"]) * db_["MDIMCD"]) / db_["WGD"], (Ceil(n, db_["WGD"]) * db_["NDIMCD"]) / db_["WGD"]};
+  }
+  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_, wait_for_events);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgerDeferred<half>;
+template class XgerDeferred<float>;
+template class XgerDeferred<double>;
+template class XgerDeferred<float2>;
+template class XgerDeferred<double2>;
+
+// =================================================================================================
+}  // namespace clblast
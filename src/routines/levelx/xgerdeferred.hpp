@@ -0,0 +1,66 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgerDeferred routine. This is a non-blas routine which applies k rank-1
+// updates A += alpha_l * x_l * y_l^T at once: the (scaled) vectors are first gathered into two
+// panels, after which a single direct GEMM kernel computes A += P * Q^T. The matrix A is thus only
+// streamed from memory once instead of k times. The class also contains the rank-2 version as used
+// by the Xsyr2Deferred and Xher2Deferred routines.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGERDEFERRED_H_
+#define CLBLAST_ROUTINES_XGERDEFERRED_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgerDeferred : public Routine {
+ public:
+  // Constructor
+  XgerDeferred(Queue& queue, EventPointer event, const std::string& name = "GERDEFERRED");
+
+  // Templated-precision implementation of the routine
+  void DoGerDeferred(const Layout layout, const size_t m, const size_t n, const std::vector<T>& alphas,
+                     const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets, const size_t x_inc,
+                     const Buffer<T>& y_buffer, const std::vector<size_t>& y_offsets, const size_t y_inc,
+                     const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const size_t k);
+
+  // Helper function to be reused for SYR2DEFERRED and HER2DEFERRED
+  void RankTwoDeferred(const Layout layout, const Triangle triangle, const size_t n, const std::vector<T>& alphas,
+                       const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets, const size_t x_inc,
+                       const Buffer<T>& y_buffer, const std::vector<size_t>& y_offsets, const size_t y_inc,
+                       const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const size_t k,
+                       const bool hermitian);
+
+ private:
+  // Copies the k vectors of 'src' into the columns of a panel, scaled by the alphas if requested
+  void GatherVectors(const size_t n, const size_t k, const Buffer<T>& alphas_device, const bool use_alphas,
+                     const Buffer<T>& src_buffer, const std::vector<size_t>& src_offsets, const size_t src_inc,
+                     const Buffer<T>& panel_buffer, const size_t panel_offset, const size_t panel_ld,
+                     EventPointer event);
+
+  // Computes A += P * Q^T (or P * Q^H) with the direct GEMM kernel. The panels P (m-by-k) and Q
+  // (n-by-k) are column-major, the matrix A is transposed in memory in case of a row-major layout.
+  // With 'a_triangle' set to 1 (upper) or 2 (lower) only that triangle of A is computed.
+  void ApplyPanels(const size_t m, const size_t n, const size_t k, const Buffer<T>& panel_buffer,
+                   const size_t p_offset, const size_t p_ld, const size_t q_offset, const size_t q_ld,
+                   const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const bool a_rowmajor,
+                   const bool q_conjugate, const size_t a_triangle, const std::vector<Event>& wait_for_events);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XGERDEFERRED_H_
+#endif
@@ -0,0 +1,48 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xher2Deferred class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xher2deferred.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "utilities/backend.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xher2Deferred<T>::Xher2Deferred(Queue& queue, EventPointer event, const std::string& name)
+    : XgerDeferred<T>(queue, event, name) {}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xher2Deferred<T>::DoHer2Deferred(const Layout layout, const Triangle triangle, const size_t n,
+                                      const std::vector<T>& alphas, const Buffer<T>& x_buffer,
+                                      const std::vector<size_t>& x_offsets, const size_t x_inc,
+                                      const Buffer<T>& y_buffer, const std::vector<size_t>& y_offsets,
+                                      const size_t y_inc, const Buffer<T>& a_buffer, const size_t a_offset,
+                                      const size_t a_ld, const size_t k) {
+  // Runs the rank-2 version of the deferred update, with conjugation of the second term
+  RankTwoDeferred(layout, triangle, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer,
+                  a_offset, a_ld, k, true);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xher2Deferred<float2>;
+template class Xher2Deferred<double2>;
+
+// =================================================================================================
+}  // namespace clblast
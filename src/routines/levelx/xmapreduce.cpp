@@ -0,0 +1,114 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xmapreduce class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xmapreduce.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "routines/expression.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: parses the expression and forwards to the private constructor below
+template <typename T>
+Xmapreduce<T>::Xmapreduce(Queue& queue, EventPointer event, const std::string& expression, const std::string& name)
+    : Xmapreduce(queue, event, ParseExpression(expression, true), name) {}
+
+// Constructor: forwards to base class constructor, with the generated code in front of the kernel.
+// The Xdot kernels are included for the epilogue kernel.
+template <typename T>
+Xmapreduce<T>::Xmapreduce(Queue& queue, EventPointer event, const Expression& expression, const std::string& name)
+    : Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, expression.key, false,
+              {expression.source.c_str(),
+#include "../../kernels/level1/reproducible.opencl"
+// (comment to prevent auto-re-ordering)
+#include "../../kernels/level1/xdot.opencl"
+// (comment to prevent auto-re-ordering)
+#include "../../kernels/levelx/xmapreduce.opencl"
+              }),
+      expression_(expression) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xmapreduce<T>::DoMapReduce(const size_t n, const std::vector<T>& scalars, const std::vector<Buffer<T>>& buffers,
+                                const std::vector<size_t>& offsets, const std::vector<size_t>& incs,
+                                const Buffer<T>& result_buffer, const size_t result_offset) {
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the result scalar for validity
+  TestVectorScalar(1, result_buffer, result_offset);
+
+  // Retrieves the Xmapreduce kernel from the compiled binary
+  auto kernel1 = Kernel(program_, "Xmapreduce");
+
+  // Creates the buffers for intermediate values and for the single-pass work-group counter. The
+  // two-pass version doesn't use the counter, such that it is given the temporary buffer instead.
+  auto temp_size = 2 * db_["WGS2"];
+  auto temp_buffer = Buffer<T>(context_, temp_size);
+  auto counter_buffer = (db_["SINGLE_PASS"] == 1) ? CreateWorkGroupCounter(context_, queue_)
+                                                  : Buffer<unsigned int>(temp_buffer());
+
+  // Sets the kernel arguments, testing the vectors for validity
+  kernel1.SetArgument(0, static_cast<int>(n));
+  const auto arg = SetExpressionArguments(kernel1, 1, expression_, n, scalars, buffers, offsets, incs);
+  kernel1.SetArgument(arg + 0, temp_buffer());
+  kernel1.SetArgument(arg + 1, counter_buffer());
+  kernel1.SetArgument(arg + 2, result_buffer());
+  kernel1.SetArgument(arg + 3, static_cast<int>(result_offset));
+
+  // Launches the main kernel. In the single-pass version it also computes the final result.
+  auto global1 = std::vector<size_t>{db_["WGS1"] * temp_size};
+  auto local1 = std::vector<size_t>{db_["WGS1"]};
+  if (db_["SINGLE_PASS"] == 1) {
+    RunKernel(kernel1, queue_, device_, global1, local1, event_);
+    return;
+  }
+  auto eventWaitList = std::vector<Event>();
+  auto kernelEvent = Event();
+  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  eventWaitList.push_back(kernelEvent);
+
+  // Sets the arguments for the epilogue kernel
+  auto kernel2 = Kernel(program_, "XdotEpilogue");
+  kernel2.SetArgument(0, temp_buffer());
+  kernel2.SetArgument(1, result_buffer());
+  kernel2.SetArgument(2, static_cast<int>(result_offset));
+
+  // Launches the epilogue kernel
+  auto global2 = std::vector<size_t>{db_["WGS2"]};
+  auto local2 = std::vector<size_t>{db_["WGS2"]};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xmapreduce<half>;
+template class Xmapreduce<float>;
+template class Xmapreduce<double>;
+template class Xmapreduce<float2>;
+template class Xmapreduce<double2>;
+
+// =================================================================================================
+}  // namespace clblast
@@ -0,0 +1,49 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xmapreduce routine. This is a non-blas routine which evaluates a run-time
+// expression such as "a*x*y + b*x" for all elements of a set of vectors and sums the results into a
+// single value. As for the Xelementwise routine, the kernel is generated from the expression and
+// the compiled program is cached per expression. The reduction itself follows the Xdot routine.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XMAPREDUCE_H_
+#define CLBLAST_ROUTINES_XMAPREDUCE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/expression.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xmapreduce : public Routine {
+ public:
+  // Constructor
+  Xmapreduce(Queue& queue, EventPointer event, const std::string& expression, const std::string& name = "MAPREDUCE");
+
+  // Templated-precision implementation of the routine
+  void DoMapReduce(const size_t n, const std::vector<T>& scalars, const std::vector<Buffer<T>>& buffers,
+                   const std::vector<size_t>& offsets, const std::vector<size_t>& incs,
+                   const Buffer<T>& result_buffer, const size_t result_offset);
+
+ private:
+  // Constructor from an already parsed expression
+  Xmapreduce(Queue& queue, EventPointer event, const Expression& expression, const std::string& name);
+
+  const Expression expression_;
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XMAPREDUCE_H_
+#endif
@@ -0,0 +1,120 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xnrm2Batched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xnrm2batched.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "routines/common.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xnrm2Batched<T>::Xnrm2Batched(Queue& queue, EventPointer event, const std::string& name)
+    : Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {},
+              {
+#include "../../kernels/level1/reproducible.opencl"
+// (comment to prevent auto-re-ordering)
+#include "../../kernels/level1/xnrm2.opencl"
+              }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xnrm2Batched<T>::DoNrm2Batched(const size_t n, const Buffer<T>& nrm2_buffer,
+                                    const std::vector<size_t>& nrm2_offsets, const Buffer<T>& x_buffer,
+                                    const std::vector<size_t>& x_offsets, const size_t x_inc,
+                                    const size_t batch_count) {
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (x_offsets.size() != batch_count) || (nrm2_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestVectorX(n, x_buffer, x_offsets[batch], x_inc);
+    TestVectorScalar(1, nrm2_buffer, nrm2_offsets[batch]);
+  }
+
+  // Upload the offsets to the device
+  auto x_offsets_int = std::vector<int>(batch_count);
+  auto nrm2_offsets_int = std::vector<int>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    x_offsets_int[batch] = static_cast<int>(x_offsets[batch]);
+    nrm2_offsets_int[batch] = static_cast<int>(nrm2_offsets[batch]);
+  }
+  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto nrm2_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  x_offsets_device.Write(queue_, batch_count, x_offsets_int);
+  nrm2_offsets_device.Write(queue_, batch_count, nrm2_offsets_int);
+
+  // Retrieves the kernel from the compiled binary: the reproducible mode has its own kernel, such that
+  // only that kernel is compiled without fused multiply-adds
+  const auto reproducible = (GetCurrentReductionMode() == ReductionMode::kReproducible);
+  auto kernel = Kernel(program_, (reproducible) ? "Xnrm2BatchedReproducible" : "Xnrm2Batched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, x_buffer());
+  kernel.SetArgument(2, x_offsets_device());
+  kernel.SetArgument(3, static_cast<int>(x_inc));
+  kernel.SetArgument(4, nrm2_buffer());
+  kernel.SetArgument(5, nrm2_offsets_device());
+  if (!reproducible) {
+    kernel.SetArgument(6, static_cast<int>(GetCurrentReductionMode() == ReductionMode::kCompensated));
+  }
+
+  // Launches the kernel: one work-group per batch, such that no epilogue kernel is needed
+  auto global = std::vector<size_t>{db_["WGS1"] * batch_count};
+  auto local = std::vector<size_t>{db_["WGS1"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The strided-batched version: computes the offsets and forwards to the main routine
+template <typename T>
+void Xnrm2Batched<T>::DoNrm2StridedBatched(const size_t n, const Buffer<T>& nrm2_buffer, const size_t nrm2_offset,
+                                           const size_t nrm2_stride, const Buffer<T>& x_buffer, const size_t x_offset,
+                                           const size_t x_inc, const size_t x_stride, const size_t batch_count) {
+  auto x_offsets = std::vector<size_t>(batch_count);
+  auto nrm2_offsets = std::vector<size_t>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    x_offsets[batch] = x_offset + batch * x_stride;
+    nrm2_offsets[batch] = nrm2_offset + batch * nrm2_stride;
+  }
+  DoNrm2Batched(n, nrm2_buffer, nrm2_offsets, x_buffer, x_offsets, x_inc, batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xnrm2Batched<half>;
+template class Xnrm2Batched<float>;
+template class Xnrm2Batched<double>;
+template class Xnrm2Batched<float2>;
+template class Xnrm2Batched<double2>;
+
+// =================================================================================================
+}  // namespace clblast
@@ -0,0 +1,45 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xnrm2Batched routine. This is a non-blas batched version of NRM2, computing
+// the Euclidean norms of many vectors in a single kernel launch.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XNRM2BATCHED_H_
+#define CLBLAST_ROUTINES_XNRM2BATCHED_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xnrm2Batched : public Routine {
+ public:
+  // Constructor
+  Xnrm2Batched(Queue& queue, EventPointer event, const std::string& name = "NRM2BATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoNrm2Batched(const size_t n, const Buffer<T>& nrm2_buffer, const std::vector<size_t>& nrm2_offsets,
+                     const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets, const size_t x_inc,
+                     const size_t batch_count);
+
+  // As above, but with the vectors (and results) of the batches at a fixed distance from each other
+  void DoNrm2StridedBatched(const size_t n, const Buffer<T>& nrm2_buffer, const size_t nrm2_offset,
+                            const size_t nrm2_stride, const Buffer<T>& x_buffer, const size_t x_offset,
+                            const size_t x_inc, const size_t x_stride, const size_t batch_count);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XNRM2BATCHED_H_
+#endif
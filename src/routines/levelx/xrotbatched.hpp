@@ -0,0 +1,40 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XrotBatched routine. This is a non-blas batched version of ROT.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XROTBATCHED_H_
+#define CLBLAST_ROUTINES_XROTBATCHED_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XrotBatched : public Routine {
+ public:
+  // Constructor
+  XrotBatched(Queue& queue, EventPointer event, const std::string& name = "ROTBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoRotBatched(const size_t n, const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets,
+                    const size_t x_inc, const Buffer<T>& y_buffer, const std::vector<size_t>& y_offsets,
+                    const size_t y_inc, const std::vector<T>& cos_values, const std::vector<T>& sin_values,
+                    const size_t batch_count);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XROTBATCHED_H_
+#endif
@@ -0,0 +1,52 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xscaldevicescalars class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xscaldevicescalars.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include "routines/common.hpp"
+#include "routines/level1/xscal.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/buffer_test.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor, which compiles the kernels for device-side scalars
+template <typename T>
+Xscaldevicescalars<T>::Xscaldevicescalars(Queue& queue, EventPointer event, const std::string& name)
+    : Xscal<T>(queue, event, name, true) {}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xscaldevicescalars<T>::DoScalDeviceScalars(const size_t n, const Buffer<T>& alpha_buffer,
+                                                 const size_t alpha_offset, const Buffer<T>& x_buffer,
+                                                 const size_t x_offset, const size_t x_inc) {
+  // Tests the scalar for validity
+  TestVectorScalar(1, alpha_buffer, alpha_offset);
+
+  // Runs the regular routine, of which the kernels read the scalar from device memory
+  DoScal(n, ScalarArgument<T>(context_, queue_, alpha_buffer, alpha_offset), x_buffer, x_offset, x_inc);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xscaldevicescalars<half>;
+template class Xscaldevicescalars<float>;
+template class Xscaldevicescalars<double>;
+template class Xscaldevicescalars<float2>;
+template class Xscaldevicescalars<double2>;
+
+// =================================================================================================
+}  // namespace clblast
@@ -0,0 +1,45 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xscaldevicescalars routine: the SCAL routine with alpha stored in device
+// memory instead of passed by value. This allows alpha to be the result of a preceding routine,
+// without the host having to wait for it. The class inherits from the regular Xscal class, of
+// which the kernels are compiled with DEVICE_SCALARS set (see 'scalar_arg' in common.opencl).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSCALDEVICESCALARS_H_
+#define CLBLAST_ROUTINES_XSCALDEVICESCALARS_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routines/level1/xscal.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xscaldevicescalars : public Xscal<T> {
+ public:
+  // Uses methods and variables the regular Xscal routine
+  using Xscal<T>::context_;
+  using Xscal<T>::queue_;
+  using Xscal<T>::DoScal;
+
+  // Constructor
+  Xscaldevicescalars(Queue& queue, EventPointer event, const std::string& name = "SCAL");
+
+  // Templated-precision implementation of the routine
+  void DoScalDeviceScalars(const size_t n, const Buffer<T>& alpha_buffer, const size_t alpha_offset,
+                           const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XSCALDEVICESCALARS_H_
+#endif
@@ -0,0 +1,49 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xsyr2Deferred class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xsyr2deferred.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "utilities/backend.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xsyr2Deferred<T>::Xsyr2Deferred(Queue& queue, EventPointer event, const std::string& name)
+    : XgerDeferred<T>(queue, event, name) {}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xsyr2Deferred<T>::DoSyr2Deferred(const Layout layout, const Triangle triangle, const size_t n,
+                                      const std::vector<T>& alphas, const Buffer<T>& x_buffer,
+                                      const std::vector<size_t>& x_offsets, const size_t x_inc,
+                                      const Buffer<T>& y_buffer, const std::vector<size_t>& y_offsets,
+                                      const size_t y_inc, const Buffer<T>& a_buffer, const size_t a_offset,
+                                      const size_t a_ld, const size_t k) {
+  // Runs the rank-2 version of the deferred update
+  RankTwoDeferred(layout, triangle, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer,
+                  a_offset, a_ld, k, false);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xsyr2Deferred<half>;
+template class Xsyr2Deferred<float>;
+template class Xsyr2Deferred<double>;
+
+// =================================================================================================
+}  // namespace clblast
@@ -0,0 +1,47 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xsyr2Deferred routine. This is a non-blas routine which applies k symmetric
+// rank-2 updates A += alpha_l * x_l * y_l^T + alpha_l * y_l * x_l^T at once. It is based on the
+// XgerDeferred routine, which gathers the vectors into panels and applies them with a single
+// triangular direct GEMM kernel. A chain of SYR updates is expressed by passing the x-vectors also
+// as y-vectors, with the alphas halved.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSYR2DEFERRED_H_
+#define CLBLAST_ROUTINES_XSYR2DEFERRED_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "routines/levelx/xgerdeferred.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xsyr2Deferred : public XgerDeferred<T> {
+ public:
+  // Uses the rank-2 version of the XgerDeferred routine
+  using XgerDeferred<T>::RankTwoDeferred;
+
+  // Constructor
+  Xsyr2Deferred(Queue& queue, EventPointer event, const std::string& name = "SYR2DEFERRED");
+
+  // Templated-precision implementation of the routine
+  void DoSyr2Deferred(const Layout layout, const Triangle triangle, const size_t n, const std::vector<T>& alphas,
+                      const Buffer<T>& x_buffer, const std::vector<size_t>& x_offsets, const size_t x_inc,
+                      const Buffer<T>& y_buffer, const std::vector<size_t>& y_offsets, const size_t y_inc,
+                      const Buffer<T>& a_buffer, const size_t a_offset, const size_t a_ld, const size_t k);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XSYR2DEFERRED_H_
+#endif
@@ -0,0 +1,40 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xwaxpby routine, computing w = alpha*x + beta*y in a single pass over
+// memory. It uses the Xaxpby kernels of 'xaxpy.opencl' and the tuning parameters of Xaxpy. The
+// Xaxpby routine inherits from this class, passing y also as w.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XWAXPBY_H_
+#define CLBLAST_ROUTINES_XWAXPBY_H_
+
+#include <cstddef>
+#include <string>
+
+#include "routine.hpp"
+#include "utilities/backend.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xwaxpby : public Routine {
+ public:
+  // Constructor
+  Xwaxpby(Queue& queue, EventPointer event, const std::string& name = "WAXPBY");
+
+  // Templated-precision implementation of the routine
+  void DoWaxpby(const size_t n, const T alpha, const Buffer<T>& x_buffer, const size_t x_offset, const size_t x_inc,
+                const T beta, const Buffer<T>& y_buffer, const size_t y_offset, const size_t y_inc,
+                const Buffer<T>& w_buffer, const size_t w_offset, const size_t w_inc);
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_ROUTINES_XWAXPBY_H_
+#endif
@@ -23,6 +23,10 @@
 #include "routines/level1/xmax.hpp"  // non-BLAS routine
 #include "routines/level1/xmin.hpp"  // non-BLAS routine
 #include "routines/level1/xnrm2.hpp"
+#include "routines/level1/xrot.hpp"
+#include "routines/level1/xrotg.hpp"
+#include "routines/level1/xrotm.hpp"
+#include "routines/level1/xrotmg.hpp"
 #include "routines/level1/xscal.hpp"
 #include "routines/level1/xsum.hpp"  // non-BLAS routine
 #include "routines/level1/xswap.hpp"
@@ -48,7 +52,9 @@
 #include "routines/level2/xsyr.hpp"
 #include "routines/level2/xsyr2.hpp"
 #include "routines/level2/xtbmv.hpp"
+#include "routines/level2/xtbsv.hpp"
 #include "routines/level2/xtpmv.hpp"
+#include "routines/level2/xtpsv.hpp"
 #include "routines/level2/xtrmv.hpp"
 #include "routines/level2/xtrsv.hpp"
 
@@ -64,14 +70,34 @@
 #include "routines/level3/xtrsm.hpp"
 
 // Level-x includes (non-BLAS)
+#include "routines/levelx/xamaxbatched.hpp"
+#include "routines/levelx/xamaxmatrix.hpp"
+#include "routines/levelx/xasumbatched.hpp"
+#include "routines/levelx/xaxpby.hpp"
 #include "routines/levelx/xaxpybatched.hpp"
+#include "routines/levelx/xaxpydevicescalars.hpp"
 #include "routines/levelx/xcol2im.hpp"
 #include "routines/levelx/xconvgemm.hpp"
+#include "routines/levelx/xdgmm.hpp"
+#include "routines/levelx/xdotbatched.hpp"
+#include "routines/levelx/xelementwise.hpp"
 #include "routines/levelx/xgemmbatched.hpp"
+#include "routines/levelx/xgemmdevicescalars.hpp"
+#include "routines/levelx/xgemmgrouped.hpp"
 #include "routines/levelx/xgemmstridedbatched.hpp"
+#include "routines/levelx/xgemvbatched.hpp"
+#include "routines/levelx/xgemvdevicescalars.hpp"
+#include "routines/levelx/xgerdeferred.hpp"
 #include "routines/levelx/xhad.hpp"
+#include "routines/levelx/xher2deferred.hpp"
 #include "routines/levelx/xim2col.hpp"
+#include "routines/levelx/xmapreduce.hpp"
+#include "routines/levelx/xnrm2batched.hpp"
 #include "routines/levelx/xomatcopy.hpp"
+#include "routines/levelx/xrotbatched.hpp"
+#include "routines/levelx/xscaldevicescalars.hpp"
+#include "routines/levelx/xsyr2deferred.hpp"
+#include "routines/levelx/xwaxpby.hpp"
 // IWYU pragma: end_exports
 
 // CLBLAST_ROUTINES_ROUTINES_H_
@@ -0,0 +1,58 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xdgmm OpenCL kernels.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xdgmm.hpp"
+
+#include "tuning/tuning.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  try {
+    const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+    switch (clblast::GetPrecision(command_line_args)) {
+      case clblast::Precision::kHalf:
+        clblast::Tuner<half>(argc, argv, 0, clblast::XdgmmGetTunerDefaults, clblast::XdgmmGetTunerSettings<half>,
+                             clblast::XdgmmTestValidArguments<half>, clblast::XdgmmSetConstraints,
+                             clblast::XdgmmComputeLocalMemSize<half>, clblast::XdgmmSetArguments<half>);
+        break;
+      case clblast::Precision::kSingle:
+        clblast::Tuner<float>(argc, argv, 0, clblast::XdgmmGetTunerDefaults, clblast::XdgmmGetTunerSettings<float>,
+                              clblast::XdgmmTestValidArguments<float>, clblast::XdgmmSetConstraints,
+                              clblast::XdgmmComputeLocalMemSize<float>, clblast::XdgmmSetArguments<float>);
+        break;
+      case clblast::Precision::kDouble:
+        clblast::Tuner<double>(argc, argv, 0, clblast::XdgmmGetTunerDefaults, clblast::XdgmmGetTunerSettings<double>,
+                               clblast::XdgmmTestValidArguments<double>, clblast::XdgmmSetConstraints,
+                               clblast::XdgmmComputeLocalMemSize<double>, clblast::XdgmmSetArguments<double>);
+        break;
+      case clblast::Precision::kComplexSingle:
+        clblast::Tuner<float2>(argc, argv, 0, clblast::XdgmmGetTunerDefaults, clblast::XdgmmGetTunerSettings<float2>,
+                               clblast::XdgmmTestValidArguments<float2>, clblast::XdgmmSetConstraints,
+                               clblast::XdgmmComputeLocalMemSize<float2>, clblast::XdgmmSetArguments<float2>);
+        break;
+      case clblast::Precision::kComplexDouble:
+        clblast::Tuner<double2>(argc, argv, 0, clblast::XdgmmGetTunerDefaults, clblast::XdgmmGetTunerSettings<double2>,
+                                clblast::XdgmmTestValidArguments<double2>, clblast::XdgmmSetConstraints,
+                                clblast::XdgmmComputeLocalMemSize<double2>, clblast::XdgmmSetArguments<double2>);
+        break;
+    }
+    return 0;
+  } catch (...) {
+    return static_cast<int>(clblast::DispatchException());
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,108 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xdgmm OpenCL kernel, scaling the rows or the columns of
+// a matrix by a vector as used by DGMM. The kernel is tuned for a single matrix scaled along its
+// contiguous dimension.
+//
+// =================================================================================================
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "tuning/configurations.hpp"
+#include "tuning/tuning.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XdgmmGetTunerDefaults(const int) {
+  auto settings = TunerDefaults();
+  settings.options = {kArgM, kArgN};
+  settings.default_m = 1024;
+  settings.default_n = 1024;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XdgmmGetTunerSettings(const int, const Arguments<T>& args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xdgmm";
+  settings.kernel_name = "Xdgmm";
+  settings.sources =
+#include "../src/kernels/levelx/xdgmm.opencl"
+      ;
+
+  // Buffer sizes
+  settings.size_x = args.m;
+  settings.size_a = args.m * args.n;
+  settings.size_c = args.m * args.n;
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {0, 2, 4};
+  settings.outputs = {4};
+
+  // Sets the base thread configuration
+  settings.global_size = {args.m, args.n};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1, 1};
+  settings.local_size_ref = {8, 8};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"DGMM_DIMX", "DGMM_DIMY"}};
+  settings.div_global = {{"DGMM_WPTX", "DGMM_WPTY"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+      {"DGMM_DIMX", {8, 16, 32}},
+      {"DGMM_DIMY", {8, 16, 32}},
+      {"DGMM_WPTX", {1, 2, 4}},
+      {"DGMM_WPTY", {1, 2, 4, 8}},
+  };
+
+  // Describes how to compute the performance metrics
+  settings.metric_amount = (2 * args.m * args.n + args.m) * GetBytes(args.precision);
+  settings.performance_unit = "GB/s";
+
+  return settings;
+}
+
+// Tests for valid arguments
+template <typename T>
+void XdgmmTestValidArguments(const int, const Arguments<T>&) {}
+std::vector<Constraint> XdgmmSetConstraints(const int) { return {}; }
+template <typename T>
+LocalMemSizeInfo XdgmmComputeLocalMemSize(const int) {
+  return {[](std::vector<size_t>) -> size_t { return 0; }, {}};
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XdgmmSetArguments(const int, Kernel& kernel, const Arguments<T>& args, std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.m));
+  kernel.SetArgument(1, static_cast<int>(args.n));
+  kernel.SetArgument(2, 1);                          // scale_one
+  kernel.SetArgument(3, buffers[2]());               // 2 == A matrix
+  kernel.SetArgument(4, 0);                          // a_offset
+  kernel.SetArgument(5, static_cast<int>(args.m));   // a_ld
+  kernel.SetArgument(6, 0);                          // a_stride
+  kernel.SetArgument(7, buffers[0]());               // 0 == X vector
+  kernel.SetArgument(8, 0);                          // x_offset
+  kernel.SetArgument(9, 1);                          // x_inc
+  kernel.SetArgument(10, 0);                         // x_stride
+  kernel.SetArgument(11, buffers[4]());              // 4 == C matrix
+  kernel.SetArgument(12, 0);                         // c_offset
+  kernel.SetArgument(13, static_cast<int>(args.m));  // c_ld
+  kernel.SetArgument(14, 0);                         // c_stride
+}
+
+// =================================================================================================
+}  // namespace clblast
@@ -4,7 +4,10 @@
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
 // This file uses the auto-tuner to tune the xdot OpenCL kernels. Note that the results are
-// not verified, since the result is not final and depends on the WGS2 parameter.
+// not verified, since the result is not final and depends on the WGS2 parameter. The first
+// variation also selects between the two-pass and the single-pass version (SINGLE_PASS): the
+// latter avoids the launch of the epilogue kernel, which is therefore included in the timings of
+// the two-pass version.
 //
 // =================================================================================================
 
@@ -43,11 +46,23 @@ TunerSettings XdotGetTunerSettings(const int V, const Arguments<T>& args) {
   // Buffer sizes
   settings.size_x = args.n;
   settings.size_y = args.n;
+  settings.size_a = 2;          // Work-group counter of the single-pass version
+  settings.size_c = 1;          // Final result of the single-pass version
   settings.size_temp = args.n;  // Worst case
 
   // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
-  settings.inputs = {0, 1, 5};
-  settings.outputs = {};  // no output checking
+  settings.inputs = {0, 1, 2, 5};
+  settings.outputs = {};       // no output checking
+  settings.zero_inputs = {2};  // the work-group counter starts at zero
+
+  // The two-pass version of the main kernel is timed together with its epilogue (with default WGS2)
+  if (V == 1) {
+    settings.epilogue_kernel_name = "XdotEpilogue";
+    settings.epilogue_skip_parameter = "SINGLE_PASS";
+    settings.epilogue_variation = 2;
+    settings.epilogue_global_size = {64};
+    settings.epilogue_local_size = {64};
+  }
 
   // Sets the base thread configuration
   settings.global_size = (V == 1) ? std::vector<size_t>{2 * 64} : std::vector<size_t>{1};
@@ -60,9 +75,16 @@ TunerSettings XdotGetTunerSettings(const int V, const Arguments<T>& args) {
   settings.mul_global = (V == 1) ? TransformVector{{"WGS1"}} : TransformVector{{"WGS2"}};
 
   // Sets the tuning parameters and their possible values
-  settings.parameters = {
-      {"WGS" + std::to_string(V), {32, 64, 128, 256, 512, 1024}},
-  };
+  if (V == 1) {
+    settings.parameters = {
+        {"WGS1", {32, 64, 128, 256, 512, 1024}},
+        {"SINGLE_PASS", {0, 1}},
+    };
+  } else {
+    settings.parameters = {
+        {"WGS2", {32, 64, 128, 256, 512, 1024}},
+    };
+  }
 
   // Describes how to compute the performance metrics
   settings.metric_amount = (V == 1) ? (2 * args.n + 1) * GetBytes(args.precision) : 1 * GetBytes(args.precision);
@@ -94,9 +116,13 @@ void XdotSetArguments(const int V, Kernel& kernel, const Arguments<T>& args, std
     kernel.SetArgument(6, 1);
     kernel.SetArgument(7, buffers[5]());  // 5 == temp; no output checking - size varies
     kernel.SetArgument(8, static_cast<int>(false));
+    kernel.SetArgument(9, buffers[2]());   // 2 == A matrix, used as work-group counter
+    kernel.SetArgument(10, buffers[4]());  // 4 == C matrix; no output checking
+    kernel.SetArgument(11, 0);
+    kernel.SetArgument(12, static_cast<int>(false));  // no compensated summation
   } else {
     kernel.SetArgument(0, buffers[5]());  // 5 == temp
-    kernel.SetArgument(1, buffers[0]());  // 0 == X vector; no output checking - size varies
+    kernel.SetArgument(1, buffers[4]());  // 4 == C matrix; no output checking
     kernel.SetArgument(2, 0);
   }
 }
@@ -0,0 +1,58 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xgbmv OpenCL kernels.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xgbmv.hpp"
+
+#include "tuning/tuning.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  try {
+    const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+    switch (clblast::GetPrecision(command_line_args)) {
+      case clblast::Precision::kHalf:
+        clblast::Tuner<half>(argc, argv, 0, clblast::XgbmvGetTunerDefaults, clblast::XgbmvGetTunerSettings<half>,
+                             clblast::XgbmvTestValidArguments<half>, clblast::XgbmvSetConstraints,
+                             clblast::XgbmvComputeLocalMemSize<half>, clblast::XgbmvSetArguments<half>);
+        break;
+      case clblast::Precision::kSingle:
+        clblast::Tuner<float>(argc, argv, 0, clblast::XgbmvGetTunerDefaults, clblast::XgbmvGetTunerSettings<float>,
+                              clblast::XgbmvTestValidArguments<float>, clblast::XgbmvSetConstraints,
+                              clblast::XgbmvComputeLocalMemSize<float>, clblast::XgbmvSetArguments<float>);
+        break;
+      case clblast::Precision::kDouble:
+        clblast::Tuner<double>(argc, argv, 0, clblast::XgbmvGetTunerDefaults, clblast::XgbmvGetTunerSettings<double>,
+                               clblast::XgbmvTestValidArguments<double>, clblast::XgbmvSetConstraints,
+                               clblast::XgbmvComputeLocalMemSize<double>, clblast::XgbmvSetArguments<double>);
+        break;
+      case clblast::Precision::kComplexSingle:
+        clblast::Tuner<float2>(argc, argv, 0, clblast::XgbmvGetTunerDefaults, clblast::XgbmvGetTunerSettings<float2>,
+                               clblast::XgbmvTestValidArguments<float2>, clblast::XgbmvSetConstraints,
+                               clblast::XgbmvComputeLocalMemSize<float2>, clblast::XgbmvSetArguments<float2>);
+        break;
+      case clblast::Precision::kComplexDouble:
+        clblast::Tuner<double2>(argc, argv, 0, clblast::XgbmvGetTunerDefaults, clblast::XgbmvGetTunerSettings<double2>,
+                                clblast::XgbmvTestValidArguments<double2>, clblast::XgbmvSetConstraints,
+                                clblast::XgbmvComputeLocalMemSize<double2>, clblast::XgbmvSetArguments<double2>);
+        break;
+    }
+    return 0;
+  } catch (...) {
+    return static_cast<int>(clblast::DispatchException());
+  }
+}
+
+// =================================================================================================
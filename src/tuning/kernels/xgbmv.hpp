@@ -0,0 +1,118 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xgbmv OpenCL kernel, the banded matrix-vector kernel
+// used by GBMV, SBMV, HBMV and TBMV. The band has 'k' sub- and 'k' super-diagonals.
+//
+// =================================================================================================
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tuning/configurations.hpp"
+#include "tuning/tuning.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XgbmvGetTunerDefaults(const int) {
+  auto settings = TunerDefaults();
+  settings.options = {kArgM, kArgN, kArgK, kArgAlpha, kArgBeta};
+  settings.default_m = 262144;
+  settings.default_n = 262144;
+  settings.default_k = 8;
+  settings.default_num_runs = 4;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XgbmvGetTunerSettings(const int, const Arguments<T>& args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xgbmv";
+  settings.kernel_name = "Xgbmv";
+  settings.sources =
+#include "../src/kernels/level2/xgbmv.opencl"
+      ;
+
+  // Buffer sizes
+  settings.size_x = args.n;
+  settings.size_y = args.m;
+  settings.size_a = (2 * args.k + 1) * args.n;
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {0, 1, 2};
+  settings.outputs = {1};
+
+  // Sets the base thread configuration
+  settings.global_size = {args.m};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1};
+  settings.local_size_ref = {64};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"WGS"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+      {"WGS", {32, 64, 128, 256}},
+      {"DIAGS", {2, 4, 8, 16, 32}},
+  };
+
+  // Describes how to compute the performance metrics
+  settings.metric_amount = ((2 * args.k + 1) * args.n + 2 * args.m + args.n) * GetBytes(args.precision);
+  settings.performance_unit = "GB/s";
+
+  return settings;
+}
+
+// Tests for valid arguments
+template <typename T>
+void XgbmvTestValidArguments(const int, const Arguments<T>& args) {
+  if (!IsMultiple(args.m, 256)) {
+    throw std::runtime_error("'Xgbmv' requires 'm' to be a multiple of 256");
+  }
+}
+std::vector<Constraint> XgbmvSetConstraints(const int) { return {}; }
+template <typename T>
+LocalMemSizeInfo XgbmvComputeLocalMemSize(const int) {
+  return {[](std::vector<size_t> v) -> size_t {
+            return GetBytes(PrecisionValue<T>()) * (v[0] + v[1] - 1) * (v[1] + 2);
+          },
+          {"WGS", "DIAGS"}};
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XgbmvSetArguments(const int, Kernel& kernel, const Arguments<T>& args, std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.m));
+  kernel.SetArgument(1, static_cast<int>(args.n));
+  kernel.SetArgument(2, GetRealArg(args.alpha));
+  kernel.SetArgument(3, GetRealArg(args.beta));
+  kernel.SetArgument(4, 0);                                 // a_rotated
+  kernel.SetArgument(5, buffers[2]());                      // 2 == A matrix
+  kernel.SetArgument(6, 0);                                 // a_offset
+  kernel.SetArgument(7, static_cast<int>(2 * args.k + 1));  // a_ld
+  kernel.SetArgument(8, buffers[0]());                      // 0 == X vector
+  kernel.SetArgument(9, 0);                                 // x_offset
+  kernel.SetArgument(10, 1);                                // x_increment
+  kernel.SetArgument(11, buffers[1]());                     // 1 == Y vector
+  kernel.SetArgument(12, 0);                                // y_offset
+  kernel.SetArgument(13, 1);                                // y_increment
+  kernel.SetArgument(14, 0);                                // Conjugate transpose
+  kernel.SetArgument(15, 0);                                // Additional parameter
+  kernel.SetArgument(16, static_cast<int>(args.k));         // Banded 'kl'
+  kernel.SetArgument(17, static_cast<int>(args.k));         // Banded 'ku'
+}
+
+// =================================================================================================
+}  // namespace clblast
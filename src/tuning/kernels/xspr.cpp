@@ -0,0 +1,58 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xspr OpenCL kernels.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xspr.hpp"
+
+#include "tuning/tuning.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  try {
+    const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+    switch (clblast::GetPrecision(command_line_args)) {
+      case clblast::Precision::kHalf:
+        clblast::Tuner<half>(argc, argv, 0, clblast::XsprGetTunerDefaults, clblast::XsprGetTunerSettings<half>,
+                             clblast::XsprTestValidArguments<half>, clblast::XsprSetConstraints,
+                             clblast::XsprComputeLocalMemSize<half>, clblast::XsprSetArguments<half>);
+        break;
+      case clblast::Precision::kSingle:
+        clblast::Tuner<float>(argc, argv, 0, clblast::XsprGetTunerDefaults, clblast::XsprGetTunerSettings<float>,
+                              clblast::XsprTestValidArguments<float>, clblast::XsprSetConstraints,
+                              clblast::XsprComputeLocalMemSize<float>, clblast::XsprSetArguments<float>);
+        break;
+      case clblast::Precision::kDouble:
+        clblast::Tuner<double>(argc, argv, 0, clblast::XsprGetTunerDefaults, clblast::XsprGetTunerSettings<double>,
+                               clblast::XsprTestValidArguments<double>, clblast::XsprSetConstraints,
+                               clblast::XsprComputeLocalMemSize<double>, clblast::XsprSetArguments<double>);
+        break;
+      case clblast::Precision::kComplexSingle:
+        clblast::Tuner<float2>(argc, argv, 0, clblast::XsprGetTunerDefaults, clblast::XsprGetTunerSettings<float2>,
+                               clblast::XsprTestValidArguments<float2>, clblast::XsprSetConstraints,
+                               clblast::XsprComputeLocalMemSize<float2>, clblast::XsprSetArguments<float2>);
+        break;
+      case clblast::Precision::kComplexDouble:
+        clblast::Tuner<double2>(argc, argv, 0, clblast::XsprGetTunerDefaults, clblast::XsprGetTunerSettings<double2>,
+                                clblast::XsprTestValidArguments<double2>, clblast::XsprSetConstraints,
+                                clblast::XsprComputeLocalMemSize<double2>, clblast::XsprSetArguments<double2>);
+        break;
+    }
+    return 0;
+  } catch (...) {
+    return static_cast<int>(clblast::DispatchException());
+  }
+}
+
+// =================================================================================================
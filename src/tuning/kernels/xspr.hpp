@@ -0,0 +1,108 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xspr OpenCL kernels, the packed rank-1 and rank-2 update
+// kernels used by SPR, HPR, SPR2 and HPR2. The rank-2 kernel is tuned, the rank-1 kernel shares its
+// parameters.
+//
+// =================================================================================================
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tuning/configurations.hpp"
+#include "tuning/tuning.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XsprGetTunerDefaults(const int) {
+  auto settings = TunerDefaults();
+  settings.options = {kArgN, kArgAlpha};
+  settings.default_n = 4095;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XsprGetTunerSettings(const int, const Arguments<T>& args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xspr";
+  settings.kernel_name = "Xspr2";
+  settings.sources =
+#include "../src/kernels/level2/level2.opencl"
+#include "../src/kernels/level2/xspr.opencl"
+      ;
+
+  // Buffer sizes
+  settings.size_x = args.n;
+  settings.size_y = args.n;
+  settings.size_a = ((args.n + 1) * args.n) / 2;
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {0, 1, 2};
+  settings.outputs = {2};
+
+  // Sets the base thread configuration: a pair of packed columns (n+1 elements) per column of threads
+  settings.global_size = {args.n + 1, CeilDiv(args.n, size_t{2})};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1, 1};
+  settings.local_size_ref = {64, 1};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"WGS"}};
+  settings.div_global = {{"WPT"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+      {"WGS", {32, 64, 128, 256, 512}},
+      {"WPT", {1, 2, 4, 8}},
+  };
+
+  // Describes how to compute the performance metrics
+  settings.metric_amount = (2 * settings.size_a + 2 * args.n) * GetBytes(args.precision);
+  settings.performance_unit = "GB/s";
+
+  return settings;
+}
+
+// Tests for valid arguments
+template <typename T>
+void XsprTestValidArguments(const int, const Arguments<T>& args) {
+  if (!IsMultiple(args.n + 1, 8)) {
+    throw std::runtime_error("'Xspr' requires 'n+1' to be a multiple of 8");
+  }
+}
+std::vector<Constraint> XsprSetConstraints(const int) { return {}; }
+template <typename T>
+LocalMemSizeInfo XsprComputeLocalMemSize(const int) {
+  return {[](std::vector<size_t>) -> size_t { return 0; }, {}};
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XsprSetArguments(const int, Kernel& kernel, const Arguments<T>& args, std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.n));
+  kernel.SetArgument(1, GetRealArg(args.alpha));
+  kernel.SetArgument(2, buffers[0]());  // 0 == X vector
+  kernel.SetArgument(3, 0);             // x_offset
+  kernel.SetArgument(4, 1);             // x_increment
+  kernel.SetArgument(5, buffers[1]());  // 1 == Y vector
+  kernel.SetArgument(6, 0);             // y_offset
+  kernel.SetArgument(7, 1);             // y_increment
+  kernel.SetArgument(8, buffers[2]());  // 2 == A matrix (packed)
+  kernel.SetArgument(9, 0);             // a_offset
+  kernel.SetArgument(10, 1);            // is_upper
+  kernel.SetArgument(11, 0);            // is_rowmajor
+}
+
+// =================================================================================================
+}  // namespace clblast
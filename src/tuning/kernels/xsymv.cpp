@@ -0,0 +1,58 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xsymv OpenCL kernels.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xsymv.hpp"
+
+#include "tuning/tuning.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/utilities.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  try {
+    const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+    switch (clblast::GetPrecision(command_line_args)) {
+      case clblast::Precision::kHalf:
+        clblast::Tuner<half>(argc, argv, 0, clblast::XsymvGetTunerDefaults, clblast::XsymvGetTunerSettings<half>,
+                             clblast::XsymvTestValidArguments<half>, clblast::XsymvSetConstraints,
+                             clblast::XsymvComputeLocalMemSize<half>, clblast::XsymvSetArguments<half>);
+        break;
+      case clblast::Precision::kSingle:
+        clblast::Tuner<float>(argc, argv, 0, clblast::XsymvGetTunerDefaults, clblast::XsymvGetTunerSettings<float>,
+                              clblast::XsymvTestValidArguments<float>, clblast::XsymvSetConstraints,
+                              clblast::XsymvComputeLocalMemSize<float>, clblast::XsymvSetArguments<float>);
+        break;
+      case clblast::Precision::kDouble:
+        clblast::Tuner<double>(argc, argv, 0, clblast::XsymvGetTunerDefaults, clblast::XsymvGetTunerSettings<double>,
+                               clblast::XsymvTestValidArguments<double>, clblast::XsymvSetConstraints,
+                               clblast::XsymvComputeLocalMemSize<double>, clblast::XsymvSetArguments<double>);
+        break;
+      case clblast::Precision::kComplexSingle:
+        clblast::Tuner<float2>(argc, argv, 0, clblast::XsymvGetTunerDefaults, clblast::XsymvGetTunerSettings<float2>,
+                               clblast::XsymvTestValidArguments<float2>, clblast::XsymvSetConstraints,
+                               clblast::XsymvComputeLocalMemSize<float2>, clblast::XsymvSetArguments<float2>);
+        break;
+      case clblast::Precision::kComplexDouble:
+        clblast::Tuner<double2>(argc, argv, 0, clblast::XsymvGetTunerDefaults, clblast::XsymvGetTunerSettings<double2>,
+                                clblast::XsymvTestValidArguments<double2>, clblast::XsymvSetConstraints,
+                                clblast::XsymvComputeLocalMemSize<double2>, clblast::XsymvSetArguments<double2>);
+        break;
+    }
+    return 0;
+  } catch (...) {
+    return static_cast<int>(clblast::DispatchException());
+  }
+}
+
+// =================================================================================================
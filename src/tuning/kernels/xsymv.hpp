@@ -0,0 +1,107 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xsymv OpenCL kernel, the first (partial results) kernel
+// of the symmetric and hermitian matrix-vector multiplications SYMV, HEMV, SPMV and HPMV.
+//
+// =================================================================================================
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tuning/configurations.hpp"
+#include "tuning/tuning.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XsymvGetTunerDefaults(const int) {
+  auto settings = TunerDefaults();
+  settings.options = {kArgN};
+  settings.default_n = 4096;
+  settings.default_num_runs = 4;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XsymvGetTunerSettings(const int, const Arguments<T>& args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xsymv";
+  settings.kernel_name = "Xsymv";
+  settings.sources =
+#include "../src/kernels/level2/xsymv.opencl"
+      ;
+
+  // Buffer sizes
+  settings.size_x = args.n;
+  settings.size_a = args.n * args.n;
+  settings.size_temp = args.n * 256;  // Worst case: one slot of size n for each of the maximum number of work-groups
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {0, 2, 5};
+  settings.outputs = {};  // no output checking
+
+  // Sets the base thread configuration: SLOTS work-groups of WGS threads each
+  settings.global_size = {1};
+  settings.global_size_ref = {64 * 32};
+  settings.local_size = {1};
+  settings.local_size_ref = {32};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"WGS"}};
+  settings.mul_global = {{"SLOTS", "WGS"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+      {"SLOTS", {16, 32, 64, 128, 256}},
+      {"WGS", {16, 32, 64, 128}},
+  };
+
+  // Describes how to compute the performance metrics: only the stored triangle is read
+  settings.metric_amount = (args.n * (args.n + 1) / 2 + args.n) * GetBytes(args.precision);
+  settings.performance_unit = "GB/s";
+
+  return settings;
+}
+
+// Tests for valid arguments
+template <typename T>
+void XsymvTestValidArguments(const int, const Arguments<T>& args) {
+  if (!IsMultiple(args.n, 128)) {
+    throw std::runtime_error("'Xsymv' requires 'n' to be a multiple of 128");
+  }
+}
+std::vector<Constraint> XsymvSetConstraints(const int) { return {}; }
+template <typename T>
+LocalMemSizeInfo XsymvComputeLocalMemSize(const int) {
+  return {[](std::vector<size_t> v) -> size_t { return GetBytes(PrecisionValue<T>()) * v[0] * (v[0] + 3); }, {"WGS"}};
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XsymvSetArguments(const int, Kernel& kernel, const Arguments<T>& args, std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.n));
+  kernel.SetArgument(1, buffers[2]());                 // 2 == A matrix
+  kernel.SetArgument(2, 0);                            // a_offset
+  kernel.SetArgument(3, static_cast<int>(args.n));     // a_ld
+  kernel.SetArgument(4, buffers[0]());                 // 0 == X vector
+  kernel.SetArgument(5, 0);                            // x_offset
+  kernel.SetArgument(6, 1);                            // x_increment
+  kernel.SetArgument(7, buffers[5]());                 // 5 == temporary buffer (partial results)
+  kernel.SetArgument(8, static_cast<int>(args.n));     // w_ld
+  kernel.SetArgument(9, 0);                            // is_upper
+  kernel.SetArgument(10, 0);                           // a_rotated
+}
+
+// =================================================================================================
+}  // namespace clblast
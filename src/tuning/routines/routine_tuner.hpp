@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <cstdio>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -29,16 +30,28 @@
 namespace clblast {
 // =================================================================================================
 
+// Overrides a single routine-level parameter, keeping the current values of all the others
 template <typename T>
-void ForceSelectIndirectFrom(const size_t minimum_size, const Device& device, const std::string& tuner_name,
-                             const std::string& parameter_name) {
-  const auto override_status =
-      OverrideParameters(device(), tuner_name, PrecisionValue<T>(), {{parameter_name, minimum_size}});
+void OverrideRoutineParameter(const size_t value, const Device& device, const std::string& tuner_name,
+                              const std::string& parameter_name) {
+  auto parameters = std::unordered_map<std::string, size_t>();
+  const auto retrieve_status = RetrieveParameters(device(), tuner_name, PrecisionValue<T>(), parameters);
+  if (retrieve_status != StatusCode::kSuccess) {
+    throw RuntimeError("RetrieveParameters failed with status " + ToString(retrieve_status));
+  }
+  parameters[parameter_name] = value;
+  const auto override_status = OverrideParameters(device(), tuner_name, PrecisionValue<T>(), parameters);
   if (override_status != StatusCode::kSuccess) {
     throw RuntimeError("OverrideParameters failed with status " + ToString(override_status));
   }
 }
 
+template <typename T>
+void ForceSelectIndirectFrom(const size_t minimum_size, const Device& device, const std::string& tuner_name,
+                             const std::string& parameter_name) {
+  OverrideRoutineParameter<T>(minimum_size, device, tuner_name, parameter_name);
+}
+
 // Computes the best switching point
 TuningResult GetBestResult(const std::vector<TuningResult>& scores) {
   auto comparison = [](const TuningResult& lhs, const TuningResult& rhs) { return lhs.score < rhs.score; };
@@ -4,7 +4,9 @@
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
 // This file tunes the Xgemm routine at a high-level: choosing between the direct (single-kernel)
-// and the in-direct (kernel plus pre/post-processing) methods.
+// and the in-direct (kernel plus pre/post-processing) methods. It also benchmarks the Stream-K
+// version of the in-direct kernel against the regular version for a sweep of sizes, and it tunes
+// the number of persistent work-groups of the grouped GEMM routine.
 //
 // =================================================================================================
 
@@ -13,6 +15,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
+#include <limits>
 #include <string>
 #include <utility>
 #include <vector>
@@ -48,6 +51,42 @@ void RunGemmRoutine(const size_t value, const Queue& queue, const std::vector<Bu
   RunGemmRoutineMNK(value, value, value, queue, buffers);
 }
 
+// Fixed (large) K-dimension for the Stream-K tuning: Stream-K helps most when there are only a
+// few tiles in the M and N dimensions, but lots of work per tile
+constexpr auto kStreamKSizeK = size_t{2048};
+template <typename T>
+void RunGemmStreamKRoutine(const size_t value, const Queue& queue, const std::vector<Buffer<T>>& buffers) {
+  RunGemmRoutineMNK(value, value, kStreamKSizeK, queue, buffers);
+}
+
+// Number of entries for the grouped GEMM tuning: the entries are square matrices of increasingly
+// larger sizes, the largest one being of the size under test
+constexpr auto kGroupedCount = size_t{8};
+template <typename T>
+void RunGemmGroupedRoutine(const size_t value, const Queue& queue, const std::vector<Buffer<T>>& buffers) {
+  auto sizes = std::vector<size_t>(kGroupedCount);
+  auto offsets = std::vector<size_t>(kGroupedCount);
+  auto lds = std::vector<size_t>(kGroupedCount);
+  auto factors = std::vector<T>(kGroupedCount);
+  for (auto i = size_t{0}; i < kGroupedCount; ++i) {
+    sizes[i] = std::max(value * (i + 1) / kGroupedCount, size_t{1});
+    offsets[i] = i * value * value;
+    lds[i] = sizes[i];
+    factors[i] = ConstantOne<T>();
+  }
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  auto status = GemmGrouped(Layout::kRowMajor, Transpose::kNo, Transpose::kNo, sizes.data(), sizes.data(),
+                            sizes.data(), factors.data(), buffers[0](), offsets.data(), lds.data(), buffers[1](),
+                            offsets.data(), lds.data(), factors.data(), buffers[2](), offsets.data(), lds.data(),
+                            kGroupedCount, &queue_plain, &event);
+  if (status != StatusCode::kSuccess) {
+    throw RuntimeError("GemmGrouped failed with status " + ToString(status));
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+}
+
 template <typename T, size_t batch_count>
 void RunGemmBatchedRoutine(const size_t value, const Queue& queue, const std::vector<Buffer<T>>& buffers) {
   auto offsets = std::vector<size_t>(batch_count);
@@ -128,6 +167,136 @@ void TuneGemmSingleSize(const Platform& platform, const Device& device, const Co
 
 // =================================================================================================
 
+// Compares the regular in-direct GEMM kernel with the Stream-K version of it for sizes which result
+// in a number of tiles which is not necessarily a multiple of the number of compute units. This
+// tests various numbers of persistent work-groups per compute unit, zero being the regular kernel.
+template <typename T>
+void TuneGemmStreamK(const Platform& platform, const Device& device, const Context& context, Queue& queue,
+                     const Precision precision, const size_t from, const size_t to, const size_t step,
+                     const size_t num_runs) {
+  // Buffers
+  auto buffers = std::vector<Buffer<T>>{Buffer<T>(context, to * kStreamKSizeK), Buffer<T>(context, kStreamKSizeK * to),
+                                        Buffer<T>(context, to * to)};
+
+  // Runs all the sizes for all the Stream-K settings, always using the in-direct kernel
+  const auto group_settings = std::vector<size_t>{0, 1, 2, 4};
+  auto timings = std::vector<std::vector<Timing>>();
+  ForceSelectIndirectFrom<T>(0, device, "GemmRoutine", "XGEMM_MIN_INDIRECT_SIZE");
+  for (const auto groups : group_settings) {
+    printf("\n* Testing the in-direct gemm routine with XGEMM_STREAMK_GROUPS=%zu for m=n, k=%zu\n", groups,
+           kStreamKSizeK);
+    OverrideRoutineParameter<T>(groups, device, "GemmRoutine", "XGEMM_STREAMK_GROUPS");
+    timings.push_back(TimeRoutine(from, to, step, num_runs, queue, buffers, RunGemmStreamKRoutine<T>));
+  }
+
+  // The score of a setting is the total time over all sizes, relative to the regular kernel
+  printf("\n* Collecting results\n");
+  auto scores = std::vector<TuningResult>();
+  for (auto s = size_t{0}; s < group_settings.size(); ++s) {
+    auto total_time = 0.0;
+    auto total_time_regular = 0.0;
+    for (auto i = size_t{0}; i < timings[s].size(); ++i) {
+      if (timings[s][i].second != -1.0 && timings[0][i].second != -1.0) {
+        total_time += timings[s][i].second;
+        total_time_regular += timings[0][i].second;
+      }
+    }
+    auto tuning_results = Configuration();
+    tuning_results["XGEMM_STREAMK_GROUPS"] = group_settings[s];
+    tuning_results["PRECISION"] = static_cast<size_t>(precision);
+    const auto score = (total_time_regular > 0.0) ? total_time / total_time_regular : -1.0;
+    scores.push_back(TuningResult{"gemm_streamk_selection", score, tuning_results});
+  }
+
+  // Displaying results
+  printf("|   m=n || XGEMM_STREAMK_GROUPS:");
+  for (const auto groups : group_settings) {
+    printf("  %2zu (GFLOPS) |", groups);
+  }
+  printf("\n");
+  for (auto i = size_t{0}; i < timings[0].size(); ++i) {
+    const auto value = timings[0][i].first;
+    printf("| %5zu ||                      ", value);
+    for (auto s = size_t{0}; s < group_settings.size(); ++s) {
+      const auto time_ms = timings[s][i].second;
+      const auto gflops = (time_ms != -1.0) ? (2 * value * value * kStreamKSizeK) / (time_ms * 1.0e6) : 0.0;
+      printf(" %12.1lf |", gflops);
+    }
+    printf("\n");
+  }
+  printf("\n");
+
+  // Outputs the results as JSON to disk, including some meta-data
+  const auto best_result = GetBestResult(scores);
+  const auto best_string = "XGEMM_STREAMK_GROUPS=" + ToString(best_result.config.at("XGEMM_STREAMK_GROUPS"));
+  const auto precision_string = std::to_string(static_cast<size_t>(precision));
+  auto metadata = std::vector<std::pair<std::string, std::string>>{{"kernel_family", "gemm_routine_streamk"},
+                                                                   {"precision", precision_string},
+                                                                   {"arg_from", ToString(from)},
+                                                                   {"arg_to", ToString(to)},
+                                                                   {"arg_step", ToString(step)},
+                                                                   {"arg_k", ToString(kStreamKSizeK)},
+                                                                   {"best_kernel", best_result.name},
+                                                                   {"best_time", ToString(best_result.score)},
+                                                                   {"best_parameters", best_string}};
+  PrintTimingsToFileAsJSON("clblast_gemm_routine_streamk_" + precision_string + ".json", device, platform, metadata,
+                           scores);
+}
+
+// =================================================================================================
+
+// Tunes the number of persistent work-groups per compute unit of the grouped GEMM routine over a
+// sweep of sizes of its largest entry. The best setting is the one with the lowest total time.
+template <typename T>
+void TuneGemmGrouped(const Platform& platform, const Device& device, const Context& context, Queue& queue,
+                     const Precision precision, const size_t from, const size_t to, const size_t step,
+                     const size_t num_runs) {
+  // Buffers
+  const auto buffer_size = kGroupedCount * to * to;
+  auto buffers = std::vector<Buffer<T>>{Buffer<T>(context, buffer_size), Buffer<T>(context, buffer_size),
+                                        Buffer<T>(context, buffer_size)};
+
+  // Runs all the sizes for all the settings
+  const auto group_settings = std::vector<size_t>{1, 2, 4, 8, 16};
+  auto timings = std::vector<std::vector<Timing>>();
+  for (const auto groups : group_settings) {
+    printf("\n* Testing the grouped gemm routine with XGEMM_GROUPED_GROUPS=%zu\n", groups);
+    OverrideRoutineParameter<T>(groups, device, "GemmRoutine", "XGEMM_GROUPED_GROUPS");
+    timings.push_back(TimeRoutine(from, to, step, num_runs, queue, buffers, RunGemmGroupedRoutine<T>));
+  }
+
+  // The score of a setting is the total time over all sizes, a failing setting gets the worst score
+  printf("\n* Collecting results\n");
+  auto scores = std::vector<TuningResult>();
+  for (auto s = size_t{0}; s < group_settings.size(); ++s) {
+    auto total_time = 0.0;
+    for (const auto& timing : timings[s]) {
+      total_time += (timing.second != -1.0) ? timing.second : std::numeric_limits<double>::max();
+    }
+    auto tuning_results = Configuration();
+    tuning_results["XGEMM_GROUPED_GROUPS"] = group_settings[s];
+    tuning_results["PRECISION"] = static_cast<size_t>(precision);
+    scores.push_back(TuningResult{"gemm_grouped_selection", total_time, tuning_results});
+  }
+
+  // Outputs the results as JSON to disk, including some meta-data
+  const auto best_result = GetBestResult(scores);
+  const auto best_string = "XGEMM_GROUPED_GROUPS=" + ToString(best_result.config.at("XGEMM_GROUPED_GROUPS"));
+  const auto precision_string = std::to_string(static_cast<size_t>(precision));
+  auto metadata = std::vector<std::pair<std::string, std::string>>{{"kernel_family", "gemm_routine_grouped"},
+                                                                   {"precision", precision_string},
+                                                                   {"arg_from", ToString(from)},
+                                                                   {"arg_to", ToString(to)},
+                                                                   {"arg_step", ToString(step)},
+                                                                   {"best_kernel", best_result.name},
+                                                                   {"best_time", ToString(best_result.score)},
+                                                                   {"best_parameters", best_string}};
+  PrintTimingsToFileAsJSON("clblast_gemm_routine_grouped_" + precision_string + ".json", device, platform, metadata,
+                           scores);
+}
+
+// =================================================================================================
+
 template <typename T>
 void TuneXgemm(int argc, char* argv[]) {
   auto command_line_args = RetrieveCommandLineArguments(argc, argv);
@@ -183,6 +352,8 @@ void TuneXgemm(int argc, char* argv[]) {
     // Run the tuners for the XGEMM routines
     TuneKernelSelection<T>(platform, device, context, queue, precision, RunGemmRoutine<T>, 64, 2048, 64, 1, num_runs,
                            "gemm", "GemmRoutine", "gemm_routine", "XGEMM_MIN_INDIRECT_SIZE");
+    TuneGemmStreamK<T>(platform, device, context, queue, precision, 96, 2048, 160, num_runs);
+    TuneGemmGrouped<T>(platform, device, context, queue, precision, 64, 1024, 64, num_runs);
     // TuneKernelSelection<T>(platform, device, context, queue, precision, RunGemmBatchedRoutine<T, 30>,
     //                        16, 128, 32, 30, num_runs,
     //                        "gemmbatched", "GemmRoutine", "gemm_routine_2", "XGEMMBATCHED_MIN_INDIRECT_SIZE");
@@ -0,0 +1,157 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file tunes the Xtrsm routine at a high-level: choosing an appropriate size of the inverted diagonal
+// blocks, which are the leaves of the recursive solver
+//
+// =================================================================================================
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cxpp11_common.hpp"
+#include "tuning/configurations.hpp"
+#include "tuning/tuning.hpp"
+#include "utilities/backend.hpp"
+#include "utilities/clblast_exceptions.hpp"
+#include "utilities/timing.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+constexpr auto size = size_t{1024};  // 'm' and 'n' arguments
+
+template <typename T>
+void SetBlockSize(const size_t value, const Device& device) {
+  const auto override_status =
+      OverrideParameters(device(), "TrsmRoutine", PrecisionValue<T>(), {{"TRSM_BLOCK_SIZE", value}});
+  if (override_status != StatusCode::kSuccess) {
+    throw RuntimeError("OverrideParameters failed with status " + ToString(override_status));
+  }
+}
+
+template <typename T>
+void RunTrsmRoutine(const size_t block_size, Queue& queue, const std::vector<Buffer<T>>& buffers) {
+  SetBlockSize<T>(block_size, queue.GetDevice());
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  auto status = Trsm<T>(Layout::kColMajor, Side::kLeft, Triangle::kLower, Transpose::kNo, Diagonal::kNonUnit, size,
+                        size, ConstantOne<T>(), buffers[0](), 0, size,  // A matrix
+                        buffers[1](), 0, size,                          // B matrix
+                        &queue_plain, &event);
+  if (status != StatusCode::kSuccess) {
+    throw RuntimeError("Trsm failed with status " + ToString(status));
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+}
+
+template <typename T>
+void TuneXtrsm(int argc, char* argv[]) {
+  auto command_line_args = RetrieveCommandLineArguments(argc, argv);
+  auto help = std::string{"* Options given/available:\n"};
+  const auto platform_id =
+      GetArgument(command_line_args, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id =
+      GetArgument(command_line_args, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto precision = GetArgument(command_line_args, help, kArgPrecision, Precision::kSingle);
+  const auto num_runs = GetArgument(command_line_args, help, kArgNumRuns, size_t{10});
+  fprintf(stdout, "%s\n", help.c_str());
+
+  // Values for the block size: the diagonal-block inversion supports powers of two from 16 up to 128
+  const auto from = size_t{16};
+  const auto to = size_t{128};
+
+  // OpenCL initialisation
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  if (!PrecisionSupported<T>(device)) {
+    printf("* Unsupported precision, skipping this tuning run\n");
+    return;
+  }
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Buffers
+  auto buffers = std::vector<Buffer<T>>{Buffer<T>(context, size * size), Buffer<T>(context, size * size)};
+
+  // Performance testing
+  auto results = std::vector<Timing>();
+  for (auto value = from; value <= to; value *= 2) {
+    const auto result = TimeRoutine(value, value + 1, 1, num_runs, queue, buffers, RunTrsmRoutine<T>);
+    results.insert(results.end(), result.begin(), result.end());
+  }
+
+  // Stores the results in the expected format
+  auto scores = std::vector<TuningResult>();
+  for (const auto& result : results) {
+    if (result.second != -1) {
+      auto tuning_results = Configuration();
+      tuning_results["TRSM_BLOCK_SIZE"] = result.first;
+      tuning_results["PRECISION"] = static_cast<size_t>(precision);
+      scores.emplace_back(TuningResult{"trsm_routine", result.second, tuning_results});
+    }
+  }
+
+  // Computes the best result
+  auto best_time = std::numeric_limits<double>::max();
+  auto best_value = size_t{0};
+  for (const auto& result : results) {
+    if (result.second != -1 && result.second < best_time) {
+      best_time = result.second;
+      best_value = result.first;
+    }
+  }
+  const auto best_string = "TRSM_BLOCK_SIZE=" + ToString(best_value);
+
+  // Outputs the results as JSON to disk, including some meta-data
+  const auto precision_string = std::to_string(static_cast<size_t>(precision));
+  auto metadata = std::vector<std::pair<std::string, std::string>>{
+      {"kernel_family", "trsm_routine"}, {"precision", precision_string},    {"arg_m", ToString(size)},
+      {"best_kernel", "trsm_routine"},   {"best_time", ToString(best_time)}, {"best_parameters", best_string}};
+  PrintTimingsToFileAsJSON("clblast_routine_xtrsm_" + precision_string + ".json", device, platform, metadata, scores);
+
+  printf("* Completed tuning process\n");
+  printf("\n");
+}
+
+// =================================================================================================
+}  // namespace clblast
+
+// Shortcuts to the clblast namespace
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  try {
+    const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+    switch (clblast::GetPrecision(command_line_args)) {
+      case clblast::Precision::kSingle:
+        clblast::TuneXtrsm<float>(argc, argv);
+        break;
+      case clblast::Precision::kDouble:
+        clblast::TuneXtrsm<double>(argc, argv);
+        break;
+      case clblast::Precision::kComplexSingle:
+        clblast::TuneXtrsm<float2>(argc, argv);
+        break;
+      case clblast::Precision::kComplexDouble:
+        clblast::TuneXtrsm<double2>(argc, argv);
+        break;
+    }
+    return 0;
+  } catch (...) {
+    return static_cast<int>(clblast::DispatchException());
+  }
+}
+
+// =================================================================================================
@@ -107,6 +107,8 @@ struct ThreadInfo {
   std::mutex mtx;
   std::string print_info;
   Kernel kernel{nullptr};
+  Kernel epilogue{nullptr};
+  bool has_epilogue = false;
   bool ready = false;
   std::condition_variable cv;
   std::vector<size_t> global;
@@ -182,6 +184,13 @@ void kernelCompilationThread(std::vector<ThreadInfo>& infos, const std::vector<c
       const auto program = CompileFromSource(kernel_source, args.precision, settings.kernel_name, device, context,
                                              compiler_options, 0, true);
       info.kernel = Kernel(program, settings.kernel_name);
+      if (!settings.epilogue_kernel_name.empty()) {
+        const auto skip_parameter = configuration.find(settings.epilogue_skip_parameter);
+        info.has_epilogue = (skip_parameter == configuration.end() || skip_parameter->second == 0);
+        if (info.has_epilogue) {
+          info.epilogue = Kernel(program, settings.epilogue_kernel_name);
+        }
+      }
       const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
       const auto timing = std::chrono::duration<double, std::milli>(elapsed_time).count();
       addPrintInfo(info.print_info, "   %sOK%s  %5.0lf ms |", kPrintSuccess.c_str(), kPrintEnd.c_str(), timing);
@@ -320,9 +329,13 @@ void Tuner(int argc, char* argv[], const int V, GetTunerDefaultsFunc GetTunerDef
   auto reference_buffers = std::vector<std::vector<T>>();
   auto result_buffers = std::vector<std::vector<T>>();
   auto device_buffers = std::vector<Buffer<T>>();
-  for (const auto size : buffer_sizes) {
+  for (auto id = size_t{0}; id < buffer_sizes.size(); ++id) {
+    const auto size = buffer_sizes[id];
     auto host_buffer = std::vector<T>(size);
     PopulateVector(host_buffer, mt, dist);
+    if (std::find(settings.zero_inputs.begin(), settings.zero_inputs.end(), id) != settings.zero_inputs.end()) {
+      std::fill(host_buffer.begin(), host_buffer.end(), ConstantZero<T>());
+    }
     source_buffers.push_back(host_buffer);
     reference_buffers.push_back(std::vector<T>(size));
     result_buffers.push_back(std::vector<T>(size));
@@ -437,6 +450,8 @@ void Tuner(int argc, char* argv[], const int V, GetTunerDefaultsFunc GetTunerDef
       }
 
       Kernel kernel{nullptr};
+      Kernel epilogue{nullptr};
+      auto has_epilogue = false;
       std::vector<size_t> global;
       std::vector<size_t> local;
       {
@@ -447,14 +462,21 @@ void Tuner(int argc, char* argv[], const int V, GetTunerDefaultsFunc GetTunerDef
         std::unique_lock<std::mutex> lock(thread_infos[config_id].mtx);
         thread_infos[config_id].cv.wait(lock, [&] { return thread_infos[config_id].ready; });
         kernel = std::move(thread_infos[config_id].kernel);
+        epilogue = std::move(thread_infos[config_id].epilogue);
+        has_epilogue = thread_infos[config_id].has_epilogue;
         global = std::move(thread_infos[config_id].global);
         local = std::move(thread_infos[config_id].local);
         printf("%s", thread_infos[config_id].print_info.c_str());
       }
 
-      // Runs the kernel
+      // Runs the kernel, followed by the epilogue kernel if there is one
       SetArguments(V, kernel, args, device_buffers);
-      const auto time_ms = TimeKernel(args.num_runs, kernel, queue, device, global, local);
+      if (has_epilogue) {
+        SetArguments(settings.epilogue_variation, epilogue, args, device_buffers);
+      }
+      const auto time_ms =
+          TimeKernel(args.num_runs, kernel, queue, device, global, local, false, has_epilogue ? &epilogue : nullptr,
+                     settings.epilogue_global_size, settings.epilogue_local_size);
 
       // Kernel run was not successful
       if (time_ms == -1.0) {
@@ -66,6 +66,15 @@ struct TunerSettings {
   // Inputs and outputs (X:0, Y:1, A:2, B:3, C:4, temp:5)
   std::vector<size_t> inputs = {};
   std::vector<size_t> outputs = {};
+  std::vector<size_t> zero_inputs = {};  // inputs which are set to zero instead of to random data
+
+  // Optional epilogue kernel from the same sources, launched after the main kernel and included in its
+  // timing. It is skipped for configurations in which 'epilogue_skip_parameter' is non-zero.
+  std::string epilogue_kernel_name = "";
+  std::string epilogue_skip_parameter = "";
+  int epilogue_variation = 0;  // the variation passed to the argument-setting function for the epilogue
+  std::vector<size_t> epilogue_global_size = {};
+  std::vector<size_t> epilogue_local_size = {};
 
   // Sets the base thread configuration
   std::vector<size_t> global_size = {};
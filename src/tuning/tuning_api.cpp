@@ -358,9 +358,13 @@ StatusCode TunerAPI(Queue& queue, const Arguments<T>& args, const int V, const G
   auto reference_buffers = std::vector<std::vector<T>>();
   auto result_buffers = std::vector<std::vector<T>>();
   auto device_buffers = std::vector<Buffer<T>>();
-  for (const auto size : buffer_sizes) {
+  for (auto id = size_t{0}; id < buffer_sizes.size(); ++id) {
+    const auto size = buffer_sizes[id];
     auto host_buffer = std::vector<T>(size);
     PopulateVector(host_buffer, mt, dist);
+    if (std::find(settings.zero_inputs.begin(), settings.zero_inputs.end(), id) != settings.zero_inputs.end()) {
+      std::fill(host_buffer.begin(), host_buffer.end(), ConstantZero<T>());
+    }
     source_buffers.push_back(host_buffer);
     reference_buffers.push_back(std::vector<T>(size));
     result_buffers.push_back(std::vector<T>(size));
@@ -439,9 +443,25 @@ StatusCode TunerAPI(Queue& queue, const Arguments<T>& args, const int V, const G
                                              compiler_options, 0, true);
       auto kernel = Kernel(program, settings.kernel_name);
 
-      // Runs the kernel
+      // Creates the optional epilogue kernel, unless it is disabled by this configuration
+      auto has_epilogue = false;
+      Kernel epilogue{nullptr};
+      if (!settings.epilogue_kernel_name.empty()) {
+        const auto skip_parameter = configuration.find(settings.epilogue_skip_parameter);
+        has_epilogue = (skip_parameter == configuration.end() || skip_parameter->second == 0);
+        if (has_epilogue) {
+          epilogue = Kernel(program, settings.epilogue_kernel_name);
+        }
+      }
+
+      // Runs the kernel, followed by the epilogue kernel if there is one
       SetArguments(V, kernel, args, device_buffers);
-      const auto time_ms = TimeKernel(args.num_runs, kernel, queue, device, global, local, true);
+      if (has_epilogue) {
+        SetArguments(settings.epilogue_variation, epilogue, args, device_buffers);
+      }
+      const auto time_ms = TimeKernel(args.num_runs, kernel, queue, device, global, local, true,
+                                      has_epilogue ? &epilogue : nullptr, settings.epilogue_global_size,
+                                      settings.epilogue_local_size);
 
       // Kernel run was not successful
       if (time_ms == -1.0) {
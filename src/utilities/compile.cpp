@@ -25,7 +25,7 @@ std::shared_ptr<Program> CompileFromSource(const std::string& source_string, con
                                            const std::string& routine_name, const Device& device,
                                            const Context& context, std::vector<std::string>& options,
                                            const size_t run_preprocessor,  // 0: platform dependent, 1: always, 2: never
-                                           const bool silent) {
+                                           const bool silent, const bool device_scalars) {
   auto header_string = std::string{""};
 
   header_string += "#define PRECISION " + ToString(static_cast<int>(precision)) + "\n";
@@ -33,6 +33,11 @@ std::shared_ptr<Program> CompileFromSource(const std::string& source_string, con
   // Adds the name of the routine as a define
   header_string += "#define ROUTINE_" + routine_name + "\n";
 
+  // Passes the scalar arguments (e.g. alpha and beta) of the kernels as pointers to device memory
+  if (device_scalars) {
+    header_string += "#define DEVICE_SCALARS 1\n";
+  }
+
   // Not all OpenCL compilers support the 'inline' keyword. The keyword is only used for devices on
   // which it is known to work with all OpenCL platforms.
   if (device.IsNVIDIA() || device.IsARM() || device.IsQualcomm()) {
@@ -21,12 +21,13 @@
 namespace clblast {
 // =================================================================================================
 
-// Compiles a program from source code
+// Compiles a program from source code. With 'device_scalars' set, the kernels take their scalar
+// arguments as pointers to device memory (see 'scalar_arg' in common.opencl).
 std::shared_ptr<Program> CompileFromSource(const std::string& source_string, const Precision precision,
                                            const std::string& routine_name, const Device& device,
                                            const Context& context, std::vector<std::string>& options,
                                            const size_t run_preprocessor,  // 0: platform dependent, 1: always, 2: never
-                                           const bool silent = false);
+                                           const bool silent = false, const bool device_scalars = false);
 
 // =================================================================================================
 }  // namespace clblast
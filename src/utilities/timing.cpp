@@ -20,7 +20,8 @@ namespace clblast {
 // =================================================================================================
 
 double RunKernelTimed(const size_t num_runs, Kernel& kernel, Queue& queue, const Device& device,
-                      std::vector<size_t> global, const std::vector<size_t>& local) {
+                      std::vector<size_t> global, const std::vector<size_t>& local, Kernel* epilogue,
+                      const std::vector<size_t>& epilogue_global, const std::vector<size_t>& epilogue_local) {
   auto event = Event();
 
   if (!local.empty()) {
@@ -56,19 +57,27 @@ double RunKernelTimed(const size_t num_runs, Kernel& kernel, Queue& queue, const
     throw RuntimeErrorCode(StatusCode::kInvalidLocalMemUsage);
   }
 
-  // Times the kernel
+  // Times the kernel and the optional epilogue kernel
   const auto run_kernel_func = [&]() {
     kernel.Launch(queue, global, local, event.pointer());
-    event.WaitForCompletion();
+    if (epilogue != nullptr) {
+      auto epilogue_event = Event();
+      epilogue->Launch(queue, epilogue_global, epilogue_local, epilogue_event.pointer(), {event});
+      epilogue_event.WaitForCompletion();
+    } else {
+      event.WaitForCompletion();
+    }
     queue.Finish();
   };
   return TimeFunction(num_runs, run_kernel_func);
 }
 
 double TimeKernel(const size_t num_runs, Kernel& kernel, Queue& queue, const Device& device, std::vector<size_t> global,
-                  const std::vector<size_t>& local, const bool silent) {
+                  const std::vector<size_t>& local, const bool silent, Kernel* epilogue,
+                  const std::vector<size_t>& epilogue_global, const std::vector<size_t>& epilogue_local) {
   try {
-    const auto time_ms = RunKernelTimed(num_runs, kernel, queue, device, std::move(global), local);
+    const auto time_ms = RunKernelTimed(num_runs, kernel, queue, device, std::move(global), local, epilogue,
+                                        epilogue_global, epilogue_local);
     if (!silent) {
       printf(" %9.2lf ms |", time_ms);
     }
@@ -38,11 +38,14 @@ double TimeFunction(const size_t num_runs, F const& function) {
 
 // =================================================================================================
 
+// Times a kernel, optionally followed by a second (epilogue) kernel which is then included in the timing
 double RunKernelTimed(const size_t num_runs, Kernel& kernel, Queue& queue, const Device& device,
-                      std::vector<size_t> global, const std::vector<size_t>& local);
+                      std::vector<size_t> global, const std::vector<size_t>& local, Kernel* epilogue = nullptr,
+                      const std::vector<size_t>& epilogue_global = {}, const std::vector<size_t>& epilogue_local = {});
 
 double TimeKernel(const size_t num_runs, Kernel& kernel, Queue& queue, const Device& device, std::vector<size_t> global,
-                  const std::vector<size_t>& local, const bool silent = false);
+                  const std::vector<size_t>& local, const bool silent = false, Kernel* epilogue = nullptr,
+                  const std::vector<size_t>& epilogue_global = {}, const std::vector<size_t>& epilogue_local = {});
 
 // =================================================================================================
 
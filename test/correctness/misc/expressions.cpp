@@ -0,0 +1,133 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the errors of the run-time expressions of the ELEMENTWISE and
+// MAPREDUCE routines: invalid expressions and expressions using operands which are not passed to the
+// routine should all return 'kInvalidExpression'. The correct results of valid expressions are
+// tested by the regular correctness tests of both routines.
+//
+// =================================================================================================
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "test/correctness/tester.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Expressions which are invalid for both routines, either because they can't be parsed or because
+// they use the vector 'w' or the scalar 'c' of which there are none
+const std::vector<std::string> kInvalidCommonExpressions = {
+    "x + q",     // unknown identifier
+    "x + xy",    // unknown identifier
+    "(x*y",      // unbalanced parenthesis
+    "x*y)",      // unbalanced parenthesis
+    "x*(y + )",  // missing operand
+    "c*x",       // missing scalar
+    "w*x",       // missing vector
+};
+
+// Expressions which are only invalid for one of the two routines
+const std::vector<std::string> kInvalidElementwiseExpressions = {
+    "a*x + y",       // no assignment
+    "a = x",         // assignment to a scalar
+    "z = x; w = y",  // missing vector in the second statement
+};
+const std::vector<std::string> kInvalidMapReduceExpressions = {
+    "z = x*y",  // assignment
+    "x; y",     // multiple statements
+};
+
+template <typename T>
+size_t RunExpressionTests(int argc, char* argv[], const bool silent, const std::string& routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id =
+      GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id =
+      GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto n = GetArgument(arguments, help, kArgN, size_t{64});
+
+  // Prints the help message (command-line arguments)
+  if (!silent) {
+    fprintf(stdout, "\n* %s\n", help.c_str());
+  }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Creates the operands: the vectors 'x', 'y' and 'z', the scalars 'a' and 'b', and a result
+  auto device_x = Buffer<T>(context, n);
+  auto device_y = Buffer<T>(context, n);
+  auto device_z = Buffer<T>(context, n);
+  auto device_result = Buffer<T>(context, 1);
+  const T scalars[] = {ConstantOne<T>(), ConstantOne<T>()};
+  const cl_mem buffers[] = {device_x(), device_y(), device_z()};
+  const size_t offsets[] = {0, 0, 0};
+  const size_t incs[] = {1, 1, 1};
+
+  // Runs a single expression and checks the status code
+  auto queue_plain = queue();
+  const auto test_expression = [&](const std::string& expression, const bool is_reduction) {
+    const auto status =
+        (is_reduction) ? MapReduce<T>(expression, n, scalars, 2, buffers, offsets, incs, 3, device_result(), 0,
+                                      &queue_plain, nullptr)
+                       : Elementwise<T>(expression, n, scalars, 2, buffers, offsets, incs, 3, &queue_plain, nullptr);
+    if (status != StatusCode::kInvalidExpression) {
+      fprintf(stdout, "   Error: status %d instead of %d for %s expression '%s'\n", static_cast<int>(status),
+              static_cast<int>(StatusCode::kInvalidExpression), (is_reduction) ? "map-reduce" : "element-wise",
+              expression.c_str());
+      errors++;
+      return;
+    }
+    passed++;
+  };
+
+  // Runs all the tests
+  fprintf(stdout, "* Testing invalid expressions for '%s'\n", routine_name.c_str());
+  for (const auto& expression : kInvalidCommonExpressions) {
+    test_expression("z = " + expression, false);
+    test_expression(expression, true);
+  }
+  for (const auto& expression : kInvalidElementwiseExpressions) {
+    test_expression(expression, false);
+  }
+  for (const auto& expression : kInvalidMapReduceExpressions) {
+    test_expression(expression, true);
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+}  // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunExpressionTests<float>(argc, argv, false, "SELEMENTWISE/SMAPREDUCE");
+  errors += clblast::RunExpressionTests<clblast::float2>(argc, argv, true, "CELEMENTWISE/CMAPREDUCE");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
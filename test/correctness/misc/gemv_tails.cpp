@@ -0,0 +1,140 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the split of GEMV into a bulk part for the fast kernels and the
+// remaining rows and columns for the generic kernel. The sizes are larger than the tiles of the
+// fast kernels, but are not multiples of them, such that both the bulk and the tails are computed.
+// This is tested for the regular (column-major) and the rotated (row-major) fast kernel.
+//
+// =================================================================================================
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test/correctness/tester.hpp"
+#include "test/routines/level2/xgemv.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemvTailsTests(int argc, char* argv[], const bool silent, const std::string& routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42;  // fixed seed for reproducibility
+
+  // Retrieves the arguments. The defaults are an odd number of rows and a number of columns which is not a multiple
+  // of any of the work-group sizes of the fast kernels, both larger than their tile sizes.
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id =
+      GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id =
+      GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  auto args = Arguments<T>{};
+  args.m = GetArgument(arguments, help, kArgM, size_t{4097});
+  args.n = GetArgument(arguments, help, kArgN, size_t{1000});
+  args.a_transpose = Transpose::kNo;
+  args.x_inc = 1;
+  args.y_inc = 1;
+  args.alpha = GetArgument(arguments, help, kArgAlpha, GetScalar<T>());
+  args.beta = GetArgument(arguments, help, kArgBeta, GetScalar<T>());
+
+  // Prints the help message (command-line arguments)
+  if (!silent) {
+    fprintf(stdout, "\n* %s\n", help.c_str());
+  }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Runs the test for the non-rotated and the rotated fast kernel
+  fprintf(stdout, "* Testing the bulk and tail parts of '%s'\n", routine_name.c_str());
+  for (const auto layout : {Layout::kColMajor, Layout::kRowMajor}) {
+    args.layout = layout;
+
+    // The leading dimension is rounded up to a multiple of the largest vector width of the fast kernels
+    args.a_ld = Ceil((layout == Layout::kColMajor) ? args.m : args.n, size_t{8});
+    TestXgemv<T>::SetSizes(args, queue);
+
+    // Populate host data with some example data
+    auto host_a = std::vector<T>(args.a_size);
+    auto host_x = std::vector<T>(args.x_size);
+    auto host_y = std::vector<T>(args.y_size);
+    std::mt19937 mt(kSeed);
+    std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+    PopulateVector(host_a, mt, dist);
+    PopulateVector(host_x, mt, dist);
+    PopulateVector(host_y, mt, dist);
+
+    // Copy the data to the device
+    auto device_a = Buffer<T>(context, host_a.size());
+    auto device_x = Buffer<T>(context, host_x.size());
+    auto device_y = Buffer<T>(context, host_y.size());
+    device_a.Write(queue, host_a.size(), host_a);
+    device_x.Write(queue, host_x.size(), host_x);
+    device_y.Write(queue, host_y.size(), host_y);
+    auto dummy = Buffer<T>(context, 1);
+    auto dummy_scalar = Buffer<unsigned int>(context, 1);
+    auto buffers = Buffers<T>{device_x, device_y, device_a, dummy, dummy, dummy, dummy, dummy_scalar};
+
+    // Runs the routine
+    if (TestXgemv<T>::RunRoutine(args, buffers, queue) != StatusCode::kSuccess) {
+      errors++;
+      continue;
+    }
+    const auto result = TestXgemv<T>::DownloadResult(args, buffers, queue);
+
+    // Compares each element of the result with a host reference
+    auto num_mismatches = size_t{0};
+    for (auto i = size_t{0}; i < args.m; ++i) {
+      auto sum = ConstantZero<T>();
+      for (auto j = size_t{0}; j < args.n; ++j) {
+        const auto a_index = (layout == Layout::kColMajor) ? j * args.a_ld + i : i * args.a_ld + j;
+        sum += host_a[a_index] * host_x[j];
+      }
+      const auto reference = args.alpha * sum + args.beta * host_y[i];
+      if (!TestSimilarity(result[TestXgemv<T>::GetResultIndex(args, i, 0)], reference)) {
+        num_mismatches++;
+      }
+    }
+    if (num_mismatches > 0) {
+      fprintf(stdout, "   Error: %zu mismatches for the %s layout\n", num_mismatches,
+              (layout == Layout::kColMajor) ? "column-major" : "row-major");
+      errors++;
+      continue;
+    }
+    passed++;
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+}  // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemvTailsTests<float>(argc, argv, false, "SGEMV");
+  errors += clblast::RunGemvTailsTests<clblast::float2>(argc, argv, true, "CGEMV");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,226 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the SetReductionMode function. In the reproducible mode the
+// results of the reduction routines should be bitwise identical for different tuning parameters. In
+// the compensated mode they should be similar to those of the default mode. Furthermore, for an input
+// for which the regular summation loses all small terms, the compensated mode should still be exact.
+//
+// =================================================================================================
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "test/correctness/tester.hpp"
+#include "test/routines/level1/xasum.hpp"
+#include "test/routines/level1/xdot.hpp"
+#include "test/routines/level1/xdotu.hpp"
+#include "test/routines/level1/xnrm2.hpp"
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs a single reduction routine and retrieves its result
+template <typename T, typename C>
+StatusCode RunReduction(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue, T& result) {
+  const auto status = C::RunRoutine(args, buffers, queue);
+  if (status == StatusCode::kSuccess) {
+    result = C::DownloadResult(args, buffers, queue)[C::GetResultIndex(args, 0, 0)];
+  }
+  return status;
+}
+
+// Runs a reduction routine in all modes for all the given tuning parameters. Compares the results of
+// the reproducible mode with each other (bitwise) and all results with the default mode (approximately)
+template <typename T, typename C>
+void TestReduction(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue, const Device& device,
+                   const std::vector<std::unordered_map<std::string, size_t>>& settings, size_t& passed,
+                   size_t& errors) {
+  auto reference = T{0};
+  for (auto i = size_t{0}; i < settings.size(); ++i) {
+    if (OverrideParameters(device(), "Xdot", PrecisionValue<T>(), settings[i]) != StatusCode::kSuccess) {
+      errors++;
+      continue;
+    }
+
+    // Runs the routine in all modes
+    auto result_default = T{0};
+    auto result_reproducible = T{0};
+    auto result_compensated = T{0};
+    SetReductionMode(ReductionMode::kDefault);
+    const auto status_default = RunReduction<T, C>(args, buffers, queue, result_default);
+    SetReductionMode(ReductionMode::kReproducible);
+    const auto status_reproducible = RunReduction<T, C>(args, buffers, queue, result_reproducible);
+    SetReductionMode(ReductionMode::kCompensated);
+    const auto status_compensated = RunReduction<T, C>(args, buffers, queue, result_compensated);
+    SetReductionMode(ReductionMode::kDefault);
+    if (status_default != StatusCode::kSuccess || status_reproducible != StatusCode::kSuccess ||
+        status_compensated != StatusCode::kSuccess) {
+      errors++;
+      continue;
+    }
+
+    // Compares the results
+    if (i == 0) {
+      reference = result_reproducible;
+    }
+    if (!(result_reproducible == reference) || !TestSimilarity(result_default, result_reproducible) ||
+        !TestSimilarity(result_default, result_compensated)) {
+      errors++;
+      continue;
+    }
+    passed++;
+  }
+}
+
+// Runs a dot-product with 1 for all elements of y and with an x that consists of large values, then
+// small values, and finally the negated large values. Each thread of the strided summation thus
+// first accumulates a multiple of 2^24, such that all the small terms are lost in the regular
+// summation, after which the large values cancel exactly. The compensated mode has to recover the
+// exact sum of the small terms instead. This holds for any power-of-two number of threads up to the
+// number of large values.
+template <typename T, typename TestDot>
+void TestCompensatedCancellation(const Context& context, Queue& queue, size_t& passed, size_t& errors) {
+  constexpr auto kNumLarge = size_t{1} << 18;
+  constexpr auto kNumSmall = size_t{1} << 19;
+  const auto large = T{static_cast<typename BaseType<T>::Type>(1 << 24)};
+  const auto small = ConstantOne<T>();
+  auto args = Arguments<T>{};
+  args.n = 2 * kNumLarge + kNumSmall;
+  args.x_inc = 1;
+  args.y_inc = 1;
+  TestDot::SetSizes(args, queue);
+
+  // Populates and copies the input data, the exact result is the number of small values
+  auto host_x = std::vector<T>(args.x_size, small);
+  auto host_y = std::vector<T>(args.y_size, ConstantOne<T>());
+  for (auto i = size_t{0}; i < kNumLarge; ++i) {
+    host_x[i] = large;
+    host_x[args.n - 1 - i] = -large;
+  }
+  const auto exact = T{static_cast<typename BaseType<T>::Type>(kNumSmall)};
+  auto device_x = Buffer<T>(context, host_x.size());
+  auto device_y = Buffer<T>(context, host_y.size());
+  auto device_scalar = Buffer<T>(context, args.scalar_size);
+  device_x.Write(queue, host_x.size(), host_x);
+  device_y.Write(queue, host_y.size(), host_y);
+  auto dummy = Buffer<T>(context, 1);
+  auto dummy_scalar = Buffer<unsigned int>(context, 1);
+  auto buffers = Buffers<T>{device_x, device_y, dummy, dummy, dummy, dummy, device_scalar, dummy_scalar};
+
+  // Runs the routine in the default and in the compensated mode
+  auto result_default = T{0};
+  auto result_compensated = T{0};
+  SetReductionMode(ReductionMode::kDefault);
+  const auto status_default = RunReduction<T, TestDot>(args, buffers, queue, result_default);
+  SetReductionMode(ReductionMode::kCompensated);
+  const auto status_compensated = RunReduction<T, TestDot>(args, buffers, queue, result_compensated);
+  SetReductionMode(ReductionMode::kDefault);
+  if (status_default != StatusCode::kSuccess || status_compensated != StatusCode::kSuccess) {
+    errors++;
+    return;
+  }
+
+  // Only the compensated mode should find the exact result
+  if (!(result_compensated == exact) || TestSimilarity(result_default, exact)) {
+    errors++;
+    return;
+  }
+  passed++;
+}
+
+template <typename T, typename TestDot>
+size_t RunReductionModeTests(int argc, char* argv[], const bool silent, const std::string& routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42;  // fixed seed for reproducibility
+
+  // Determines the test settings: different work-group sizes and numbers of work-groups
+  const auto settings = std::vector<std::unordered_map<std::string, size_t>>{
+      {{"SINGLE_PASS", 0}, {"WGS1", 64}, {"WGS2", 64}},
+      {{"SINGLE_PASS", 1}, {"WGS1", 128}, {"WGS2", 32}},
+      {{"SINGLE_PASS", 0}, {"WGS1", 256}, {"WGS2", 128}},
+      {{"SINGLE_PASS", 0}, {"WGS1", 32}, {"WGS2", 256}},
+  };
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id =
+      GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id =
+      GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  auto args = Arguments<T>{};
+  args.n = GetArgument(arguments, help, kArgN, size_t{100000});
+  args.x_inc = GetArgument(arguments, help, kArgXInc, size_t{1});
+  args.y_inc = GetArgument(arguments, help, kArgYInc, size_t{1});
+  args.x_offset = GetArgument(arguments, help, kArgXOffset, size_t{0});
+  args.y_offset = GetArgument(arguments, help, kArgYOffset, size_t{0});
+
+  // Prints the help message (command-line arguments)
+  if (!silent) {
+    fprintf(stdout, "\n* %s\n", help.c_str());
+  }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Populate host vectors with some example data
+  TestDot::SetSizes(args, queue);
+  auto host_x = std::vector<T>(args.x_size);
+  auto host_y = std::vector<T>(args.y_size);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_x, mt, dist);
+  PopulateVector(host_y, mt, dist);
+
+  // Copy the vectors to the device
+  auto device_x = Buffer<T>(context, host_x.size());
+  auto device_y = Buffer<T>(context, host_y.size());
+  auto device_scalar = Buffer<T>(context, args.scalar_size);
+  device_x.Write(queue, host_x.size(), host_x);
+  device_y.Write(queue, host_y.size(), host_y);
+  auto dummy = Buffer<T>(context, 1);
+  auto dummy_scalar = Buffer<unsigned int>(context, 1);
+  auto buffers = Buffers<T>{device_x, device_y, dummy, dummy, dummy, dummy, device_scalar, dummy_scalar};
+
+  // Runs the tests for the different reduction routines
+  fprintf(stdout, "* Testing SetReductionMode for '%s'\n", routine_name.c_str());
+  TestReduction<T, TestDot>(args, buffers, queue, device, settings, passed, errors);
+  TestReduction<T, TestXnrm2<T>>(args, buffers, queue, device, settings, passed, errors);
+  TestReduction<T, TestXasum<T>>(args, buffers, queue, device, settings, passed, errors);
+  TestCompensatedCancellation<T, TestDot>(context, queue, passed, errors);
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+}  // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunReductionModeTests<float, clblast::TestXdot<float>>(argc, argv, false, "SDOT/SNRM2/SASUM");
+  errors += clblast::RunReductionModeTests<clblast::float2, clblast::TestXdotu<clblast::float2>>(argc, argv, true,
+                                                                                               "CDOTU/SCNRM2/SCASUM");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -28,6 +28,14 @@ int main(int argc, char* argv[]) {
       argc, argv, true, "ZGEMM");
   errors +=
       clblast::RunTests<clblast::TestXgemm<2, clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HGEMM");
+  errors += clblast::RunTests<clblast::TestXgemm<3, float>, float, float>(argc, argv, true, "SGEMM");
+  errors += clblast::RunTests<clblast::TestXgemm<3, double>, double, double>(argc, argv, true, "DGEMM");
+  errors += clblast::RunTests<clblast::TestXgemm<3, clblast::float2>, clblast::float2, clblast::float2>(argc, argv,
+                                                                                                        true, "CGEMM");
+  errors += clblast::RunTests<clblast::TestXgemm<3, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZGEMM");
+  errors +=
+      clblast::RunTests<clblast::TestXgemm<3, clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HGEMM");
   if (errors > 0) {
     return 1;
   } else {
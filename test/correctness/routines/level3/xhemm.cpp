@@ -12,10 +12,14 @@
 // Main function (not within the clblast namespace)
 int main(int argc, char* argv[]) {
   auto errors = size_t{0};
-  errors += clblast::RunTests<clblast::TestXhemm<clblast::float2>, clblast::float2, clblast::float2>(argc, argv, false,
-                                                                                                     "CHEMM");
-  errors += clblast::RunTests<clblast::TestXhemm<clblast::double2>, clblast::double2, clblast::double2>(argc, argv,
-                                                                                                        true, "ZHEMM");
+  errors += clblast::RunTests<clblast::TestXhemm<1, clblast::float2>, clblast::float2, clblast::float2>(argc, argv,
+                                                                                                        false, "CHEMM");
+  errors += clblast::RunTests<clblast::TestXhemm<1, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZHEMM");
+  errors += clblast::RunTests<clblast::TestXhemm<2, clblast::float2>, clblast::float2, clblast::float2>(argc, argv,
+                                                                                                        true, "CHEMM");
+  errors += clblast::RunTests<clblast::TestXhemm<2, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZHEMM");
   if (errors > 0) {
     return 1;
   } else {
@@ -12,10 +12,14 @@
 // Main function (not within the clblast namespace)
 int main(int argc, char* argv[]) {
   auto errors = size_t{0};
-  errors +=
-      clblast::RunTests<clblast::TestXherk<clblast::float2, float>, clblast::float2, float>(argc, argv, false, "CHERK");
-  errors += clblast::RunTests<clblast::TestXherk<clblast::double2, double>, clblast::double2, double>(argc, argv, true,
-                                                                                                      "ZHERK");
+  errors += clblast::RunTests<clblast::TestXherk<1, clblast::float2, float>, clblast::float2, float>(argc, argv, false,
+                                                                                                   "CHERK");
+  errors += clblast::RunTests<clblast::TestXherk<1, clblast::double2, double>, clblast::double2, double>(
+      argc, argv, true, "ZHERK");
+  errors += clblast::RunTests<clblast::TestXherk<2, clblast::float2, float>, clblast::float2, float>(argc, argv, true,
+                                                                                                   "CHERK");
+  errors += clblast::RunTests<clblast::TestXherk<2, clblast::double2, double>, clblast::double2, double>(
+      argc, argv, true, "ZHERK");
   if (errors > 0) {
     return 1;
   } else {
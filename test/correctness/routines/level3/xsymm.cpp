@@ -12,14 +12,22 @@
 // Main function (not within the clblast namespace)
 int main(int argc, char* argv[]) {
   auto errors = size_t{0};
-  errors += clblast::RunTests<clblast::TestXsymm<float>, float, float>(argc, argv, false, "SSYMM");
-  errors += clblast::RunTests<clblast::TestXsymm<double>, double, double>(argc, argv, true, "DSYMM");
-  errors += clblast::RunTests<clblast::TestXsymm<clblast::float2>, clblast::float2, clblast::float2>(argc, argv, true,
-                                                                                                     "CSYMM");
-  errors += clblast::RunTests<clblast::TestXsymm<clblast::double2>, clblast::double2, clblast::double2>(argc, argv,
-                                                                                                        true, "ZSYMM");
+  errors += clblast::RunTests<clblast::TestXsymm<1, float>, float, float>(argc, argv, false, "SSYMM");
+  errors += clblast::RunTests<clblast::TestXsymm<1, double>, double, double>(argc, argv, true, "DSYMM");
+  errors += clblast::RunTests<clblast::TestXsymm<1, clblast::float2>, clblast::float2, clblast::float2>(argc, argv,
+                                                                                                        true, "CSYMM");
+  errors += clblast::RunTests<clblast::TestXsymm<1, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZSYMM");
   errors +=
-      clblast::RunTests<clblast::TestXsymm<clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HSYMM");
+      clblast::RunTests<clblast::TestXsymm<1, clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HSYMM");
+  errors += clblast::RunTests<clblast::TestXsymm<2, float>, float, float>(argc, argv, true, "SSYMM");
+  errors += clblast::RunTests<clblast::TestXsymm<2, double>, double, double>(argc, argv, true, "DSYMM");
+  errors += clblast::RunTests<clblast::TestXsymm<2, clblast::float2>, clblast::float2, clblast::float2>(argc, argv,
+                                                                                                        true, "CSYMM");
+  errors += clblast::RunTests<clblast::TestXsymm<2, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZSYMM");
+  errors +=
+      clblast::RunTests<clblast::TestXsymm<2, clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HSYMM");
   if (errors > 0) {
     return 1;
   } else {
@@ -12,14 +12,22 @@
 // Main function (not within the clblast namespace)
 int main(int argc, char* argv[]) {
   auto errors = size_t{0};
-  errors += clblast::RunTests<clblast::TestXsyrk<float>, float, float>(argc, argv, false, "SSYRK");
-  errors += clblast::RunTests<clblast::TestXsyrk<double>, double, double>(argc, argv, true, "DSYRK");
-  errors += clblast::RunTests<clblast::TestXsyrk<clblast::float2>, clblast::float2, clblast::float2>(argc, argv, true,
-                                                                                                     "CSYRK");
-  errors += clblast::RunTests<clblast::TestXsyrk<clblast::double2>, clblast::double2, clblast::double2>(argc, argv,
-                                                                                                        true, "ZSYRK");
+  errors += clblast::RunTests<clblast::TestXsyrk<1, float>, float, float>(argc, argv, false, "SSYRK");
+  errors += clblast::RunTests<clblast::TestXsyrk<1, double>, double, double>(argc, argv, true, "DSYRK");
+  errors += clblast::RunTests<clblast::TestXsyrk<1, clblast::float2>, clblast::float2, clblast::float2>(argc, argv,
+                                                                                                        true, "CSYRK");
+  errors += clblast::RunTests<clblast::TestXsyrk<1, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZSYRK");
   errors +=
-      clblast::RunTests<clblast::TestXsyrk<clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HSYRK");
+      clblast::RunTests<clblast::TestXsyrk<1, clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HSYRK");
+  errors += clblast::RunTests<clblast::TestXsyrk<2, float>, float, float>(argc, argv, true, "SSYRK");
+  errors += clblast::RunTests<clblast::TestXsyrk<2, double>, double, double>(argc, argv, true, "DSYRK");
+  errors += clblast::RunTests<clblast::TestXsyrk<2, clblast::float2>, clblast::float2, clblast::float2>(argc, argv,
+                                                                                                        true, "CSYRK");
+  errors += clblast::RunTests<clblast::TestXsyrk<2, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZSYRK");
+  errors +=
+      clblast::RunTests<clblast::TestXsyrk<2, clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HSYRK");
   if (errors > 0) {
     return 1;
   } else {
@@ -0,0 +1,33 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xamaxbatched.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXamaxBatched<float>, float, float>(argc, argv, false, "iSAMAXBATCHED");
+  errors += clblast::RunTests<clblast::TestXamaxBatched<double>, double, double>(argc, argv, true, "iDAMAXBATCHED");
+  errors +=
+      clblast::RunTests<clblast::TestXamaxBatched<clblast::float2>, clblast::float2, clblast::float2>(
+          argc, argv, true, "iCAMAXBATCHED");
+  errors +=
+      clblast::RunTests<clblast::TestXamaxBatched<clblast::double2>, clblast::double2, clblast::double2>(
+          argc, argv, true, "iZAMAXBATCHED");
+  errors +=
+      clblast::RunTests<clblast::TestXamaxBatched<clblast::half>, clblast::half, clblast::half>(
+          argc, argv, true, "iHAMAXBATCHED");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,30 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xamaxmatrix.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXamaxMatrix<float>, float, float>(argc, argv, false, "iSAMAXMATRIX");
+  errors += clblast::RunTests<clblast::TestXamaxMatrix<double>, double, double>(argc, argv, true, "iDAMAXMATRIX");
+  errors += clblast::RunTests<clblast::TestXamaxMatrix<clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "iCAMAXMATRIX");
+  errors += clblast::RunTests<clblast::TestXamaxMatrix<clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "iZAMAXMATRIX");
+  errors += clblast::RunTests<clblast::TestXamaxMatrix<clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "iHAMAXMATRIX");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,33 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xasumbatched.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXasumBatched<float>, float, float>(argc, argv, false, "SASUMBATCHED");
+  errors += clblast::RunTests<clblast::TestXasumBatched<double>, double, double>(argc, argv, true, "DASUMBATCHED");
+  errors +=
+      clblast::RunTests<clblast::TestXasumBatched<clblast::float2>, clblast::float2, clblast::float2>(
+          argc, argv, true, "ScASUMBATCHED");
+  errors +=
+      clblast::RunTests<clblast::TestXasumBatched<clblast::double2>, clblast::double2, clblast::double2>(
+          argc, argv, true, "DzASUMBATCHED");
+  errors +=
+      clblast::RunTests<clblast::TestXasumBatched<clblast::half>, clblast::half, clblast::half>(
+          argc, argv, true, "HASUMBATCHED");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,32 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xaxpydevicescalars.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXaxpydevicescalars<float>, float, float>(
+      argc, argv, false, "SAXPYDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXaxpydevicescalars<double>, double, double>(
+      argc, argv, true, "DAXPYDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXaxpydevicescalars<clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CAXPYDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXaxpydevicescalars<clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZAXPYDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXaxpydevicescalars<clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HAXPYDEVICESCALARS");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,27 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xdotbatched.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXdotBatched<float>, float, float>(argc, argv, false, "SDOTBATCHED");
+  errors += clblast::RunTests<clblast::TestXdotBatched<double>, double, double>(argc, argv, true, "DDOTBATCHED");
+  errors +=
+      clblast::RunTests<clblast::TestXdotBatched<clblast::half>, clblast::half, clblast::half>(
+          argc, argv, true, "HDOTBATCHED");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
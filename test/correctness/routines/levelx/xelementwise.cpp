@@ -0,0 +1,46 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xelementwise.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXelementwise<0, float>, float, float>(argc, argv, false, "SELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<0, double>, double, double>(argc, argv, true, "DELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<0, clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<0, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<0, clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<1, float>, float, float>(argc, argv, true, "SELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<1, double>, double, double>(argc, argv, true, "DELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<1, clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<1, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<1, clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<2, float>, float, float>(argc, argv, true, "SELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<2, double>, double, double>(argc, argv, true, "DELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<2, clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<2, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZELEMENTWISE");
+  errors += clblast::RunTests<clblast::TestXelementwise<2, clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HELEMENTWISE");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
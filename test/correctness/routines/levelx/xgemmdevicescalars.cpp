@@ -0,0 +1,52 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xgemmdevicescalars.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<1, float>, float, float>(
+      argc, argv, false, "SGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<1, double>, double, double>(
+      argc, argv, true, "DGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<1, clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<1, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<1, clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<2, float>, float, float>(
+      argc, argv, true, "SGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<2, double>, double, double>(
+      argc, argv, true, "DGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<2, clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<2, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<2, clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<3, float>, float, float>(
+      argc, argv, true, "SGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<3, double>, double, double>(
+      argc, argv, true, "DGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<3, clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<3, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZGEMMDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemmdevicescalars<3, clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HGEMMDEVICESCALARS");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,30 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xgemmgrouped.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXgemmGrouped<float>, float, float>(argc, argv, false, "SGEMMGROUPED");
+  errors += clblast::RunTests<clblast::TestXgemmGrouped<double>, double, double>(argc, argv, true, "DGEMMGROUPED");
+  errors += clblast::RunTests<clblast::TestXgemmGrouped<clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CGEMMGROUPED");
+  errors += clblast::RunTests<clblast::TestXgemmGrouped<clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZGEMMGROUPED");
+  errors += clblast::RunTests<clblast::TestXgemmGrouped<clblast::half>, clblast::half, clblast::half>(argc, argv, true,
+                                                                                                      "HGEMMGROUPED");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,32 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xgemvdevicescalars.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXgemvdevicescalars<float>, float, float>(
+      argc, argv, false, "SGEMVDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemvdevicescalars<double>, double, double>(
+      argc, argv, true, "DGEMVDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemvdevicescalars<clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CGEMVDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemvdevicescalars<clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZGEMVDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXgemvdevicescalars<clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HGEMVDEVICESCALARS");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,26 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xgerdeferred.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXgerDeferred<float>, float, float>(argc, argv, false, "SGERDEFERRED");
+  errors += clblast::RunTests<clblast::TestXgerDeferred<double>, double, double>(argc, argv, true, "DGERDEFERRED");
+  errors += clblast::RunTests<clblast::TestXgerDeferred<clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HGERDEFERRED");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,26 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xher2deferred.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXher2Deferred<clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, false, "CHER2DEFERRED");
+  errors += clblast::RunTests<clblast::TestXher2Deferred<clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZHER2DEFERRED");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
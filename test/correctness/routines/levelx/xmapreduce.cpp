@@ -0,0 +1,38 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xmapreduce.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXmapreduce<0, float>, float, float>(argc, argv, false, "SMAPREDUCE");
+  errors += clblast::RunTests<clblast::TestXmapreduce<0, double>, double, double>(argc, argv, true, "DMAPREDUCE");
+  errors += clblast::RunTests<clblast::TestXmapreduce<0, clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CMAPREDUCE");
+  errors += clblast::RunTests<clblast::TestXmapreduce<0, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZMAPREDUCE");
+  errors += clblast::RunTests<clblast::TestXmapreduce<0, clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HMAPREDUCE");
+  errors += clblast::RunTests<clblast::TestXmapreduce<1, float>, float, float>(argc, argv, true, "SMAPREDUCE");
+  errors += clblast::RunTests<clblast::TestXmapreduce<1, double>, double, double>(argc, argv, true, "DMAPREDUCE");
+  errors += clblast::RunTests<clblast::TestXmapreduce<1, clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CMAPREDUCE");
+  errors += clblast::RunTests<clblast::TestXmapreduce<1, clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZMAPREDUCE");
+  errors += clblast::RunTests<clblast::TestXmapreduce<1, clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HMAPREDUCE");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
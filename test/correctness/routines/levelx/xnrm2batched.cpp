@@ -0,0 +1,33 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xnrm2batched.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXnrm2Batched<float>, float, float>(argc, argv, false, "SNRM2BATCHED");
+  errors += clblast::RunTests<clblast::TestXnrm2Batched<double>, double, double>(argc, argv, true, "DNRM2BATCHED");
+  errors +=
+      clblast::RunTests<clblast::TestXnrm2Batched<clblast::float2>, clblast::float2, clblast::float2>(
+          argc, argv, true, "ScNRM2BATCHED");
+  errors +=
+      clblast::RunTests<clblast::TestXnrm2Batched<clblast::double2>, clblast::double2, clblast::double2>(
+          argc, argv, true, "DzNRM2BATCHED");
+  errors +=
+      clblast::RunTests<clblast::TestXnrm2Batched<clblast::half>, clblast::half, clblast::half>(
+          argc, argv, true, "HNRM2BATCHED");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -0,0 +1,32 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xscaldevicescalars.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXscaldevicescalars<float>, float, float>(
+      argc, argv, false, "SSCALDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXscaldevicescalars<double>, double, double>(
+      argc, argv, true, "DSCALDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXscaldevicescalars<clblast::float2>, clblast::float2, clblast::float2>(
+      argc, argv, true, "CSCALDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXscaldevicescalars<clblast::double2>, clblast::double2, clblast::double2>(
+      argc, argv, true, "ZSCALDEVICESCALARS");
+  errors += clblast::RunTests<clblast::TestXscaldevicescalars<clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HSCALDEVICESCALARS");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
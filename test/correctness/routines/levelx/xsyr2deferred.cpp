@@ -0,0 +1,26 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/routines/levelx/xsyr2deferred.hpp"
+
+#include "test/correctness/testblas.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char* argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXsyr2Deferred<float>, float, float>(argc, argv, false, "SSYR2DEFERRED");
+  errors += clblast::RunTests<clblast::TestXsyr2Deferred<double>, double, double>(argc, argv, true, "DSYR2DEFERRED");
+  errors += clblast::RunTests<clblast::TestXsyr2Deferred<clblast::half>, clblast::half, clblast::half>(
+      argc, argv, true, "HSYR2DEFERRED");
+  if (errors > 0) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+// =================================================================================================
@@ -604,6 +604,8 @@ size_t RunTests(int argc, char* argv[], const bool silent, const std::string& na
               i_args.a_offsets = std::vector<size_t>(i_args.batch_count);
               i_args.b_offsets = std::vector<size_t>(i_args.batch_count);
               i_args.c_offsets = std::vector<size_t>(i_args.batch_count);
+              i_args.x_offsets = std::vector<size_t>(i_args.batch_count);
+              i_args.y_offsets = std::vector<size_t>(i_args.batch_count);
               for (auto& x_size : x_sizes) {
                 i_args.x_size = x_size;
                 for (auto& y_size : y_sizes) {
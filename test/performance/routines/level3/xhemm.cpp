@@ -20,10 +20,10 @@ int main(int argc, char* argv[]) {
     case clblast::Precision::kDouble:
       throw std::runtime_error("Unsupported precision mode");
     case clblast::Precision::kComplexSingle:
-      clblast::RunClient<clblast::TestXhemm<clblast::float2>, clblast::float2, clblast::float2>(argc, argv);
+      clblast::RunClient<clblast::TestXhemm<0, clblast::float2>, clblast::float2, clblast::float2>(argc, argv);
       break;
     case clblast::Precision::kComplexDouble:
-      clblast::RunClient<clblast::TestXhemm<clblast::double2>, clblast::double2, clblast::double2>(argc, argv);
+      clblast::RunClient<clblast::TestXhemm<0, clblast::double2>, clblast::double2, clblast::double2>(argc, argv);
       break;
   }
   return 0;
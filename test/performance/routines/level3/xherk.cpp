@@ -20,10 +20,10 @@ int main(int argc, char* argv[]) {
     case clblast::Precision::kDouble:
       throw std::runtime_error("Unsupported precision mode");
     case clblast::Precision::kComplexSingle:
-      clblast::RunClient<clblast::TestXherk<clblast::float2, float>, clblast::float2, float>(argc, argv);
+      clblast::RunClient<clblast::TestXherk<0, clblast::float2, float>, clblast::float2, float>(argc, argv);
       break;
     case clblast::Precision::kComplexDouble:
-      clblast::RunClient<clblast::TestXherk<clblast::double2, double>, clblast::double2, double>(argc, argv);
+      clblast::RunClient<clblast::TestXherk<0, clblast::double2, double>, clblast::double2, double>(argc, argv);
       break;
   }
   return 0;
@@ -14,19 +14,19 @@ int main(int argc, char* argv[]) {
   const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
   switch (clblast::GetPrecision(command_line_args, clblast::Precision::kSingle)) {
     case clblast::Precision::kHalf:
-      clblast::RunClient<clblast::TestXsymm<clblast::half>, clblast::half, clblast::half>(argc, argv);
+      clblast::RunClient<clblast::TestXsymm<0, clblast::half>, clblast::half, clblast::half>(argc, argv);
       break;
     case clblast::Precision::kSingle:
-      clblast::RunClient<clblast::TestXsymm<float>, float, float>(argc, argv);
+      clblast::RunClient<clblast::TestXsymm<0, float>, float, float>(argc, argv);
       break;
     case clblast::Precision::kDouble:
-      clblast::RunClient<clblast::TestXsymm<double>, double, double>(argc, argv);
+      clblast::RunClient<clblast::TestXsymm<0, double>, double, double>(argc, argv);
       break;
     case clblast::Precision::kComplexSingle:
-      clblast::RunClient<clblast::TestXsymm<clblast::float2>, clblast::float2, clblast::float2>(argc, argv);
+      clblast::RunClient<clblast::TestXsymm<0, clblast::float2>, clblast::float2, clblast::float2>(argc, argv);
       break;
     case clblast::Precision::kComplexDouble:
-      clblast::RunClient<clblast::TestXsymm<clblast::double2>, clblast::double2, clblast::double2>(argc, argv);
+      clblast::RunClient<clblast::TestXsymm<0, clblast::double2>, clblast::double2, clblast::double2>(argc, argv);
       break;
   }
   return 0;
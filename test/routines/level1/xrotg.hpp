@@ -0,0 +1,150 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xrotg routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XROTG_H_
+#define CLBLAST_TEST_ROUTINES_XROTG_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXrotg {
+ public:
+  // The BLAS level: 1, 2, or 3
+  static size_t BLASLevel() { return 1; }
+
+  // The list of arguments relevant for this routine. The scalars a, b, c and s are stored in the
+  // vectors x and y and the matrices A and B respectively, such that their offsets can be tested
+  static std::vector<std::string> GetOptions() { return {kArgXOffset, kArgYOffset, kArgAOffset, kArgBOffset}; }
+  static std::vector<std::string> BuffersIn() { return {kBufVecX, kBufVecY, kBufMatA, kBufMatB}; }
+  static std::vector<std::string> BuffersOut() { return {kBufVecX, kBufVecY, kBufMatA, kBufMatB}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T>& args) { return 1 + args.x_offset; }
+  static size_t GetSizeY(const Arguments<T>& args) { return 1 + args.y_offset; }
+  static size_t GetSizeA(const Arguments<T>& args) { return 1 + args.a_offset; }
+  static size_t GetSizeB(const Arguments<T>& args) { return 1 + args.b_offset; }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T>& args, Queue&) {
+    args.x_size = GetSizeX(args);
+    args.y_size = GetSizeY(args);
+    args.a_size = GetSizeA(args);
+    args.b_size = GetSizeB(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t DefaultLDB(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T>&) { return 1; }  // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes&) { return {}; }  // N/A for this routine
+  static Transposes GetBTransposes(const Transposes&) { return {}; }  // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&) {
+  }  // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+#ifdef OPENCL_API
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = Rotg<T>(buffers.x_vec(), args.x_offset, buffers.y_vec(), args.y_offset, buffers.a_mat(),
+                          args.a_offset, buffers.b_mat(), args.b_offset, &queue_plain, &event);
+    if (status == StatusCode::kSuccess) {
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+    }
+#elif CUDA_API
+    auto status = Rotg<T>(buffers.x_vec(), args.x_offset, buffers.y_vec(), args.y_offset, buffers.a_mat(),
+                          args.a_offset, buffers.b_mat(), args.b_offset, queue.GetContext()(), queue.GetDevice()());
+    cuStreamSynchronize(queue());
+#endif
+    return status;
+  }
+
+// Describes how to run the clBLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CLBLAS
+  static StatusCode RunReference1(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = clblasXrotg<T>(buffers.x_vec, args.x_offset, buffers.y_vec, args.y_offset, buffers.a_mat,
+                                 args.a_offset, buffers.b_mat, args.b_offset, 1, &queue_plain, 0, nullptr, &event);
+    clWaitForEvents(1, &event);
+    return static_cast<StatusCode>(status);
+  }
+#endif
+
+// Describes how to run the CPU BLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CBLAS
+  static StatusCode RunReference2(const Arguments<T>& args, BuffersHost<T>& buffers_host, Queue&) {
+    cblasXrotg(buffers_host.x_vec, args.x_offset, buffers_host.y_vec, args.y_offset, buffers_host.a_mat, args.a_offset,
+               buffers_host.b_mat, args.b_offset);
+    return StatusCode::kSuccess;
+  }
+#endif
+
+// Describes how to run the cuBLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CUBLAS
+  static StatusCode RunReference3(const Arguments<T>& args, BuffersCUDA<T>& buffers, Queue&) {
+    auto status = cublasXrotg(reinterpret_cast<cublasHandle_t>(args.cublas_handle), buffers.x_vec, args.x_offset,
+                              buffers.y_vec, args.y_offset, buffers.a_mat, args.a_offset, buffers.b_mat, args.b_offset);
+    if (status == CUBLAS_STATUS_SUCCESS) {
+      return StatusCode::kSuccess;
+    } else {
+      return StatusCode::kUnknownError;
+    }
+  }
+#endif
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    std::vector<T> result(args.x_size + args.y_size + args.a_size + args.b_size, static_cast<T>(0));
+    buffers.x_vec.Read(queue, args.x_size, &result[0]);
+    buffers.y_vec.Read(queue, args.y_size, &result[args.x_size]);
+    buffers.a_mat.Read(queue, args.a_size, &result[args.x_size + args.y_size]);
+    buffers.b_mat.Read(queue, args.b_size, &result[args.x_size + args.y_size + args.a_size]);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t ResultID2(const Arguments<T>&) { return 4; }  // a, b, c and s
+  static size_t GetResultIndex(const Arguments<T>& args, const size_t, const size_t id2) {
+    switch (id2) {
+      case 0:
+        return args.x_offset;
+      case 1:
+        return args.x_size + args.y_offset;
+      case 2:
+        return args.x_size + args.y_size + args.a_offset;
+      default:
+        return args.x_size + args.y_size + args.a_size + args.b_offset;
+    }
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T>&) { return 10; }
+  static size_t GetBytes(const Arguments<T>&) { return 6 * sizeof(T); }
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XROTG_H_
+#endif
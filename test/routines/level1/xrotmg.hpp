@@ -0,0 +1,161 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xrotmg routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XROTMG_H_
+#define CLBLAST_TEST_ROUTINES_XROTMG_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXrotmg {
+ public:
+  // The BLAS level: 1, 2, or 3
+  static size_t BLASLevel() { return 1; }
+
+  // The list of arguments relevant for this routine. The scalars d1, d2, x1 and y1 are stored in the
+  // vectors x and y and the matrices A and B respectively, the parameter array is stored in matrix C
+  static std::vector<std::string> GetOptions() {
+    return {kArgXOffset, kArgYOffset, kArgAOffset, kArgBOffset, kArgCOffset};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufVecX, kBufVecY, kBufMatA, kBufMatB, kBufMatC}; }
+  static std::vector<std::string> BuffersOut() { return {kBufVecX, kBufVecY, kBufMatA, kBufMatC}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T>& args) { return 1 + args.x_offset; }
+  static size_t GetSizeY(const Arguments<T>& args) { return 1 + args.y_offset; }
+  static size_t GetSizeA(const Arguments<T>& args) { return 1 + args.a_offset; }
+  static size_t GetSizeB(const Arguments<T>& args) { return 1 + args.b_offset; }
+  static size_t GetSizeC(const Arguments<T>& args) { return 5 + args.c_offset; }  // the flag and the 2x2 matrix H
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T>& args, Queue&) {
+    args.x_size = GetSizeX(args);
+    args.y_size = GetSizeY(args);
+    args.a_size = GetSizeA(args);
+    args.b_size = GetSizeB(args);
+    args.c_size = GetSizeC(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t DefaultLDB(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T>&) { return 1; }  // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes&) { return {}; }  // N/A for this routine
+  static Transposes GetBTransposes(const Transposes&) { return {}; }  // N/A for this routine
+
+  // Describes how to prepare the input data: the scaling factors d1 and d2 should be non-negative
+  static void PrepareData(const Arguments<T>& args, Queue&, const int, std::vector<T>& d1_source,
+                          std::vector<T>& d2_source, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {
+    d1_source[args.x_offset] = std::abs(d1_source[args.x_offset]);
+    d2_source[args.y_offset] = std::abs(d2_source[args.y_offset]);
+  }
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+#ifdef OPENCL_API
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = Rotmg<T>(buffers.x_vec(), args.x_offset, buffers.y_vec(), args.y_offset, buffers.a_mat(),
+                           args.a_offset, buffers.b_mat(), args.b_offset, buffers.c_mat(), args.c_offset, &queue_plain,
+                           &event);
+    if (status == StatusCode::kSuccess) {
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+    }
+#elif CUDA_API
+    auto status = Rotmg<T>(buffers.x_vec(), args.x_offset, buffers.y_vec(), args.y_offset, buffers.a_mat(),
+                           args.a_offset, buffers.b_mat(), args.b_offset, buffers.c_mat(), args.c_offset,
+                           queue.GetContext()(), queue.GetDevice()());
+    cuStreamSynchronize(queue());
+#endif
+    return status;
+  }
+
+// Describes how to run the clBLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CLBLAS
+  static StatusCode RunReference1(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = clblasXrotmg<T>(buffers.x_vec, args.x_offset, buffers.y_vec, args.y_offset, buffers.a_mat,
+                                  args.a_offset, buffers.b_mat, args.b_offset, buffers.c_mat, args.c_offset, 1,
+                                  &queue_plain, 0, nullptr, &event);
+    clWaitForEvents(1, &event);
+    return static_cast<StatusCode>(status);
+  }
+#endif
+
+// Describes how to run the CPU BLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CBLAS
+  static StatusCode RunReference2(const Arguments<T>& args, BuffersHost<T>& buffers_host, Queue&) {
+    cblasXrotmg(buffers_host.x_vec, args.x_offset, buffers_host.y_vec, args.y_offset, buffers_host.a_mat, args.a_offset,
+                buffers_host.b_mat, args.b_offset, buffers_host.c_mat, args.c_offset);
+    return StatusCode::kSuccess;
+  }
+#endif
+
+// Describes how to run the cuBLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CUBLAS
+  static StatusCode RunReference3(const Arguments<T>& args, BuffersCUDA<T>& buffers, Queue&) {
+    auto status = cublasXrotmg(reinterpret_cast<cublasHandle_t>(args.cublas_handle), buffers.x_vec, args.x_offset,
+                               buffers.y_vec, args.y_offset, buffers.a_mat, args.a_offset, buffers.b_mat, args.b_offset,
+                               buffers.c_mat, args.c_offset);
+    if (status == CUBLAS_STATUS_SUCCESS) {
+      return StatusCode::kSuccess;
+    } else {
+      return StatusCode::kUnknownError;
+    }
+  }
+#endif
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    std::vector<T> result(args.x_size + args.y_size + args.a_size + args.c_size, static_cast<T>(0));
+    buffers.x_vec.Read(queue, args.x_size, &result[0]);
+    buffers.y_vec.Read(queue, args.y_size, &result[args.x_size]);
+    buffers.a_mat.Read(queue, args.a_size, &result[args.x_size + args.y_size]);
+    buffers.c_mat.Read(queue, args.c_size, &result[args.x_size + args.y_size + args.a_size]);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer: d1, d2, x1 and the 5 parameters
+  static size_t ResultID1(const Arguments<T>&) { return 8; }
+  static size_t ResultID2(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t GetResultIndex(const Arguments<T>& args, const size_t id1, const size_t) {
+    switch (id1) {
+      case 0:
+        return args.x_offset;
+      case 1:
+        return args.x_size + args.y_offset;
+      case 2:
+        return args.x_size + args.y_size + args.a_offset;
+      default:
+        return args.x_size + args.y_size + args.a_size + args.c_offset + (id1 - 3);
+    }
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T>&) { return 20; }
+  static size_t GetBytes(const Arguments<T>&) { return 12 * sizeof(T); }
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XROTMG_H_
+#endif
@@ -18,7 +18,8 @@ namespace clblast {
 // =================================================================================================
 
 // See comment at top of file for a description of the class
-template <int V, typename T>  // 'V' is the version of the kernel (0 for default, 1 for 'in-direct', 2 for 'direct')
+template <int V, typename T>  // 'V' is the version of the kernel (0 for default, 1 for 'in-direct', 2 for 'direct',
+                              // 3 for 'in-direct' with Stream-K enabled)
 class TestXgemm {
  public:
   // The BLAS level: 1, 2, or 3
@@ -59,12 +60,15 @@ class TestXgemm {
     args.b_size = GetSizeB(args);
     args.c_size = GetSizeC(args);
 
-    // Optionally (V != 0) enforces indirect (V == 1) or direct (V == 2) kernels
+    // Optionally (V != 0) enforces indirect (V == 1), direct (V == 2), or indirect Stream-K (V == 3) kernels
     if (V != 0) {
       const auto device = queue.GetDevice();
-      const auto switch_threshold = (V == 1) ? size_t{0} : size_t{4096};  // large enough for tests
-      const auto override_status = OverrideParameters(device(), "GemmRoutine", PrecisionValue<T>(),
-                                                      {{"XGEMM_MIN_INDIRECT_SIZE", switch_threshold}});
+      const auto switch_threshold = (V == 2) ? size_t{4096} : size_t{0};  // large enough for tests
+      const auto streamk_groups = (V == 3) ? size_t{1} : size_t{0};
+      const auto override_status = OverrideParameters(
+          device(), "GemmRoutine", PrecisionValue<T>(),
+          {{"XGEMM_GROUPED_GROUPS", 8}, {"XGEMM_MIN_INDIRECT_SIZE", switch_threshold},
+           {"XGEMM_STREAMK_GROUPS", streamk_groups}});
       if (override_status != StatusCode::kSuccess) {
       }
     }
@@ -18,7 +18,7 @@ namespace clblast {
 // =================================================================================================
 
 // See comment at top of file for a description of the class
-template <typename T>
+template <int V, typename T>  // 'V' is the version of the kernel (0 for default, 1 for 'in-direct', 2 for 'direct')
 class TestXhemm {
  public:
   // The BLAS level: 1, 2, or 3
@@ -52,10 +52,21 @@ class TestXhemm {
   }
 
   // Describes how to set the sizes of all the buffers
-  static void SetSizes(Arguments<T>& args, Queue&) {
+  static void SetSizes(Arguments<T>& args, Queue& queue) {
     args.a_size = GetSizeA(args);
     args.b_size = GetSizeB(args);
     args.c_size = GetSizeC(args);
+
+    // Optionally (V != 0) enforces indirect (V == 1) or direct (V == 2) kernels
+    if (V != 0) {
+      const auto device = queue.GetDevice();
+      const auto switch_threshold = (V == 2) ? size_t{4096} : size_t{0};  // large enough for tests
+      const auto override_status = OverrideParameters(
+          device(), "GemmRoutine", PrecisionValue<T>(),
+          {{"XGEMM_GROUPED_GROUPS", 8}, {"XGEMM_MIN_INDIRECT_SIZE", switch_threshold}, {"XGEMM_STREAMK_GROUPS", 0}});
+      if (override_status != StatusCode::kSuccess) {
+      }
+    }
   }
 
   // Describes what the default values of the leading dimensions of the matrices are
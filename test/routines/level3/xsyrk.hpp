@@ -18,7 +18,7 @@ namespace clblast {
 // =================================================================================================
 
 // See comment at top of file for a description of the class
-template <typename T>
+template <int V, typename T>  // 'V' is the version of the kernel (0 for default, 1 for 'recursive', 2 for 'direct')
 class TestXsyrk {
  public:
   // The BLAS level: 1, 2, or 3
@@ -42,9 +42,21 @@ class TestXsyrk {
   static size_t GetSizeC(const Arguments<T>& args) { return args.n * args.c_ld + args.c_offset; }
 
   // Describes how to set the sizes of all the buffers
-  static void SetSizes(Arguments<T>& args, Queue&) {
+  static void SetSizes(Arguments<T>& args, Queue& queue) {
     args.a_size = GetSizeA(args);
     args.c_size = GetSizeC(args);
+
+    // Optionally (V != 0) enforces the recursive version with GEMMs for the off-diagonal blocks (V == 1)
+    // or the single direct kernel (V == 2)
+    if (V != 0) {
+      const auto device = queue.GetDevice();
+      const auto switch_threshold = (V == 2) ? size_t{4096} : size_t{0};  // large enough for tests
+      const auto override_status = OverrideParameters(
+          device(), "GemmRoutine", PrecisionValue<T>(),
+          {{"XGEMM_GROUPED_GROUPS", 8}, {"XGEMM_MIN_INDIRECT_SIZE", switch_threshold}, {"XGEMM_STREAMK_GROUPS", 0}});
+      if (override_status != StatusCode::kSuccess) {
+      }
+    }
   }
 
   // Describes what the default values of the leading dimensions of the matrices are
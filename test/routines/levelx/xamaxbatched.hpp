@@ -0,0 +1,167 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the XamaxBatched routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XAMAXBATCHED_H_
+#define CLBLAST_TEST_ROUTINES_XAMAXBATCHED_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXamaxBatched {
+ public:
+  // Although it is a non-BLAS routine, it can still be tested against level-1 routines in a loop
+  static size_t BLASLevel() { return 1; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN, kArgXInc, kArgXOffset, kArgImaxOffset, kArgBatchCount};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufVecX, kBufScalarUint}; }
+  static std::vector<std::string> BuffersOut() { return {kBufScalarUint}; }
+
+  // Helper for the sizes per batch
+  static size_t PerBatchSizeX(const Arguments<T>& args) { return args.n * args.x_inc; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T>& args) { return PerBatchSizeX(args) * args.batch_count + args.x_offset; }
+  static size_t GetSizeAmax(const Arguments<T>& args) { return args.batch_count + args.imax_offset; }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T>& args, Queue&) {
+    args.x_size = GetSizeX(args);
+    args.scalar_size = GetSizeAmax(args);
+
+    // Also sets the batch-related variables
+    args.x_offsets = std::vector<size_t>(args.batch_count);
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      args.x_offsets[batch] = batch * PerBatchSizeX(args) + args.x_offset;
+    }
+  }
+
+  // The results of the batches are stored consecutively
+  static std::vector<size_t> AmaxOffsets(const Arguments<T>& args) {
+    auto imax_offsets = std::vector<size_t>(args.batch_count);
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      imax_offsets[batch] = args.imax_offset + batch;
+    }
+    return imax_offsets;
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t DefaultLDB(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T>&) { return 1; }  // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes&) { return {}; }  // N/A for this routine
+  static Transposes GetBTransposes(const Transposes&) { return {}; }  // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&) {
+  }  // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    const auto imax_offsets = AmaxOffsets(args);
+#ifdef OPENCL_API
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = AmaxBatched<T>(args.n, buffers.scalar_uint(), imax_offsets.data(), buffers.x_vec(),
+                                 args.x_offsets.data(), args.x_inc, args.batch_count, &queue_plain, &event);
+    if (status == StatusCode::kSuccess) {
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+    }
+#elif CUDA_API
+    auto status = AmaxBatched<T>(args.n, buffers.scalar_uint(), imax_offsets.data(), buffers.x_vec(),
+                                 args.x_offsets.data(), args.x_inc, args.batch_count, queue.GetContext()(),
+                                 queue.GetDevice()());
+    cuStreamSynchronize(queue());
+#endif
+    return status;
+  }
+
+// Describes how to run the clBLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CLBLAS
+  static StatusCode RunReference1(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    auto queue_plain = queue();
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      auto event = cl_event{};
+      auto status = clblasXamax<T>(args.n, buffers.scalar_uint, args.imax_offset + batch, buffers.x_vec,
+                                   args.x_offsets[batch], args.x_inc, 1, &queue_plain, 0, nullptr, &event);
+      clWaitForEvents(1, &event);
+      if (static_cast<StatusCode>(status) != StatusCode::kSuccess) {
+        return static_cast<StatusCode>(status);
+      }
+    }
+    return StatusCode::kSuccess;
+  }
+#endif
+
+// Describes how to run the CPU BLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CBLAS
+  static StatusCode RunReference2(const Arguments<T>& args, BuffersHost<T>& buffers_host, Queue&) {
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      cblasXamax(args.n, buffers_host.scalar_uint, args.imax_offset + batch, buffers_host.x_vec, args.x_offsets[batch],
+                 args.x_inc);
+    }
+    return StatusCode::kSuccess;
+  }
+#endif
+
+// Describes how to run the cuBLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CUBLAS
+  static StatusCode RunReference3(const Arguments<T>& args, BuffersCUDA<T>& buffers, Queue&) {
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      auto status = cublasXamax(reinterpret_cast<cublasHandle_t>(args.cublas_handle), args.n, buffers.scalar_uint,
+                                args.imax_offset + batch, buffers.x_vec, args.x_offsets[batch], args.x_inc);
+      if (status != CUBLAS_STATUS_SUCCESS) {
+        return StatusCode::kUnknownError;
+      }
+    }
+    return StatusCode::kSuccess;
+  }
+#endif
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    std::vector<unsigned int> result_uint(args.scalar_size, 0);
+    buffers.scalar_uint.Read(queue, args.scalar_size, result_uint);
+    // The results are integers, stored as type 'T' for the comparisons of the test infrastructure
+    std::vector<T> result(args.scalar_size);
+    for (auto i = size_t{0}; i < args.scalar_size; ++i) {
+      result[i] = static_cast<T>(result_uint[i]);
+    }
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t ResultID2(const Arguments<T>& args) { return args.batch_count; }
+  static size_t GetResultIndex(const Arguments<T>& args, const size_t, const size_t id2) {
+    return args.imax_offset + id2;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T>& args) { return args.batch_count * args.n; }
+  static size_t GetBytes(const Arguments<T>& args) { return args.batch_count * (args.n + 1) * sizeof(T); }
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XAMAXBATCHED_H_
+#endif
@@ -0,0 +1,162 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the XamaxMatrix routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XAMAXMATRIX_H_
+#define CLBLAST_TEST_ROUTINES_XAMAXMATRIX_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXamaxMatrix {
+ public:
+  // Although it is a non-BLAS routine, it operates on a matrix and is thus tested as a level-2 routine
+  static size_t BLASLevel() { return 2; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM, kArgN, kArgLayout, kArgATransp, kArgALeadDim, kArgAOffset, kArgImaxOffset};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufScalarUint}; }
+  static std::vector<std::string> BuffersOut() { return {kBufScalarUint}; }
+
+  // Whether the columns of op(A) are rotated in memory, i.e. whether their elements are 'a_ld' apart
+  static bool IsRotated(const Arguments<T>& args) {
+    return (args.a_transpose != Transpose::kNo) ^ (args.layout == Layout::kRowMajor);
+  }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeA(const Arguments<T>& args) {
+    auto a_two = (IsRotated(args)) ? args.m : args.n;
+    return a_two * args.a_ld + args.a_offset;
+  }
+  static size_t GetSizeAmax(const Arguments<T>& args) { return args.n + args.imax_offset; }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T>& args, Queue&) {
+    args.a_size = GetSizeA(args);
+    args.scalar_size = GetSizeAmax(args);
+  }
+
+  // The offset and increment of a column of op(A), as a vector
+  static size_t ColumnOffset(const Arguments<T>& args, const size_t column) {
+    return args.a_offset + ((IsRotated(args)) ? column : column * args.a_ld);
+  }
+  static size_t ColumnInc(const Arguments<T>& args) { return (IsRotated(args)) ? args.a_ld : 1; }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T>& args) { return (IsRotated(args)) ? args.n : args.m; }
+  static size_t DefaultLDB(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T>&) { return 1; }  // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes& all) { return all; }
+  static Transposes GetBTransposes(const Transposes&) { return {}; }  // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&) {
+  }  // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+#ifdef OPENCL_API
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = AmaxMatrix<T>(args.layout, args.a_transpose, args.m, args.n, buffers.scalar_uint(),
+                                args.imax_offset, buffers.a_mat(), args.a_offset, args.a_ld, &queue_plain, &event);
+    if (status == StatusCode::kSuccess) {
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+    }
+#elif CUDA_API
+    auto status = AmaxMatrix<T>(args.layout, args.a_transpose, args.m, args.n, buffers.scalar_uint(),
+                                args.imax_offset, buffers.a_mat(), args.a_offset, args.a_ld, queue.GetContext()(),
+                                queue.GetDevice()());
+    cuStreamSynchronize(queue());
+#endif
+    return status;
+  }
+
+// Describes how to run the clBLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CLBLAS
+  static StatusCode RunReference1(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    auto queue_plain = queue();
+    for (auto column = size_t{0}; column < args.n; ++column) {
+      auto event = cl_event{};
+      auto status = clblasXamax<T>(args.m, buffers.scalar_uint, args.imax_offset + column, buffers.a_mat,
+                                   ColumnOffset(args, column), ColumnInc(args), 1, &queue_plain, 0, nullptr, &event);
+      clWaitForEvents(1, &event);
+      if (static_cast<StatusCode>(status) != StatusCode::kSuccess) {
+        return static_cast<StatusCode>(status);
+      }
+    }
+    return StatusCode::kSuccess;
+  }
+#endif
+
+// Describes how to run the CPU BLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CBLAS
+  static StatusCode RunReference2(const Arguments<T>& args, BuffersHost<T>& buffers_host, Queue&) {
+    for (auto column = size_t{0}; column < args.n; ++column) {
+      cblasXamax(args.m, buffers_host.scalar_uint, args.imax_offset + column, buffers_host.a_mat,
+                 ColumnOffset(args, column), ColumnInc(args));
+    }
+    return StatusCode::kSuccess;
+  }
+#endif
+
+// Describes how to run the cuBLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CUBLAS
+  static StatusCode RunReference3(const Arguments<T>& args, BuffersCUDA<T>& buffers, Queue&) {
+    for (auto column = size_t{0}; column < args.n; ++column) {
+      auto status = cublasXamax(reinterpret_cast<cublasHandle_t>(args.cublas_handle), args.m, buffers.scalar_uint,
+                                args.imax_offset + column, buffers.a_mat, ColumnOffset(args, column), ColumnInc(args));
+      if (status != CUBLAS_STATUS_SUCCESS) {
+        return StatusCode::kUnknownError;
+      }
+    }
+    return StatusCode::kSuccess;
+  }
+#endif
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    std::vector<unsigned int> result_uint(args.scalar_size, 0);
+    buffers.scalar_uint.Read(queue, args.scalar_size, result_uint);
+    // The results are integers, stored as type 'T' for the comparisons of the test infrastructure
+    std::vector<T> result(args.scalar_size);
+    for (auto i = size_t{0}; i < args.scalar_size; ++i) {
+      result[i] = static_cast<T>(result_uint[i]);
+    }
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t ResultID2(const Arguments<T>& args) { return args.n; }
+  static size_t GetResultIndex(const Arguments<T>& args, const size_t, const size_t id2) {
+    return args.imax_offset + id2;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T>& args) { return args.m * args.n; }
+  static size_t GetBytes(const Arguments<T>& args) { return (args.m * args.n + args.n) * sizeof(T); }
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XAMAXMATRIX_H_
+#endif
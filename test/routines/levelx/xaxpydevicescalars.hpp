@@ -0,0 +1,55 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xaxpydevicescalars routine. It
+// is the same as the regular Xaxpy routine, except that alpha is first copied to device memory and
+// then passed to the routine by reference.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XAXPYDEVICESCALARS_H_
+#define CLBLAST_TEST_ROUTINES_XAXPYDEVICESCALARS_H_
+
+#include <vector>
+
+#include "test/routines/level1/xaxpy.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXaxpydevicescalars : public TestXaxpy<T> {
+ public:
+  // Describes how to run the CLBlast routine. The value is stored behind a zero, such that a non-zero scalar offset is
+  // tested as well.
+  static StatusCode RunRoutine(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    const auto scalars = std::vector<T>{ConstantZero<T>(), args.alpha};
+    auto scalar_buffer = Buffer<T>(queue.GetContext(), scalars.size());
+    scalar_buffer.Write(queue, scalars.size(), scalars);
+#ifdef OPENCL_API
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status =
+        AxpyDeviceScalars<T>(args.n, scalar_buffer(), 1, buffers.x_vec(), args.x_offset, args.x_inc, buffers.y_vec(),
+                             args.y_offset, args.y_inc, &queue_plain, &event);
+    if (status == StatusCode::kSuccess) {
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+    }
+#elif CUDA_API
+    auto status =
+        AxpyDeviceScalars<T>(args.n, scalar_buffer(), 1, buffers.x_vec(), args.x_offset, args.x_inc, buffers.y_vec(),
+                             args.y_offset, args.y_inc, queue.GetContext()(), queue.GetDevice()());
+    cuStreamSynchronize(queue());
+#endif
+    return status;
+  }
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XAXPYDEVICESCALARS_H_
+#endif
@@ -0,0 +1,206 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xdgmm routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XDGMM_H_
+#define CLBLAST_TEST_ROUTINES_XDGMM_H_
+
+#include "clblast_half.h"
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+StatusCode RunReference(const Arguments<T>& args, BuffersHost<T>& buffers_host) {
+  // Checking for invalid arguments
+  const auto rotated = (args.layout == Layout::kRowMajor);
+  const auto one = (rotated) ? args.n : args.m;
+  const auto two = (rotated) ? args.m : args.n;
+  const auto x_size = (args.side == Side::kLeft) ? args.m : args.n;
+  if ((args.m == 0) || (args.n == 0)) {
+    return StatusCode::kInvalidDimension;
+  }
+  if (args.a_ld < one) {
+    return StatusCode::kInvalidLeadDimA;
+  }
+  if (buffers_host.a_mat.size() < args.a_ld * (two - 1) + one + args.a_offset) {
+    return StatusCode::kInsufficientMemoryA;
+  }
+  if (args.c_ld < one) {
+    return StatusCode::kInvalidLeadDimC;
+  }
+  if (buffers_host.c_mat.size() < args.c_ld * (two - 1) + one + args.c_offset) {
+    return StatusCode::kInsufficientMemoryC;
+  }
+  if (args.x_inc == 0) {
+    return StatusCode::kInvalidIncrementX;
+  }
+  if (buffers_host.x_vec.size() < (x_size - 1) * args.x_inc + 1 + args.x_offset) {
+    return StatusCode::kInsufficientMemoryX;
+  }
+
+  // Scales the rows (left) or the columns (right) of the matrix
+  for (auto id1 = size_t{0}; id1 < args.m; ++id1) {
+    for (auto id2 = size_t{0}; id2 < args.n; ++id2) {
+      const auto a_index = (rotated) ? id1 * args.a_ld + id2 : id2 * args.a_ld + id1;
+      const auto c_index = (rotated) ? id1 * args.c_ld + id2 : id2 * args.c_ld + id1;
+      const auto x_index = (args.side == Side::kLeft) ? id1 : id2;
+      const auto scale = buffers_host.x_vec[x_index * args.x_inc + args.x_offset];
+      buffers_host.c_mat[c_index + args.c_offset] = scale * buffers_host.a_mat[a_index + args.a_offset];
+    }
+  }
+  return StatusCode::kSuccess;
+}
+
+// Half-precision version calling the above reference implementation after conversions
+template <>
+StatusCode RunReference<half>(const Arguments<half>& args, BuffersHost<half>& buffers_host) {
+  auto x_buffer2 = HalfToFloatBuffer(buffers_host.x_vec);
+  auto a_buffer2 = HalfToFloatBuffer(buffers_host.a_mat);
+  auto c_buffer2 = HalfToFloatBuffer(buffers_host.c_mat);
+  auto dummy = std::vector<float>(0);
+  auto dummy_uint = std::vector<unsigned int>(0);
+  auto buffers2 = BuffersHost<float>{x_buffer2, dummy, a_buffer2, dummy, c_buffer2, dummy, dummy, dummy_uint};
+  auto args2 = Arguments<float>();
+  args2.x_size = args.x_size;
+  args2.a_size = args.a_size;
+  args2.c_size = args.c_size;
+  args2.x_inc = args.x_inc;
+  args2.a_ld = args.a_ld;
+  args2.c_ld = args.c_ld;
+  args2.m = args.m;
+  args2.n = args.n;
+  args2.x_offset = args.x_offset;
+  args2.a_offset = args.a_offset;
+  args2.c_offset = args.c_offset;
+  args2.layout = args.layout;
+  args2.side = args.side;
+  auto status = RunReference(args2, buffers2);
+  FloatToHalfBuffer(buffers_host.c_mat, buffers2.c_mat);
+  return status;
+}
+
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXdgmm {
+ public:
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM,        kArgN,    kArgLayout,  kArgSide,    kArgALeadDim,
+            kArgCLeadDim, kArgXInc, kArgAOffset, kArgXOffset, kArgCOffset};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufVecX, kBufMatC}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatC}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T>& args) {
+    const auto x_size = (args.side == Side::kLeft) ? args.m : args.n;
+    return x_size * args.x_inc + args.x_offset;
+  }
+  static size_t GetSizeA(const Arguments<T>& args) {
+    const auto a_two = (args.layout == Layout::kRowMajor) ? args.m : args.n;
+    return a_two * args.a_ld + args.a_offset;
+  }
+  static size_t GetSizeC(const Arguments<T>& args) {
+    const auto c_two = (args.layout == Layout::kRowMajor) ? args.m : args.n;
+    return c_two * args.c_ld + args.c_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T>& args, Queue&) {
+    args.x_size = GetSizeX(args);
+    args.a_size = GetSizeA(args);
+    args.c_size = GetSizeC(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T>& args) { return (args.layout == Layout::kRowMajor) ? args.n : args.m; }
+  static size_t DefaultLDB(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T>& args) { return (args.layout == Layout::kRowMajor) ? args.n : args.m; }
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes&) { return {}; }  // N/A for this routine
+  static Transposes GetBTransposes(const Transposes&) { return {}; }  // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&) {
+  }  // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+#ifdef OPENCL_API
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = Dgmm<T>(args.layout, args.side, args.m, args.n, buffers.a_mat(), args.a_offset, args.a_ld,
+                          buffers.x_vec(), args.x_offset, args.x_inc, buffers.c_mat(), args.c_offset, args.c_ld,
+                          &queue_plain, &event);
+    if (status == StatusCode::kSuccess) {
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+    }
+#elif CUDA_API
+    auto status = Dgmm<T>(args.layout, args.side, args.m, args.n, buffers.a_mat(), args.a_offset, args.a_ld,
+                          buffers.x_vec(), args.x_offset, args.x_inc, buffers.c_mat(), args.c_offset, args.c_ld,
+                          queue.GetContext()(), queue.GetDevice()());
+    cuStreamSynchronize(queue());
+#endif
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T>& args, BuffersHost<T>& buffers_host, Queue&) {
+    return RunReference(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T>&, BuffersCUDA<T>&, Queue&) { return StatusCode::kUnknownError; }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    std::vector<T> result(args.c_size, static_cast<T>(0));
+    buffers.c_mat.Read(queue, args.c_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T>& args) { return args.m; }
+  static size_t ResultID2(const Arguments<T>& args) { return args.n; }
+  static size_t GetResultIndex(const Arguments<T>& args, const size_t id1, const size_t id2) {
+    return (args.layout == Layout::kRowMajor) ? id1 * args.c_ld + id2 + args.c_offset
+                                              : id2 * args.c_ld + id1 + args.c_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T>& args) { return args.m * args.n; }
+  static size_t GetBytes(const Arguments<T>& args) {
+    const auto x_size = (args.side == Side::kLeft) ? args.m : args.n;
+    return (2 * args.m * args.n + x_size) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XDGMM_H_
+#endif
@@ -0,0 +1,57 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xgemvdevicescalars routine. It
+// is the same as the regular Xgemv routine, except that alpha and beta are first copied to device
+// memory and then passed to the routine by reference.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XGEMVDEVICESCALARS_H_
+#define CLBLAST_TEST_ROUTINES_XGEMVDEVICESCALARS_H_
+
+#include <vector>
+
+#include "test/routines/level2/xgemv.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXgemvdevicescalars : public TestXgemv<T> {
+ public:
+  // Describes how to run the CLBlast routine. Alpha and beta are stored next to each other in a single buffer, such
+  // that both a zero and a non-zero scalar offset are tested.
+  static StatusCode RunRoutine(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    const auto scalars = std::vector<T>{args.alpha, args.beta};
+    auto scalar_buffer = Buffer<T>(queue.GetContext(), scalars.size());
+    scalar_buffer.Write(queue, scalars.size(), scalars);
+#ifdef OPENCL_API
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status =
+        GemvDeviceScalars<T>(args.layout, args.a_transpose, args.m, args.n, scalar_buffer(), 0, buffers.a_mat(),
+                             args.a_offset, args.a_ld, buffers.x_vec(), args.x_offset, args.x_inc, scalar_buffer(), 1,
+                             buffers.y_vec(), args.y_offset, args.y_inc, &queue_plain, &event);
+    if (status == StatusCode::kSuccess) {
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+    }
+#elif CUDA_API
+    auto status =
+        GemvDeviceScalars<T>(args.layout, args.a_transpose, args.m, args.n, scalar_buffer(), 0, buffers.a_mat(),
+                             args.a_offset, args.a_ld, buffers.x_vec(), args.x_offset, args.x_inc, scalar_buffer(), 1,
+                             buffers.y_vec(), args.y_offset, args.y_inc, queue.GetContext()(), queue.GetDevice()());
+    cuStreamSynchronize(queue());
+#endif
+    return status;
+  }
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XGEMVDEVICESCALARS_H_
+#endif
@@ -0,0 +1,171 @@
+// =================================================================================================
+// This file is part of the CLBlast project. Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the XgerDeferred routine. Examples
+// of such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XGERDEFERRED_H_
+#define CLBLAST_TEST_ROUTINES_XGERDEFERRED_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXgerDeferred {
+ public:
+  // Although it is a non-BLAS routine, it can still be tested against level-2 routines in a loop
+  static size_t BLASLevel() { return 2; }
+
+  // The list of arguments relevant for this routine. The batch count is the number of rank-1 updates.
+  static std::vector<std::string> GetOptions() {
+    return {kArgM,       kArgN,       kArgLayout,     kArgALeadDim, kArgXInc, kArgYInc,
+            kArgAOffset, kArgXOffset, kArgYOffset, kArgBatchCount, kArgAlpha};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufVecX, kBufVecY}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatA}; }
+
+  // Helper for the sizes per update
+  static size_t PerBatchSizeX(const Arguments<T>& args) { return args.m * args.x_inc; }
+  static size_t PerBatchSizeY(const Arguments<T>& args) { return args.n * args.y_inc; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T>& args) { return PerBatchSizeX(args) * args.batch_count + args.x_offset; }
+  static size_t GetSizeY(const Arguments<T>& args) { return PerBatchSizeY(args) * args.batch_count + args.y_offset; }
+  static size_t GetSizeA(const Arguments<T>& args) {
+    auto a_rotated = (args.layout == Layout::kRowMajor);
+    auto a_two = (a_rotated) ? args.m : args.n;
+    return a_two * args.a_ld + args.a_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T>& args, Queue&) {
+    args.a_size = GetSizeA(args);
+    args.x_size = GetSizeX(args);
+    args.y_size = GetSizeY(args);
+
+    // Also sets the batch-related variables
+    args.x_offsets = std::vector<size_t>(args.batch_count);
+    args.y_offsets = std::vector<size_t>(args.batch_count);
+    args.alphas = std::vector<T>(args.batch_count);
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      args.x_offsets[batch] = batch * PerBatchSizeX(args) + args.x_offset;
+      args.y_offsets[batch] = batch * PerBatchSizeY(args) + args.y_offset;
+      args.alphas[batch] = args.alpha + Constant<T>(static_cast<double>(batch + 1));
+    }
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T>& args) { return args.n; }
+  static size_t DefaultLDB(const Arguments<T>&) { return 1; }  // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T>&) { return 1; }  // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes&) { return {}; }  // N/A for this routine
+  static Transposes GetBTransposes(const Transposes&) { return {}; }  // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&) {
+  }  // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+#ifdef OPENCL_API
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = GerDeferred(args.layout, args.m, args.n, args.alphas.data(), buffers.x_vec(), args.x_offsets.data(),
+                              args.x_inc, buffers.y_vec(), args.y_offsets.data(), args.y_inc, buffers.a_mat(),
+                              args.a_offset, args.a_ld, args.batch_count, &queue_plain, &event);
+    if (status == StatusCode::kSuccess) {
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+    }
+#elif CUDA_API
+    auto status = GerDeferred(args.layout, args.m, args.n, args.alphas.data(), buffers.x_vec(), args.x_offsets.data(),
+                              args.x_inc, buffers.y_vec(), args.y_offsets.data(), args.y_inc, buffers.a_mat(),
+                              args.a_offset, args.a_ld, args.batch_count, queue.GetContext()(), queue.GetDevice()());
+    cuStreamSynchronize(queue());
+#endif
+    return status;
+  }
+
+// Describes how to run the clBLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CLBLAS
+  static StatusCode RunReference1(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    auto queue_plain = queue();
+    for (auto l = size_t{0}; l < args.batch_count; ++l) {
+      auto event = cl_event{};
+      auto status = clblasXger(convertToCLBLAS(args.layout), args.m, args.n, args.alphas[l], buffers.x_vec,
+                               args.x_offsets[l], args.x_inc, buffers.y_vec, args.y_offsets[l], args.y_inc,
+                               buffers.a_mat, args.a_offset, args.a_ld, 1, &queue_plain, 0, nullptr, &event);
+      clWaitForEvents(1, &event);
+      if (static_cast<StatusCode>(status) != StatusCode::kSuccess) {
+        return static_cast<StatusCode>(status);
+      }
+    }
+    return StatusCode::kSuccess;
+  }
+#endif
+
+// Describes how to run the CPU BLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CBLAS
+  static StatusCode RunReference2(const Arguments<T>& args, BuffersHost<T>& buffers_host, Queue&) {
+    for (auto l = size_t{0}; l < args.batch_count; ++l) {
+      cblasXger(convertToCBLAS(args.layout), args.m, args.n, args.alphas[l], buffers_host.x_vec, args.x_offsets[l],
+                args.x_inc, buffers_host.y_vec, args.y_offsets[l], args.y_inc, buffers_host.a_mat, args.a_offset,
+                args.a_ld);
+    }
+    return StatusCode::kSuccess;
+  }
+#endif
+
+// Describes how to run the cuBLAS routine (for correctness/performance comparison)
+#ifdef CLBLAST_REF_CUBLAS
+  static StatusCode RunReference3(const Arguments<T>& args, BuffersCUDA<T>& buffers, Queue&) {
+    for (auto l = size_t{0}; l < args.batch_count; ++l) {
+      auto status = cublasXger(reinterpret_cast<cublasHandle_t>(args.cublas_handle), args.layout, args.m, args.n,
+                               args.alphas[l], buffers.x_vec, args.x_offsets[l], args.x_inc, buffers.y_vec,
+                               args.y_offsets[l], args.y_inc, buffers.a_mat, args.a_offset, args.a_ld);
+      if (status != CUBLAS_STATUS_SUCCESS) {
+        return StatusCode::kUnknownError;
+      }
+    }
+    return StatusCode::kSuccess;
+  }
+#endif
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T>& args, Buffers<T>& buffers, Queue& queue) {
+    std::vector<T> result(args.a_size, static_cast<T>(0));
+    buffers.a_mat.Read(queue, args.a_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T>& args) { return args.m; }
+  static size_t ResultID2(const Arguments<T>& args) { return args.n; }
+  static size_t GetResultIndex(const Arguments<T>& args, const size_t id1, const size_t id2) {
+    return (args.layout == Layout::kRowMajor) ? id1 * args.a_ld + id2 + args.a_offset
+                                              : id2 * args.a_ld + id1 + args.a_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T>& args) { return args.batch_count * 2 * args.m * args.n; }
+  static size_t GetBytes(const Arguments<T>& args) {
+    return (2 * args.m * args.n + args.batch_count * (args.m + args.n)) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+}  // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XGERDEFERRED_H_
+#endif